@@ -49,6 +49,30 @@ rocsparse_arguments_config::rocsparse_arguments_config()
         this->l               = static_cast<rocsparse_int>(0);
         this->u               = static_cast<rocsparse_int>(0);
         this->uu              = static_cast<rocsparse_int>(0);
+
+        this->rmat_scale       = static_cast<rocsparse_int>(0);
+        this->rmat_edge_factor = static_cast<rocsparse_int>(0);
+        this->rmat_seed        = static_cast<uint32_t>(0);
+        this->rmat_a           = static_cast<double>(0);
+        this->rmat_b           = static_cast<double>(0);
+        this->rmat_c           = static_cast<double>(0);
+        this->rmat_d           = static_cast<double>(0);
+
+        this->rowdist            = rocsparse_matrix_rowdist_kind_uniform;
+        this->rowdist_max        = static_cast<rocsparse_int>(0);
+        this->rowdist_bandwidth  = static_cast<rocsparse_int>(0);
+        this->rowdist_seed       = static_cast<uint32_t>(0);
+        this->rowdist_mean       = static_cast<double>(0);
+        this->rowdist_cv         = static_cast<double>(0);
+        this->rowdist_clustering = static_cast<double>(0);
+
+        this->stencil_boundary = rocsparse_matrix_stencil_boundary_dirichlet;
+        this->stencil_points   = static_cast<rocsparse_int>(0);
+        this->stencil_dof      = static_cast<rocsparse_int>(0);
+        this->stencil_ax       = static_cast<double>(0);
+        this->stencil_ay       = static_cast<double>(0);
+        this->stencil_az       = static_cast<double>(0);
+
         this->index_type_I    = static_cast<rocsparse_indextype>(0);
         this->index_type_J    = static_cast<rocsparse_indextype>(0);
         this->a_type          = static_cast<rocsparse_datatype>(0);
@@ -237,6 +261,92 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      value<rocsparse_int>(&this->uu)->default_value(0), "assemble "
      "pentadiagonal matrix with stencil <ll l u, uu>.")
 
+    ("rmat_scale",
+     value<rocsparse_int>(&this->rmat_scale)->default_value(0), "assemble "
+     "R-MAT matrix of dimensions 2^rmat_scale x 2^rmat_scale. This will override parameters "
+     "-m, -n and -z.")
+
+    ("rmat_edge_factor",
+     value<rocsparse_int>(&this->rmat_edge_factor)->default_value(0), "assemble "
+     "R-MAT matrix with rmat_edge_factor edges drawn per row (default: 16), duplicated edges "
+     "are merged. Without --rmat_scale, the dimensions are given by -m and -n.")
+
+    ("rmat_a",
+     value<double>(&this->rmat_a)->default_value(0.57), "probability a of the "
+     "R-MAT Kronecker seed <a b, c d>.")
+
+    ("rmat_b",
+     value<double>(&this->rmat_b)->default_value(0.19), "probability b of the "
+     "R-MAT Kronecker seed <a b, c d>.")
+
+    ("rmat_c",
+     value<double>(&this->rmat_c)->default_value(0.19), "probability c of the "
+     "R-MAT Kronecker seed <a b, c d>.")
+
+    ("rmat_d",
+     value<double>(&this->rmat_d)->default_value(0.05), "probability d of the "
+     "R-MAT Kronecker seed <a b, c d>.")
+
+    ("rmat_seed",
+     value<uint32_t>(&this->rmat_seed)->default_value(0), "seed of the R-MAT generator.")
+
+    ("rowdist_mean",
+     value<double>(&this->rowdist_mean)->default_value(0.0), "assemble "
+     "matrix of dimensions -m x -n with row lengths of mean rowdist_mean drawn from the "
+     "distribution --rowdist. This will override parameter -z.")
+
+    ("rowdist",
+     value<int>(&this->b_rowdist)->default_value(0),
+     "distribution of the row lengths with --rowdist_mean, 0 = uniform, 1 = normal,\n"
+     "2 = lognormal, 3 = zipf (power-law), (default: 0)")
+
+    ("rowdist_cv",
+     value<double>(&this->rowdist_cv)->default_value(0.5), "coefficient of variation "
+     "(standard deviation / mean) of the row lengths with --rowdist_mean.")
+
+    ("rowdist_max",
+     value<rocsparse_int>(&this->rowdist_max)->default_value(0), "maximum row length "
+     "with --rowdist_mean, 0 = number of columns.")
+
+    ("rowdist_bandwidth",
+     value<rocsparse_int>(&this->rowdist_bandwidth)->default_value(0), "maximum distance "
+     "of the columns to the diagonal with --rowdist_mean, 0 = no limit.")
+
+    ("rowdist_clustering",
+     value<double>(&this->rowdist_clustering)->default_value(0.0), "clustering of the "
+     "columns in runs of consecutive columns with --rowdist_mean, from 0 (scattered columns) "
+     "to 1 (one dense run per row).")
+
+    ("rowdist_seed",
+     value<uint32_t>(&this->rowdist_seed)->default_value(0), "seed of the row length "
+     "distribution generator.")
+
+    ("stencil_points",
+     value<rocsparse_int>(&this->stencil_points)->default_value(0), "assemble "
+     "stencil matrix with stencil_points points (5 or 9 in 2D, 7, 19 or 27 in 3D) on the grid "
+     "<dimx dimy dimz>, dimz is optional. This will override parameters -m, -n, -z and --mtx.")
+
+    ("stencil_dof",
+     value<rocsparse_int>(&this->stencil_dof)->default_value(1), "number of degrees of "
+     "freedom per node with --stencil_points, the BSR and GEBSR matrices are assembled with "
+     "stencil_dof x stencil_dof blocks.")
+
+    ("stencil_boundary",
+     value<int>(&this->b_stencil_boundary)->default_value(0),
+     "boundary conditions with --stencil_points, 0 = dirichlet, 1 = periodic, (default: 0)")
+
+    ("stencil_ax",
+     value<double>(&this->stencil_ax)->default_value(1.0), "anisotropy coefficient of the "
+     "x axis with --stencil_points.")
+
+    ("stencil_ay",
+     value<double>(&this->stencil_ay)->default_value(1.0), "anisotropy coefficient of the "
+     "y axis with --stencil_points.")
+
+    ("stencil_az",
+     value<double>(&this->stencil_az)->default_value(1.0), "anisotropy coefficient of the "
+     "z axis with --stencil_points.")
+
     ("alpha",
      value<double>(&this->alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -510,6 +620,29 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
       return -1;
     }
 
+  if(this->b_rowdist != rocsparse_matrix_rowdist_kind_uniform
+       && this->b_rowdist != rocsparse_matrix_rowdist_kind_normal
+       && this->b_rowdist != rocsparse_matrix_rowdist_kind_lognormal
+       && this->b_rowdist != rocsparse_matrix_rowdist_kind_zipf)
+  {
+      std::cerr << "Invalid value for --rowdist" << std::endl;
+      return -1;
+  }
+
+  if(this->b_stencil_boundary != rocsparse_matrix_stencil_boundary_dirichlet
+       && this->b_stencil_boundary != rocsparse_matrix_stencil_boundary_periodic)
+  {
+      std::cerr << "Invalid value for --stencil_boundary" << std::endl;
+      return -1;
+  }
+
+  if(this->stencil_points != 0 && this->stencil_points != 5 && this->stencil_points != 7
+       && this->stencil_points != 9 && this->stencil_points != 19 && this->stencil_points != 27)
+  {
+      std::cerr << "Invalid value for --stencil_points" << std::endl;
+      return -1;
+  }
+
   if(this->b_spmv_alg != rocsparse_spmv_alg_default
        && this->b_spmv_alg != rocsparse_spmv_alg_coo
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_adaptive
@@ -605,6 +738,8 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   this->orderC  = (this->b_orderC == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
   this->formatA = (rocsparse_format)this->b_formatA;
   this->formatB = (rocsparse_format)this->b_formatB;
+  this->rowdist = (rocsparse_matrix_rowdist_kind)this->b_rowdist;
+  this->stencil_boundary = (rocsparse_matrix_stencil_boundary)this->b_stencil_boundary;
   this->spmv_alg = (rocsparse_spmv_alg)this->b_spmv_alg;
   this->itilu0_alg = (rocsparse_itilu0_alg)this->b_itilu0_alg;
   this->spmm_alg = (rocsparse_spmm_alg)this->b_spmm_alg;
@@ -698,6 +833,10 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
     strcpy(this->filename, this->b_mlbsr.c_str());
     this->matrix = rocsparse_matrix_file_bsmtx;
   }
+  else if(this->stencil_points != 0 && this->dimx != 0 && this->dimy != 0)
+  {
+    this->matrix = rocsparse_matrix_stencil;
+  }
   else if(this->dimx != 0 && this->dimy != 0 && this->dimz != 0)
   {
     this->matrix = rocsparse_matrix_laplace_3d;
@@ -714,6 +853,18 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   {
     this->matrix = rocsparse_matrix_pentadiagonal;
   }
+  else if(this->rmat_scale != 0 || this->rmat_edge_factor != 0)
+  {
+    this->matrix = rocsparse_matrix_rmat;
+    if(this->rmat_edge_factor == 0)
+    {
+      this->rmat_edge_factor = 16;
+    }
+  }
+  else if(this->rowdist_mean > 0)
+  {
+    this->matrix = rocsparse_matrix_rowdist;
+  }
   else
   {
     this->matrix = rocsparse_matrix_random;
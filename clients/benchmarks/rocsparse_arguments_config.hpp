@@ -58,6 +58,8 @@ private:
     char          b_diag{};
     char          b_uplo{};
     int           b_storage{};
+    int           b_rowdist{};
+    int           b_stencil_boundary{};
     char          b_apol{};
     rocsparse_int b_dir{};
     rocsparse_int b_order{};
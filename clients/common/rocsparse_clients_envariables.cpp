@@ -42,11 +42,17 @@ static constexpr size_t s_var_string_size
 static constexpr const char* s_var_bool_names[s_var_bool_size]
     = {"ROCSPARSE_CLIENTS_VERBOSE", "ROCSPARSE_CLIENTS_TEST_DEBUG_ARGUMENTS"};
 static constexpr const char* s_var_string_names[s_var_string_size]
-    = {"ROCSPARSE_CLIENTS_MATRICES_DIR", "ROCSPARSE_TEST_DATA"};
+    = {"ROCSPARSE_CLIENTS_MATRICES_DIR",
+       "ROCSPARSE_TEST_DATA",
+       "ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR",
+       "ROCSPARSE_CLIENTS_MATRICES_CACHE_SIZE"};
 static constexpr const char* s_var_bool_descriptions[s_var_bool_size]
     = {"0: disabled, 1: enabled", "0: disabled, 1: enabled"};
 static constexpr const char* s_var_string_descriptions[s_var_string_size]
-    = {"Full path of the matrices directory", "The path where the test data file is located"};
+    = {"Full path of the matrices directory",
+       "The path where the test data file is located",
+       "Full path of the directory caching the matrices parsed from text files",
+       "Maximum size in MiB of the matrices cache directory"};
 
 ///
 /// @brief Grab an environment variable value.
@@ -221,6 +227,8 @@ private:
                 break;
             }
             case rocsparse_clients_envariables::TEST_DATA_DIR:
+            case rocsparse_clients_envariables::MATRICES_CACHE_DIR:
+            case rocsparse_clients_envariables::MATRICES_CACHE_SIZE:
             {
                 const bool success = rocsparse_getenv(s_var_string_names[tag],
                                                       this->m_var_string_defined[tag],
@@ -280,6 +288,8 @@ private:
                     break;
                 }
                 case rocsparse_clients_envariables::TEST_DATA_DIR:
+                case rocsparse_clients_envariables::MATRICES_CACHE_DIR:
+                case rocsparse_clients_envariables::MATRICES_CACHE_SIZE:
                 {
                     const std::string v = this->m_var_string[tag];
                     std::cout << ""
@@ -0,0 +1,592 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_clients_matrices_cache.hpp"
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparseio.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <inttypes.h>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#ifndef WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+template <typename T>
+static inline rocsparseio_type rocsparse_clients_matrices_cache_type();
+
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<int8_t>()
+{
+    return rocsparseio_type_int8;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<int32_t>()
+{
+    return rocsparseio_type_int32;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<int64_t>()
+{
+    return rocsparseio_type_int64;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<float>()
+{
+    return rocsparseio_type_float32;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<double>()
+{
+    return rocsparseio_type_float64;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<rocsparse_float_complex>()
+{
+    return rocsparseio_type_complex32;
+}
+template <>
+inline rocsparseio_type rocsparse_clients_matrices_cache_type<rocsparse_double_complex>()
+{
+    return rocsparseio_type_complex64;
+}
+
+//
+// Entries are named rocsparse-<hash of the key>.rocsparseio, they are written to a
+// temporary file renamed once complete, such that concurrent processes sharing the
+// directory never read a partial entry.
+//
+static constexpr const char* s_entry_prefix = "rocsparse-";
+static constexpr const char* s_entry_suffix = ".rocsparseio";
+static constexpr const char* s_entry_tmp    = ".tmp.";
+
+//
+// Temporary files older than this delay (in seconds) are left over by interrupted
+// processes and removed by the eviction.
+//
+static constexpr int64_t s_entry_tmp_expiration = 24 * 3600;
+
+//
+// The file name of rocsparseio_open is a format string.
+//
+static std::string rocsparse_clients_matrices_cache_escape(const std::string& path)
+{
+    std::string s;
+    for(const char c : path)
+    {
+        s += c;
+        if(c == '%')
+        {
+            s += c;
+        }
+    }
+    return s;
+}
+
+struct clients_matrices_cache
+{
+private:
+    bool        m_enabled{};
+    std::string m_dir{};
+    std::string m_name{};
+    uint64_t    m_capacity{};
+    bool        m_capacity_defined{};
+    std::mutex  m_mutex{};
+
+    clients_matrices_cache()
+    {
+        if(rocsparse_clients_envariables::is_defined(
+               rocsparse_clients_envariables::MATRICES_CACHE_DIR))
+        {
+            this->set_dir(rocsparse_clients_envariables::get(
+                rocsparse_clients_envariables::MATRICES_CACHE_DIR));
+        }
+    }
+
+    void read_capacity()
+    {
+        uint64_t size_mib = ROCSPARSE_CLIENTS_MATRICES_CACHE_DEFAULT_SIZE;
+        if(rocsparse_clients_envariables::is_defined(
+               rocsparse_clients_envariables::MATRICES_CACHE_SIZE))
+        {
+            const char* s = rocsparse_clients_envariables::get(
+                rocsparse_clients_envariables::MATRICES_CACHE_SIZE);
+            char*                    end = nullptr;
+            const unsigned long long v   = strtoull(s, &end, 10);
+            if(end == s || *end != '\0')
+            {
+                std::cerr << "rocsparse clients, invalid matrices cache size '" << s
+                          << "', the default size " << ROCSPARSE_CLIENTS_MATRICES_CACHE_DEFAULT_SIZE
+                          << " MiB is used." << std::endl;
+            }
+            else
+            {
+                size_mib = v;
+            }
+        }
+
+        this->m_capacity         = size_mib * 1024 * 1024;
+        this->m_capacity_defined = true;
+    }
+
+public:
+    static clients_matrices_cache& instance()
+    {
+        static clients_matrices_cache self;
+        return self;
+    }
+
+    bool enabled() const
+    {
+        return this->m_enabled;
+    }
+
+    //
+    // Set the directory of the cache, an empty directory disables the cache.
+    //
+    void set_dir(const std::string& dir)
+    {
+        this->m_enabled = false;
+        this->m_dir.clear();
+        this->m_name.clear();
+#ifndef WIN32
+        if(dir.size() == 0)
+        {
+            return;
+        }
+
+        if(mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            std::cerr << "rocsparse clients, matrices cache disabled, cannot create directory '"
+                      << dir << "'" << std::endl;
+            return;
+        }
+
+        if(!this->m_capacity_defined)
+        {
+            this->read_capacity();
+        }
+
+        this->m_name    = dir;
+        this->m_dir     = dir + "/";
+        this->m_enabled = (this->m_capacity > 0);
+#endif
+    }
+
+    const std::string& dir() const
+    {
+        return this->m_name;
+    }
+
+    uint64_t capacity() const
+    {
+        return this->m_capacity;
+    }
+
+    std::mutex& mutex()
+    {
+        return this->m_mutex;
+    }
+
+    //
+    // Build the key of a source file and the path of its entry.
+    //
+    bool entry(const char*          format,
+               const char*          filename,
+               rocsparseio_type     ptr_type,
+               rocsparseio_type     ind_type,
+               rocsparseio_type     val_type,
+               rocsparse_index_base base,
+               std::string&         key,
+               std::string&         path) const
+    {
+#ifdef WIN32
+        return false;
+#else
+        struct stat st;
+        if(stat(filename, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            return false;
+        }
+
+        char* canonical = realpath(filename, nullptr);
+        if(canonical == nullptr)
+        {
+            return false;
+        }
+
+        std::ostringstream os;
+        os << format << ";" << canonical << ";" << st.st_size << ";" << st.st_mtim.tv_sec << "."
+           << st.st_mtim.tv_nsec << ";" << ptr_type << ";" << ind_type << ";" << val_type << ";"
+           << base;
+        free(canonical);
+        key = os.str();
+
+        // FNV-1a, the key itself is the name of the archive entry and is checked on load.
+        uint64_t h = 14695981039346656037ULL;
+        for(const char c : key)
+        {
+            h = (h ^ (unsigned char)c) * 1099511628211ULL;
+        }
+
+        char hash[17];
+        snprintf(hash, sizeof(hash), "%016" PRIx64, h);
+        path = this->m_dir + s_entry_prefix + hash + s_entry_suffix;
+        return true;
+#endif
+    }
+
+    //
+    // Mark an entry as used, the eviction removes the least recently used entries.
+    //
+    static void touch(const std::string& path)
+    {
+#ifndef WIN32
+        utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+#endif
+    }
+
+    //
+    // Remove the least recently used entries until the directory fits the capacity,
+    // the entry just stored is kept.
+    //
+    void evict(const std::string& keep) const
+    {
+#ifndef WIN32
+        struct entry_t
+        {
+            std::string path;
+            uint64_t    nbytes;
+            int64_t     mtime_sec;
+            int64_t     mtime_nsec;
+        };
+
+        DIR* dir = opendir(this->m_dir.c_str());
+        if(dir == nullptr)
+        {
+            return;
+        }
+
+        const std::string    prefix(s_entry_prefix);
+        const std::string    suffix(s_entry_suffix);
+        const int64_t        now   = time(nullptr);
+        uint64_t             total = 0;
+        std::vector<entry_t> entries;
+        for(struct dirent* d = readdir(dir); d != nullptr; d = readdir(dir))
+        {
+            const std::string name(d->d_name);
+            if(name.compare(0, prefix.size(), prefix) != 0)
+            {
+                continue;
+            }
+
+            const std::string path = this->m_dir + name;
+            struct stat       st;
+            if(stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+            {
+                continue;
+            }
+
+            if(name.find(s_entry_tmp) != std::string::npos)
+            {
+                if(now - int64_t(st.st_mtim.tv_sec) > s_entry_tmp_expiration)
+                {
+                    remove(path.c_str());
+                }
+                continue;
+            }
+
+            if(name.size() < suffix.size()
+               || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+            {
+                continue;
+            }
+
+            total += st.st_size;
+            if(path != keep)
+            {
+                entries.push_back(
+                    {path, uint64_t(st.st_size), st.st_mtim.tv_sec, st.st_mtim.tv_nsec});
+            }
+        }
+        closedir(dir);
+
+        if(total <= this->m_capacity)
+        {
+            return;
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const entry_t& a, const entry_t& b) {
+            return (a.mtime_sec < b.mtime_sec)
+                   || (a.mtime_sec == b.mtime_sec && a.mtime_nsec < b.mtime_nsec);
+        });
+
+        for(const entry_t& e : entries)
+        {
+            if(total <= this->m_capacity)
+            {
+                break;
+            }
+            if(remove(e.path.c_str()) == 0)
+            {
+                total -= e.nbytes;
+            }
+        }
+#endif
+    }
+};
+
+bool rocsparse_clients_matrices_cache_enabled()
+{
+    return clients_matrices_cache::instance().enabled();
+}
+
+const char* rocsparse_clients_matrices_cache_dir_get()
+{
+    return clients_matrices_cache::instance().dir().c_str();
+}
+
+void rocsparse_clients_matrices_cache_dir_set(const char* dir)
+{
+    clients_matrices_cache::instance().set_dir(dir);
+}
+
+template <typename I, typename J, typename T>
+bool rocsparse_clients_matrices_cache_load(const char*          format,
+                                           const char*          filename,
+                                           std::vector<I>&      row_ptr,
+                                           std::vector<J>&      col_ind,
+                                           std::vector<T>&      val,
+                                           J&                   M,
+                                           J&                   N,
+                                           I&                   nnz,
+                                           rocsparse_index_base base)
+{
+    clients_matrices_cache& cache = clients_matrices_cache::instance();
+    if(!cache.enabled())
+    {
+        return false;
+    }
+
+    const rocsparseio_type ptr_type = rocsparse_clients_matrices_cache_type<I>();
+    const rocsparseio_type ind_type = rocsparse_clients_matrices_cache_type<J>();
+    const rocsparseio_type val_type = rocsparse_clients_matrices_cache_type<T>();
+
+    std::string key, path;
+    if(!cache.entry(format, filename, ptr_type, ind_type, val_type, base, key, path))
+    {
+        return false;
+    }
+
+    FILE* f = fopen(path.c_str(), "rb");
+    if(f == nullptr)
+    {
+        return false;
+    }
+    fclose(f);
+
+    rocsparseio_handle handle;
+    if(rocsparseio_open(&handle,
+                        rocsparseio_rwmode_read,
+                        rocsparse_clients_matrices_cache_escape(path).c_str())
+       != rocsparseio_status_success)
+    {
+        remove(path.c_str());
+        return false;
+    }
+
+    rocsparseio_direction  io_dir;
+    uint64_t               io_m, io_n, io_nnz;
+    rocsparseio_type       io_ptr_type, io_ind_type, io_val_type;
+    rocsparseio_index_base io_base;
+
+    bool hit
+        = (rocsparseiox_set_io_engine(
+               handle, ROCSPARSEIO_IO_CHUNK_SIZE, ROCSPARSEIO_IO_QUEUE_DEPTH)
+           == rocsparseio_status_success)
+          && (rocsparseiox_archive_seek(handle, key.c_str()) == rocsparseio_status_success)
+          && (rocsparseiox_read_metadata_sparse_csx(handle,
+                                                    &io_dir,
+                                                    &io_m,
+                                                    &io_n,
+                                                    &io_nnz,
+                                                    &io_ptr_type,
+                                                    &io_ind_type,
+                                                    &io_val_type,
+                                                    &io_base)
+              == rocsparseio_status_success)
+          && io_dir == rocsparseio_direction_row && io_ptr_type == ptr_type
+          && io_ind_type == ind_type && io_val_type == val_type
+          && io_base == (rocsparseio_index_base)base && io_nnz > 0;
+
+    if(hit)
+    {
+        row_ptr.resize(io_m + 1);
+        col_ind.resize(io_nnz);
+        val.resize(io_nnz);
+        hit = (rocsparseiox_read_sparse_csx(handle, row_ptr.data(), col_ind.data(), val.data())
+               == rocsparseio_status_success);
+    }
+    rocsparseio_close(handle);
+
+    if(!hit)
+    {
+        // Corrupted entry or hash collision, the entry is stored again.
+        remove(path.c_str());
+        return false;
+    }
+
+    M   = (J)io_m;
+    N   = (J)io_n;
+    nnz = (I)io_nnz;
+    clients_matrices_cache::touch(path);
+    return true;
+}
+
+template <typename I, typename J, typename T>
+void rocsparse_clients_matrices_cache_store(const char*           format,
+                                            const char*           filename,
+                                            const std::vector<I>& row_ptr,
+                                            const std::vector<J>& col_ind,
+                                            const std::vector<T>& val,
+                                            J                     M,
+                                            J                     N,
+                                            I                     nnz,
+                                            rocsparse_index_base  base)
+{
+    clients_matrices_cache& cache = clients_matrices_cache::instance();
+    if(!cache.enabled() || nnz <= 0)
+    {
+        return;
+    }
+
+    const uint64_t nbytes
+        = sizeof(I) * (uint64_t(M) + 1) + (sizeof(J) + sizeof(T)) * uint64_t(nnz);
+    if(nbytes > cache.capacity())
+    {
+        return;
+    }
+
+    const rocsparseio_type ptr_type = rocsparse_clients_matrices_cache_type<I>();
+    const rocsparseio_type ind_type = rocsparse_clients_matrices_cache_type<J>();
+    const rocsparseio_type val_type = rocsparse_clients_matrices_cache_type<T>();
+
+    std::string key, path;
+    if(!cache.entry(format, filename, ptr_type, ind_type, val_type, base, key, path))
+    {
+        return;
+    }
+
+#ifndef WIN32
+    const std::string tmp = path + s_entry_tmp + std::to_string(getpid());
+
+    rocsparseio_handle handle;
+    if(rocsparseio_open(&handle,
+                        rocsparseio_rwmode_write,
+                        rocsparse_clients_matrices_cache_escape(tmp).c_str())
+       != rocsparseio_status_success)
+    {
+        std::cerr << "rocsparse clients, cannot create matrices cache entry '" << tmp << "'"
+                  << std::endl;
+        return;
+    }
+
+    bool success
+        = (rocsparseiox_set_io_engine(
+               handle, ROCSPARSEIO_IO_CHUNK_SIZE, ROCSPARSEIO_IO_QUEUE_DEPTH)
+           == rocsparseio_status_success)
+          && (rocsparseiox_archive_set_name(handle, key.c_str()) == rocsparseio_status_success)
+          && (rocsparseio_write_sparse_csx(handle,
+                                           rocsparseio_direction_row,
+                                           M,
+                                           N,
+                                           nnz,
+                                           ptr_type,
+                                           row_ptr.data(),
+                                           ind_type,
+                                           col_ind.data(),
+                                           val_type,
+                                           val.data(),
+                                           (rocsparseio_index_base)base)
+              == rocsparseio_status_success);
+    success = (rocsparseio_close(handle) == rocsparseio_status_success) && success;
+
+    if(!success || rename(tmp.c_str(), path.c_str()) != 0)
+    {
+        std::cerr << "rocsparse clients, cannot write matrices cache entry '" << path << "'"
+                  << std::endl;
+        remove(tmp.c_str());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    cache.evict(path);
+#endif
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                           \
+    template bool rocsparse_clients_matrices_cache_load(const char*          format,               \
+                                                        const char*          filename,             \
+                                                        std::vector<ITYPE>&  row_ptr,              \
+                                                        std::vector<JTYPE>&  col_ind,              \
+                                                        std::vector<TTYPE>&  val,                  \
+                                                        JTYPE&               M,                    \
+                                                        JTYPE&               N,                    \
+                                                        ITYPE&               nnz,                  \
+                                                        rocsparse_index_base base);                \
+    template void rocsparse_clients_matrices_cache_store(const char*               format,         \
+                                                         const char*               filename,       \
+                                                         const std::vector<ITYPE>& row_ptr,        \
+                                                         const std::vector<JTYPE>& col_ind,        \
+                                                         const std::vector<TTYPE>& val,            \
+                                                         JTYPE                     M,              \
+                                                         JTYPE                     N,              \
+                                                         ITYPE                     nnz,            \
+                                                         rocsparse_index_base      base)
+
+INSTANTIATE(int32_t, int32_t, int8_t);
+INSTANTIATE(int64_t, int32_t, int8_t);
+INSTANTIATE(int64_t, int64_t, int8_t);
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
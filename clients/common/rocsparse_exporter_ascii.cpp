@@ -23,6 +23,10 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_ascii.hpp"
+#include "rocsparse_exporter_chunked.hpp"
+
+#include <sstream>
+
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -48,6 +52,38 @@ rocsparse_exporter_ascii::rocsparse_exporter_ascii(const std::string& filename_)
 
 template <typename T>
 void convert_array(int nnz, const void* data, void* mem);
+
+//
+// Values are written with the scientific format, complex values with their stream operator.
+//
+template <typename T>
+static void rocsparse_exporter_ascii_append_value(std::string& s, const T& v)
+{
+    rocsparse_exporter_chunked::append_scientific(
+        s, v, rocsparse_exporter_chunked::precision<T>());
+}
+
+template <typename T>
+static void rocsparse_exporter_ascii_append_complex(std::string& s, const T& v)
+{
+    s += '(';
+    rocsparse_exporter_chunked::append_general(s, std::real(v));
+    s += ',';
+    rocsparse_exporter_chunked::append_general(s, std::imag(v));
+    s += ')';
+}
+
+static void rocsparse_exporter_ascii_append_value(std::string& s, const rocsparse_float_complex& v)
+{
+    rocsparse_exporter_ascii_append_complex(s, v);
+}
+
+static void rocsparse_exporter_ascii_append_value(std::string&                   s,
+                                                  const rocsparse_double_complex& v)
+{
+    rocsparse_exporter_ascii_append_complex(s, v);
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_exporter_ascii::write_sparse_csx(rocsparse_direction dir_,
                                                             J                   m_,
@@ -58,45 +94,64 @@ rocsparse_status rocsparse_exporter_ascii::write_sparse_csx(rocsparse_direction
                                                             const T* __restrict__ val_,
                                                             rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_internal_error;
     }
+
+    std::ostringstream header;
     if(dir_ == rocsparse_direction_row)
     {
-        out << "matrix: sparse_csr" << std::endl;
+        header << "matrix: sparse_csr" << std::endl;
     }
     else
     {
-        out << "matrix: sparse_csc" << std::endl;
+        header << "matrix: sparse_csc" << std::endl;
     }
 
-    out << "dir: " << dir_ << std::endl;
-    out << "m: " << m_ << std::endl;
-    out << "n: " << n_ << std::endl;
-    out << "nnz: " << nnz_ << std::endl;
-    out << "base: " << base_ << std::endl;
-    const char* dir  = (dir_ == rocsparse_direction_row) ? "row" : "col";
-    const char* odir = (dir_ == rocsparse_direction_row) ? "col" : "row";
+    header << "dir: " << dir_ << std::endl;
+    header << "m: " << m_ << std::endl;
+    header << "n: " << n_ << std::endl;
+    header << "nnz: " << nnz_ << std::endl;
+    header << "base: " << base_ << std::endl;
+    const char* dir  = (dir_ == rocsparse_direction_row) ? "row: " : "col: ";
+    const char* odir = (dir_ == rocsparse_direction_row) ? " col = " : " row = ";
     J           L    = (dir_ == rocsparse_direction_row) ? m_ : n_;
-    for(J i = 0; i < L; ++i)
-    {
-        out << dir << ": " << i << std::endl;
-        for(int k = ptr_[i]; k < ptr_[i + 1]; ++k)
-        {
-            out << " " << odir << " = " << (ind_[k - base_] - base_) << ", val =  " << val_[k]
-                << std::endl;
-        }
-    }
-    out.close();
-    return rocsparse_status_success;
+
+    //
+    // Chunks of rows with a balanced number of lines, one line per row and per entry.
+    //
+    const int64_t chunk  = rocsparse_exporter_chunked::s_chunk_nmemb;
+    const int64_t nlines = int64_t(L) + (int64_t(ptr_[L]) - ptr_[0]);
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(
+              rocsparse_exporter_chunked::nchunks(nlines), [&](int64_t c, std::string& s) {
+                  const J row_begin
+                      = rocsparse_exporter_chunked::find_line(L, ptr_, c * chunk);
+                  const J row_end
+                      = rocsparse_exporter_chunked::find_line(L, ptr_, (c + 1) * chunk);
+                  for(J i = row_begin; i < row_end; ++i)
+                  {
+                      s += dir;
+                      rocsparse_exporter_chunked::append_integer(s, i);
+                      s += '\n';
+                      for(I k = ptr_[i]; k < ptr_[i + 1]; ++k)
+                      {
+                          s += odir;
+                          rocsparse_exporter_chunked::append_integer(s, ind_[k - base_] - base_);
+                          s += ", val =  ";
+                          rocsparse_exporter_ascii_append_value(s, val_[k - base_]);
+                          s += '\n';
+                      }
+                  }
+                  return true;
+              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I, typename J>
@@ -148,67 +203,78 @@ template <typename T, typename I>
 rocsparse_status
     rocsparse_exporter_ascii::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_internal_error;
     }
 
-    out << "matrix: dense_vector" << std::endl;
-    out << "m: " << nmemb_ << std::endl;
-    out << "data: " << std::endl;
-    for(I i = 0; i < nmemb_; ++i)
-    {
-        out << x_[incx_ * i] << std::endl;
-    }
-    out.close();
-    return rocsparse_status_success;
+    std::ostringstream header;
+    header << "matrix: dense_vector" << std::endl;
+    header << "m: " << nmemb_ << std::endl;
+    header << "data: " << std::endl;
+
+    const int64_t chunk = rocsparse_exporter_chunked::s_chunk_nmemb;
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(nmemb_),
+                              [&](int64_t c, std::string& s) {
+                                  const I end = I(std::min(int64_t(nmemb_), (c + 1) * chunk));
+                                  for(I i = I(c * chunk); i < end; ++i)
+                                  {
+                                      rocsparse_exporter_ascii_append_value(s, x_[incx_ * i]);
+                                      s += '\n';
+                                  }
+                                  return true;
+                              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I>
 rocsparse_status rocsparse_exporter_ascii::write_dense_matrix(
     rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_internal_error;
     }
 
-    out << "matrix: dense_matrix" << std::endl;
-    out << "order: " << order_ << std::endl;
-    out << "m: " << m_ << std::endl;
-    out << "n: " << n_ << std::endl;
-    out << "data: " << std::endl;
-    for(I i = 0; i < m_; ++i)
-    {
-        for(I j = 0; j < n_; ++j)
-        {
-            if(order_ == rocsparse_order_row)
-            {
-                out << " " << x_[ld_ * j + i];
-            }
-            else
-            {
-                out << " " << x_[ld_ * i + j];
-            }
-        }
-        out << std::endl;
-    }
-    out.close();
-    return rocsparse_status_success;
+    std::ostringstream header;
+    header << "matrix: dense_matrix" << std::endl;
+    header << "order: " << order_ << std::endl;
+    header << "m: " << m_ << std::endl;
+    header << "n: " << n_ << std::endl;
+    header << "data: " << std::endl;
+
+    const bool    is_row = (order_ == rocsparse_order_row);
+    const int64_t chunk
+        = std::max(rocsparse_exporter_chunked::s_chunk_nmemb / std::max(int64_t(n_), int64_t(1)),
+                   int64_t(1));
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(m_, chunk),
+                              [&](int64_t c, std::string& s) {
+                                  const I end = I(std::min(int64_t(m_), (c + 1) * chunk));
+                                  for(I i = I(c * chunk); i < end; ++i)
+                                  {
+                                      for(I j = 0; j < n_; ++j)
+                                      {
+                                          s += ' ';
+                                          rocsparse_exporter_ascii_append_value(
+                                              s, is_row ? x_[ld_ * j + i] : x_[ld_ * i + j]);
+                                      }
+                                      s += '\n';
+                                  }
+                                  return true;
+                              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I>
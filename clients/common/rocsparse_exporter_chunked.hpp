@@ -0,0 +1,283 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_EXPORTER_CHUNKED_HPP
+#define ROCSPARSE_EXPORTER_CHUNKED_HPP
+
+#include "rocsparse_exporter.hpp"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+// Output engine of the file exporters.
+//
+// The content is split into chunks, each chunk is formatted (or converted) into its own
+// buffer and the buffers are written in order with one fwrite call each. Chunks are
+// processed by rounds of a few chunks per thread, such that the memory footprint does not
+// depend on the size of the matrix. The content of the file does not depend on the number
+// of threads.
+//
+class rocsparse_exporter_chunked
+{
+protected:
+    FILE* m_f{};
+
+public:
+    //
+    // Number of elements (entries, rows or bytes depending on the exporter) of a chunk.
+    //
+    static constexpr int64_t s_chunk_nmemb = 1 << 15;
+
+    //
+    // Number of chunks per thread of a round.
+    //
+    static constexpr int64_t s_round_nchunks = 4;
+
+    //
+    // Text files are opened as std::ofstream does, such that the line endings are unchanged.
+    //
+    rocsparse_exporter_chunked(const std::string& filename_, bool binary_)
+    {
+        this->m_f = fopen(filename_.c_str(), binary_ ? "wb" : "w");
+    }
+
+    ~rocsparse_exporter_chunked()
+    {
+        if(this->m_f != nullptr)
+        {
+            fclose(this->m_f);
+        }
+    }
+
+    rocsparse_exporter_chunked(const rocsparse_exporter_chunked&) = delete;
+    rocsparse_exporter_chunked& operator=(const rocsparse_exporter_chunked&) = delete;
+
+    bool is_open() const
+    {
+        return this->m_f != nullptr;
+    }
+
+    bool write(const void* data_, size_t nbytes_)
+    {
+        return (nbytes_ == 0) || (fwrite(data_, 1, nbytes_, this->m_f) == nbytes_);
+    }
+
+    bool write(const std::string& s_)
+    {
+        return this->write(s_.data(), s_.size());
+    }
+
+    bool close()
+    {
+        const int status = fclose(this->m_f);
+        this->m_f        = nullptr;
+        return (status == 0);
+    }
+
+    //
+    // Number of chunks of nmemb elements.
+    //
+    static int64_t nchunks(int64_t nmemb_, int64_t chunk_nmemb_ = s_chunk_nmemb)
+    {
+        return (nmemb_ + chunk_nmemb_ - 1) / chunk_nmemb_;
+    }
+
+    //
+    // Format the chunks [0, nchunks) with format(chunk, buffer) and write them in order,
+    // format appends to an empty buffer and returns false on failure.
+    //
+    template <typename F>
+    bool write_chunks(int64_t nchunks_, F format_)
+    {
+#ifdef _OPENMP
+        const int64_t nthreads = omp_get_max_threads();
+#else
+        const int64_t nthreads = 1;
+#endif
+        const int64_t            round_size = std::max(nthreads * s_round_nchunks, int64_t(1));
+        std::vector<std::string> buffers(std::min(round_size, nchunks_));
+        for(int64_t round_begin = 0; round_begin < nchunks_; round_begin += round_size)
+        {
+            const int64_t round_end = std::min(round_begin + round_size, nchunks_);
+            int           failed    = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(| : failed)
+#endif
+            for(int64_t c = round_begin; c < round_end; ++c)
+            {
+                std::string& buffer = buffers[c - round_begin];
+                buffer.clear();
+                if(!format_(c, buffer))
+                {
+                    failed |= 1;
+                }
+            }
+
+            if(failed != 0)
+            {
+                return false;
+            }
+
+            for(int64_t c = round_begin; c < round_end; ++c)
+            {
+                if(!this->write(buffers[c - round_begin]))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    //
+    // Index of the row (or column) of the compressed arrays owning the entry at,
+    // i.e. the last i such that ptr[i] - base <= at.
+    //
+    template <typename I, typename J>
+    static J find_row(J m_, const I* __restrict__ ptr_, I at_, rocsparse_index_base base_)
+    {
+        return J(std::upper_bound(ptr_, ptr_ + (m_ + 1), I(at_ + base_)) - ptr_) - 1;
+    }
+
+    //
+    // First row (or column) i of the compressed arrays, clamped to m, such that the number
+    // of lines preceding it, one per row and one per entry, is at least nlines.
+    //
+    template <typename I, typename J>
+    static J find_line(J m_, const I* __restrict__ ptr_, int64_t nlines_)
+    {
+        J lo = 0;
+        J hi = m_;
+        while(lo < hi)
+        {
+            const J mid = lo + (hi - lo) / 2;
+            if((int64_t(ptr_[mid]) - ptr_[0]) + mid < nlines_)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    //
+    // Append the decimal representation of an integer, as std::ostream does.
+    //
+    template <typename I>
+    static void append_integer(std::string& s_, I v_)
+    {
+        using U = typename std::make_unsigned<I>::type;
+        char  buf[24];
+        char* p = buf + sizeof(buf);
+        U     u = (v_ < 0) ? U(U(0) - U(v_)) : U(v_);
+        do
+        {
+            *--p = char('0' + (u % 10));
+            u /= 10;
+        } while(u != 0);
+        if(v_ < 0)
+        {
+            *--p = '-';
+        }
+        s_.append(p, buf + sizeof(buf) - p);
+    }
+
+    //
+    // Append a floating point value as std::ostream does with std::ios::scientific and the
+    // precision precision_, i.e. as the %.*e conversion.
+    //
+    static void append_scientific(std::string& s_, double v_, int precision_)
+    {
+        char      buf[64];
+        const int n = snprintf(buf, sizeof(buf), "%.*e", precision_, v_);
+        s_.append(buf, n);
+    }
+
+    //
+    // Append a floating point value as std::ostream does with its default format and
+    // precision, i.e. as the %.6g conversion.
+    //
+    static void append_general(std::string& s_, double v_)
+    {
+        char      buf[64];
+        const int n = snprintf(buf, sizeof(buf), "%.6g", v_);
+        s_.append(buf, n);
+    }
+
+    //
+    // Precision used by the exporters.
+    //
+    template <typename T>
+    static constexpr int precision()
+    {
+        return (std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>()) ? 15
+                                                                                          : 7;
+    }
+
+    //
+    // Append a value with the scientific format of the exporters, complex values are
+    // written as their real and imaginary parts separated by a space.
+    //
+    template <typename T>
+    static void append_value(std::string& s_, const T& v_)
+    {
+        append_scientific(s_, v_, precision<T>());
+    }
+
+    static void append_value(std::string& s_, const rocsparse_float_complex& v_)
+    {
+        append_scientific(s_, std::real(v_), precision<rocsparse_float_complex>());
+        s_ += ' ';
+        append_scientific(s_, std::imag(v_), precision<rocsparse_float_complex>());
+    }
+
+    static void append_value(std::string& s_, const rocsparse_double_complex& v_)
+    {
+        append_scientific(s_, std::real(v_), precision<rocsparse_double_complex>());
+        s_ += ' ';
+        append_scientific(s_, std::imag(v_), precision<rocsparse_double_complex>());
+    }
+
+    //
+    // Append the raw bytes of an array.
+    //
+    template <typename T>
+    static void append_bytes(std::string& s_, const T* __restrict__ x_, size_t nmemb_)
+    {
+        s_.append((const char*)x_, sizeof(T) * nmemb_);
+    }
+};
+
+#endif // ROCSPARSE_EXPORTER_CHUNKED_HPP
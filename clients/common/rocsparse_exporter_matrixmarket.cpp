@@ -23,6 +23,10 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_exporter_chunked.hpp"
+
+#include <sstream>
+
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -45,6 +49,17 @@ rocsparse_exporter_matrixmarket::rocsparse_exporter_matrixmarket(const std::stri
     }
 }
 
+template <typename T>
+static void rocsparse_exporter_matrixmarket_header(std::ostream& out, const char* layout)
+{
+    out << "%%MatrixMarket matrix " << layout << " ";
+    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
+        out << "complex";
+    else
+        out << "real";
+    out << " general" << std::endl;
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_csx(rocsparse_direction dir_,
                                                                    J                   m_,
@@ -55,81 +70,57 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_csx(rocsparse_dir
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_invalid_value;
     }
 
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
-    switch(dir_)
-    {
-    case rocsparse_direction_row:
-    {
-        for(J i = 0; i < m_; ++i)
-        {
-            for(I at = ptr_[i] - base_; at < ptr_[i + 1] - base_; ++at)
-            {
-                J j = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                {
-                    out << " " << std::real(x) << " " << std::imag(x);
-                }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-    case rocsparse_direction_column:
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        for(J j = 0; j < n_; ++j)
-        {
-            for(I at = ptr_[j] - base_; at < ptr_[j + 1] - base_; ++at)
-            {
-                J i = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                {
-                    out << " " << std::real(x) << " " << std::imag(x);
-                }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
+        return rocsparse_status_internal_error;
     }
-    return rocsparse_status_invalid_value;
+
+    std::ostringstream header;
+    rocsparse_exporter_matrixmarket_header<T>(header, "coordinate");
+    header << m_ << " " << n_ << " " << nnz_ << std::endl;
+
+    //
+    // Chunks of entries, each line is made of the row index, the column index and the value.
+    //
+    const bool    is_row = (dir_ == rocsparse_direction_row);
+    const J       L      = is_row ? m_ : n_;
+    const I       begin  = ptr_[0] - base_;
+    const I       end    = ptr_[L] - base_;
+    const int64_t chunk  = rocsparse_exporter_chunked::s_chunk_nmemb;
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(
+              rocsparse_exporter_chunked::nchunks(int64_t(end) - begin),
+              [&](int64_t c, std::string& s) {
+                  const I chunk_begin = I(begin + c * chunk);
+                  const I chunk_end   = I(std::min(int64_t(end), begin + (c + 1) * chunk));
+                  J       i = rocsparse_exporter_chunked::find_row(L, ptr_, chunk_begin, base_);
+                  for(I at = chunk_begin; at < chunk_end; ++at)
+                  {
+                      while(ptr_[i + 1] - base_ <= at)
+                      {
+                          ++i;
+                      }
+                      const J j = ind_[at] - base_;
+                      rocsparse_exporter_chunked::append_integer(s, (is_row ? i : j) + 1);
+                      s += ' ';
+                      rocsparse_exporter_chunked::append_integer(s, (is_row ? j : i) + 1);
+                      s += ' ';
+                      rocsparse_exporter_chunked::append_value(s, val_[at]);
+                      s += '\n';
+                  }
+                  return true;
+              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I, typename J>
@@ -145,274 +136,156 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_gebsx(rocsparse_d
                                                                      const T* __restrict__ val_,
                                                                      rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
+    if((dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
+       || (dirb_ != rocsparse_direction_row && dirb_ != rocsparse_direction_column))
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_invalid_value;
     }
 
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << mb_ * block_dim_row_ << " " << nb_ * block_dim_column_ << " "
-        << nnzb_ * block_dim_row_ * block_dim_column_ << std::endl;
-    switch(dir_)
-    {
-    case rocsparse_direction_row:
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        for(J ib = 0; ib < mb_; ++ib)
-        {
-            I i = ib * block_dim_row_;
-            for(I at = ptr_[ib] - base_; at < ptr_[ib + 1] - base_; ++at)
-            {
-                J j = (ind_[at] - base_) * block_dim_column_;
-                switch(dirb_)
-                {
-                case rocsparse_direction_row:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_column_ * k + l];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-                case rocsparse_direction_column:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_row_ * l + k];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-                }
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
+        return rocsparse_status_internal_error;
     }
 
-    case rocsparse_direction_column:
-    {
-        for(J jb = 0; jb < nb_; ++jb)
-        {
-            I j = jb * block_dim_column_;
-            for(I at = ptr_[jb] - base_; at < ptr_[jb + 1] - base_; ++at)
-            {
-                J i = (ind_[at] - base_) * block_dim_row_;
-                switch(dirb_)
-                {
-
-                case rocsparse_direction_row:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_column_ * k + l];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-
-                case rocsparse_direction_column:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_row_ * l + k];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-                }
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-    }
-    return rocsparse_status_invalid_value;
+    std::ostringstream header;
+    rocsparse_exporter_matrixmarket_header<T>(header, "coordinate");
+    header << mb_ * block_dim_row_ << " " << nb_ * block_dim_column_ << " "
+           << nnzb_ * block_dim_row_ * block_dim_column_ << std::endl;
+
+    //
+    // Chunks of blocks, the indices of the entries are written zero-based.
+    //
+    const bool    is_row     = (dir_ == rocsparse_direction_row);
+    const bool    is_row_blk = (dirb_ == rocsparse_direction_row);
+    const J       L          = is_row ? mb_ : nb_;
+    const I       begin      = ptr_[0] - base_;
+    const I       end        = ptr_[L] - base_;
+    const int64_t block_size = int64_t(block_dim_row_) * block_dim_column_;
+    const int64_t chunk
+        = std::max(rocsparse_exporter_chunked::s_chunk_nmemb / std::max(block_size, int64_t(1)),
+                   int64_t(1));
 
-    std::cerr << "rocsparse_exporter_matrixmarket, gebsx not supported." << std::endl;
-    return rocsparse_status_not_implemented;
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(
+              rocsparse_exporter_chunked::nchunks(int64_t(end) - begin, chunk),
+              [&](int64_t c, std::string& s) {
+                  const I chunk_begin = I(begin + c * chunk);
+                  const I chunk_end   = I(std::min(int64_t(end), begin + (c + 1) * chunk));
+                  J       ib = rocsparse_exporter_chunked::find_row(L, ptr_, chunk_begin, base_);
+                  for(I at = chunk_begin; at < chunk_end; ++at)
+                  {
+                      while(ptr_[ib + 1] - base_ <= at)
+                      {
+                          ++ib;
+                      }
+                      const J jb = ind_[at] - base_;
+                      const I i  = I(is_row ? ib : jb) * block_dim_row_;
+                      const I j  = I(is_row ? jb : ib) * block_dim_column_;
+                      for(J k = 0; k < block_dim_row_; ++k)
+                      {
+                          for(J l = 0; l < block_dim_column_; ++l)
+                          {
+                              const T v = val_[at * block_size
+                                               + (is_row_blk ? block_dim_column_ * k + l
+                                                             : block_dim_row_ * l + k)];
+                              rocsparse_exporter_chunked::append_integer(s, i + k);
+                              s += ' ';
+                              rocsparse_exporter_chunked::append_integer(s, j + l);
+                              s += ' ';
+                              rocsparse_exporter_chunked::append_value(s, v);
+                              s += '\n';
+                          }
+                      }
+                  }
+                  return true;
+              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I>
 rocsparse_status
     rocsparse_exporter_matrixmarket::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
 {
-    std::ofstream out(this->m_filename);
+    rocsparse_exporter_chunked out(this->m_filename, false);
     if(!out.is_open())
     {
         return rocsparse_status_internal_error;
     }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
-    }
 
-    out << "%%MatrixMarket matrix array ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << nmemb_ << " 1" << std::endl;
-    for(I i = 0; i < nmemb_; ++i)
-    {
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << std::real(x_[i * incx_]) << " " << std::imag(x_[i * incx_]) << std::endl;
-        }
-        else
-        {
-            out << x_[i * incx_] << std::endl;
-        }
-    }
-    out.close();
-    return rocsparse_status_success;
+    std::ostringstream header;
+    rocsparse_exporter_matrixmarket_header<T>(header, "array");
+    header << nmemb_ << " 1" << std::endl;
+
+    const int64_t chunk = rocsparse_exporter_chunked::s_chunk_nmemb;
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(nmemb_),
+                              [&](int64_t c, std::string& s) {
+                                  const I end = I(std::min(int64_t(nmemb_), (c + 1) * chunk));
+                                  for(I i = I(c * chunk); i < end; ++i)
+                                  {
+                                      rocsparse_exporter_chunked::append_value(s, x_[i * incx_]);
+                                      s += '\n';
+                                  }
+                                  return true;
+                              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I>
 rocsparse_status rocsparse_exporter_matrixmarket::write_dense_matrix(
     rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    if(order_ != rocsparse_order_row && order_ != rocsparse_order_column)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_invalid_value;
     }
 
-    out << "%%MatrixMarket matrix array ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << std::endl;
-    switch(order_)
-    {
-    case rocsparse_order_row:
-    {
-        for(I i = 0; i < m_; ++i)
-        {
-            for(I j = 0; j < n_; ++j)
-            {
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                    out << " " << std::real(x_[i * ld_ + j]) << " " << std::imag(x_[i * ld_ + j]);
-                else
-                    out << " " << x_[i * ld_ + j];
-            }
-            out << std::endl;
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-    case rocsparse_order_column:
+    rocsparse_exporter_chunked out(this->m_filename, false);
+    if(!out.is_open())
     {
-        for(I i = 0; i < m_; ++i)
-        {
-            for(I j = 0; j < n_; ++j)
-            {
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                    out << " " << std::real(x_[j * ld_ + i]) << " " << std::imag(x_[j * ld_ + i]);
-                else
-                    out << " " << x_[j * ld_ + i];
-            }
-            out << std::endl;
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
+        return rocsparse_status_internal_error;
     }
-    return rocsparse_status_invalid_value;
+
+    std::ostringstream header;
+    rocsparse_exporter_matrixmarket_header<T>(header, "array");
+    header << m_ << " " << n_ << std::endl;
+
+    //
+    // Chunks of rows, each row is written on its own line.
+    //
+    const bool    is_row = (order_ == rocsparse_order_row);
+    const int64_t chunk
+        = std::max(rocsparse_exporter_chunked::s_chunk_nmemb / std::max(int64_t(n_), int64_t(1)),
+                   int64_t(1));
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(m_, chunk),
+                              [&](int64_t c, std::string& s) {
+                                  const I end = I(std::min(int64_t(m_), (c + 1) * chunk));
+                                  for(I i = I(c * chunk); i < end; ++i)
+                                  {
+                                      for(I j = 0; j < n_; ++j)
+                                      {
+                                          s += ' ';
+                                          rocsparse_exporter_chunked::append_value(
+                                              s, is_row ? x_[i * ld_ + j] : x_[j * ld_ + i]);
+                                      }
+                                      s += '\n';
+                                  }
+                                  return true;
+                              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I>
@@ -424,48 +297,39 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_coo(I m_,
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
+    rocsparse_exporter_chunked out(this->m_filename, false);
     if(!out.is_open())
     {
         return rocsparse_status_internal_error;
     }
 
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
-    }
-
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
+    std::ostringstream header;
+    rocsparse_exporter_matrixmarket_header<T>(header, "coordinate");
+    header << m_ << " " << n_ << " " << nnz_ << std::endl;
 
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
+    const int64_t chunk = rocsparse_exporter_chunked::s_chunk_nmemb;
 
-    for(I i = 0; i < nnz_; ++i)
-    {
-        out << ((row_ind_[i] - base_) + 1) << " " << ((col_ind_[i] - base_) + 1);
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << " " << std::real(val_[i]) << " " << std::imag(val_[i]) << std::endl;
-        }
-        else
-        {
-            out << " " << val_[i] << std::endl;
-        }
-    }
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(nnz_),
+                              [&](int64_t c, std::string& s) {
+                                  const I end = I(std::min(int64_t(nnz_), (c + 1) * chunk));
+                                  for(I i = I(c * chunk); i < end; ++i)
+                                  {
+                                      rocsparse_exporter_chunked::append_integer(
+                                          s, (row_ind_[i] - base_) + 1);
+                                      s += ' ';
+                                      rocsparse_exporter_chunked::append_integer(
+                                          s, (col_ind_[i] - base_) + 1);
+                                      s += ' ';
+                                      rocsparse_exporter_chunked::append_value(s, val_[i]);
+                                      s += '\n';
+                                  }
+                                  return true;
+                              })
+          && out.close();
 
-    out.close();
-    return rocsparse_status_success;
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 #define INSTANTIATE_TIJ(T, I, J)                                                   \
@@ -23,6 +23,10 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_rocalution.hpp"
+#include "rocsparse_exporter_chunked.hpp"
+
+#include <sstream>
+
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -46,36 +50,6 @@ rocsparse_exporter_rocalution::rocsparse_exporter_rocalution(const std::string&
     }
 }
 
-template <typename T>
-rocsparse_status rocalution_write_sparse_csx(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const T* val)
-{
-    std::ofstream out(filename, std::ios::out | std::ios::binary);
-
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-
-    // Header
-    out << "#rocALUTION binary csr file" << std::endl;
-
-    // rocALUTION version
-    int version = 10602;
-    out.write((char*)&version, sizeof(int));
-
-    // Data
-    out.write((char*)&m, sizeof(int));
-    out.write((char*)&n, sizeof(int));
-    out.write((char*)&nnz, sizeof(int));
-    out.write((char*)ptr, (m + 1) * sizeof(int));
-    out.write((char*)col, nnz * sizeof(int));
-    out.write((char*)val, nnz * sizeof(T));
-    out.close();
-
-    return rocsparse_status_success;
-}
-
 template <typename T>
 void convert_array(int nnz, const void* data, void* mem)
 {
@@ -104,6 +78,29 @@ void convert_array<float>(int nnz, const void* data, void* mem)
     }
 }
 
+//
+// Convert the chunk c of an array of offsets or indices to zero-based int.
+//
+template <typename I>
+static bool rocalution_convert_indices(
+    int64_t c, std::string& s, int64_t nmemb, const I* __restrict__ x, rocsparse_index_base base)
+{
+    const int64_t chunk = rocsparse_exporter_chunked::s_chunk_nmemb;
+    const int64_t begin = c * chunk;
+    const int64_t end   = std::min(nmemb, begin + chunk);
+    s.resize(sizeof(int) * (end - begin));
+    int* p = (int*)&s[0];
+    for(int64_t i = begin; i < end; ++i)
+    {
+        if(rocsparse_type_conversion(x[i], p[i - begin]) != rocsparse_status_success)
+        {
+            return false;
+        }
+        p[i - begin] -= base;
+    }
+    return true;
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_exporter_rocalution::write_sparse_csx(rocsparse_direction dir_,
                                                                  J                   m_,
@@ -142,119 +139,57 @@ rocsparse_status rocsparse_exporter_rocalution::write_sparse_csx(rocsparse_direc
         return status;
     }
 
-    const int*    ptr = nullptr;
-    const int*    ind = nullptr;
-    const double* val = nullptr;
-
-    int*                  ptr_mem  = nullptr;
-    int*                  ind_mem  = nullptr;
-    double*               val_mem  = nullptr;
-    static constexpr bool ptr_same = std::is_same<I, int>();
-    static constexpr bool ind_same = std::is_same<J, int>();
-    static constexpr bool val_same
-        = std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>();
-
-    bool is_T_complex = (std::is_same<T, rocsparse_double_complex>()
-                         || std::is_same<T, rocsparse_float_complex>());
-
-    ptr_mem = nullptr;
-    if(!ptr_same && (base_ != rocsparse_index_base_zero))
-    {
-        rocsparse_hipHostMalloc(&ptr_mem, sizeof(int) * (m + 1));
-    }
-
-    ind_mem = nullptr;
-    if(!ind_same && (base_ != rocsparse_index_base_zero))
-    {
-        rocsparse_hipHostMalloc(&ind_mem, sizeof(int) * nnz);
-    }
-
-    val_mem = nullptr;
-    if(!val_same)
-    {
-        rocsparse_hipHostMalloc(&val_mem, sizeof(double) * (is_T_complex ? (2 * nnz) : nnz));
-    }
-
-    ptr = (ptr_same || (base_ == rocsparse_index_base_zero)) ? ((const int*)ptr_) : ptr_mem;
-    ind = (ind_same || (base_ == rocsparse_index_base_zero)) ? ((const int*)ind_) : ind_mem;
-    val = (val_same) ? ((const double*)val_) : val_mem;
-
-    if(ptr_mem != nullptr)
-    {
-        for(int i = 0; i < m + 1; ++i)
-        {
-            status = rocsparse_type_conversion(ptr_[i], ptr_mem[i]);
-            if(status != rocsparse_status_success)
-            {
-                break;
-            }
-        }
-
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < m + 1; ++i)
-            {
-                ptr_mem[i] = ptr_mem[i] - 1;
-            }
-        }
-
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-    }
-
-    if(ind_mem != nullptr)
-    {
-        for(int i = 0; i < nnz; ++i)
-        {
-            status = rocsparse_type_conversion(ind_[i], ind_mem[i]);
-            if(status != rocsparse_status_success)
-            {
-                break;
-            }
-        }
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < nnz; ++i)
-            {
-                ind_mem[i] = ind_mem[i] - 1;
-            }
-        }
-    }
-
-    if(val_mem != nullptr)
-    {
-        convert_array<T>(nnz, (const void*)val_, (void*)val_mem);
-    }
-
-    if(status != rocsparse_status_success)
+    rocsparse_exporter_chunked out(this->m_filename, true);
+    if(!out.is_open())
     {
-        return status;
+        return rocsparse_status_internal_error;
     }
 
-    status = rocalution_write_sparse_csx(this->m_filename.c_str(), m, n, nnz, ptr, ind, val);
-    if(val_mem != nullptr)
-    {
-        rocsparse_hipFree(val_mem);
-        val_mem = nullptr;
-    }
-    if(ind_mem != nullptr)
-    {
-        rocsparse_hipFree(ind_mem);
-        ind_mem = nullptr;
-    }
-    if(ptr_mem != nullptr)
-    {
-        rocsparse_hipFree(ptr_mem);
-        ptr_mem = nullptr;
-    }
+    // Header
+    std::ostringstream header;
+    header << "#rocALUTION binary csr file" << std::endl;
 
-    return status;
+    // rocALUTION version
+    int version = 10602;
+    header.write((char*)&version, sizeof(int));
+
+    // Sizes
+    header.write((char*)&m, sizeof(int));
+    header.write((char*)&n, sizeof(int));
+    header.write((char*)&nnz, sizeof(int));
+
+    //
+    // The arrays are converted to zero-based int and double precision values by chunks,
+    // without copies of the whole arrays.
+    //
+    static constexpr bool is_T_complex = (std::is_same<T, rocsparse_double_complex>()
+                                          || std::is_same<T, rocsparse_float_complex>());
+    using value_t = typename std::conditional<is_T_complex, rocsparse_double_complex, double>::type;
+
+    const int64_t chunk = rocsparse_exporter_chunked::s_chunk_nmemb;
+
+    const bool success
+        = out.write(header.str())
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(int64_t(m) + 1),
+                              [&](int64_t c, std::string& s) {
+                                  return rocalution_convert_indices(
+                                      c, s, int64_t(m) + 1, ptr_, base_);
+                              })
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(nnz),
+                              [&](int64_t c, std::string& s) {
+                                  return rocalution_convert_indices(c, s, nnz, ind_, base_);
+                              })
+          && out.write_chunks(rocsparse_exporter_chunked::nchunks(nnz),
+                              [&](int64_t c, std::string& s) {
+                                  const int64_t begin = c * chunk;
+                                  const int64_t end   = std::min(int64_t(nnz), begin + chunk);
+                                  s.resize(sizeof(value_t) * (end - begin));
+                                  convert_array<T>(int(end - begin), val_ + begin, &s[0]);
+                                  return true;
+                              })
+          && out.close();
+
+    return success ? rocsparse_status_success : rocsparse_status_internal_error;
 }
 
 template <typename T, typename I, typename J>
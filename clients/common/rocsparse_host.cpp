@@ -25,6 +25,11 @@
 
 #include <limits>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ROCSPARSE_HOST_X86_SIMD
+#include <immintrin.h>
+#endif
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -129,222 +134,471 @@ void host_sctr(I nnz, const T* x_val, const I* x_ind, T* y, rocsparse_index_base
  *    level 2 SPARSE
  * ===========================================================================
  */
-template <typename T, typename I, typename J, typename A, typename X, typename Y>
-void host_bsrmv(rocsparse_direction  dir,
-                rocsparse_operation  trans,
-                J                    mb,
-                J                    nb,
-                I                    nnzb,
-                T                    alpha,
-                const I*             bsr_row_ptr,
-                const I*             bsr_end_ptr,
-                const J*             bsr_col_ind,
-                const A*             bsr_val,
-                J                    bsr_dim,
-                const X*             x,
-                T                    beta,
-                Y*                   y,
-                rocsparse_index_base base)
+// Reduces the partial sums of the WFSIZE lanes of a (simulated) wavefront into sum[0], in the
+// same order as the device kernels.
+template <typename T>
+static inline void host_bsrmv_lane_reduce(T* sum, uint32_t WFSIZE)
 {
-    // Quick return
-    if(alpha == static_cast<T>(0))
+    for(uint32_t j = 1; j < WFSIZE; j <<= 1)
     {
-        if(beta != static_cast<T>(1))
+        for(uint32_t k = 0; k < WFSIZE - j; ++k)
         {
-            for(J i = 0; i < mb * bsr_dim; ++i)
-            {
-                y[i] *= beta;
-            }
+            sum[k] += sum[k + j];
         }
-
-        return;
     }
+}
 
-    uint32_t WFSIZE;
-
-    if(bsr_dim == 2)
-    {
-        I blocks_per_row = (mb != 0) ? (nnzb / mb) : 0;
-
-        if(blocks_per_row < 8)
-        {
-            WFSIZE = 4;
-        }
-        else if(blocks_per_row < 16)
-        {
-            WFSIZE = 8;
-        }
-        else if(blocks_per_row < 32)
-        {
-            WFSIZE = 16;
-        }
-        else if(blocks_per_row < 64)
-        {
-            WFSIZE = 32;
-        }
-        else
-        {
-            WFSIZE = 64;
-        }
-    }
-    else if(bsr_dim <= 8)
-    {
-        WFSIZE = 8;
-    }
-    else if(bsr_dim <= 16)
+template <typename T, typename Y>
+static inline void host_bsrmv_update(T alpha, T sum, T beta, Y& y)
+{
+    if(beta != static_cast<T>(0))
     {
-        WFSIZE = 16;
+        y = std::fma(static_cast<T>(beta), static_cast<T>(y), static_cast<T>(alpha * sum));
     }
     else
     {
-        WFSIZE = 32;
+        y = alpha * sum;
     }
+}
+
+// Computes y = alpha * A * x + beta * y for the block rows of A that are listed in mask, or for
+// all size block rows of A if mask is nullptr. Each lane of the wavefront processes whole
+// blocks, such that WFSIZE consecutive blocks of a block row are processed at once. The row
+// block dimension RBD is known at compile time, the column block dimension CBD is taken from
+// col_block_dim if it is 0.
+template <rocsparse_int       RBD,
+          rocsparse_int       CBD,
+          rocsparse_direction DIR,
+          typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y>
+static void host_bsrmv_block_lanes(J                    size,
+                                   const J*             mask,
+                                   T                    alpha,
+                                   const I*             bsr_row_ptr,
+                                   const I*             bsr_end_ptr,
+                                   const J*             bsr_col_ind,
+                                   const A*             bsr_val,
+                                   J                    row_block_dim,
+                                   J                    col_block_dim,
+                                   const X*             x,
+                                   T                    beta,
+                                   Y*                   y,
+                                   uint32_t             WFSIZE,
+                                   rocsparse_index_base base)
+{
+    const J       cbd        = (CBD > 0) ? CBD : col_block_dim;
+    const int64_t block_size = static_cast<int64_t>(RBD) * cbd;
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(J row = 0; row < mb; ++row)
+    for(J idx = 0; idx < size; ++idx)
     {
+        J row       = (mask != nullptr) ? mask[idx] - base : idx;
         I row_begin = bsr_row_ptr[row] - base;
         I row_end   = bsr_end_ptr[row] - base;
 
-        if(bsr_dim == 2)
+        T sum[RBD][64];
+
+        for(rocsparse_int r = 0; r < RBD; ++r)
+        {
+            for(uint32_t k = 0; k < WFSIZE; ++k)
+            {
+                sum[r][k] = static_cast<T>(0);
+            }
+        }
+
+        for(I j = row_begin; j < row_end; j += WFSIZE)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
+            const I kend = std::min(static_cast<I>(WFSIZE), row_end - j);
 
-            for(I j = row_begin; j < row_end; j += WFSIZE)
+            for(I k = 0; k < kend; ++k)
             {
-                for(uint32_t k = 0; k < WFSIZE; ++k)
+                const A* val = bsr_val + block_size * (j + k);
+                const X* xb  = x + static_cast<int64_t>(cbd) * (bsr_col_ind[j + k] - base);
+
+                for(J l = 0; l < cbd; ++l)
                 {
-                    if(j + k < row_end)
+                    for(rocsparse_int r = 0; r < RBD; ++r)
                     {
-                        J col = bsr_col_ind[j + k] - base;
+                        A v = (DIR == rocsparse_direction_column) ? val[RBD * l + r]
+                                                                  : val[cbd * r + l];
 
-                        if(dir == rocsparse_direction_column)
-                        {
-                            sum0[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 0]),
-                                           static_cast<T>(x[col * bsr_dim + 0]),
-                                           static_cast<T>(sum0[k]));
-                            sum1[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 1]),
-                                           static_cast<T>(x[col * bsr_dim + 0]),
-                                           static_cast<T>(sum1[k]));
-                            sum0[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 2]),
-                                           static_cast<T>(x[col * bsr_dim + 1]),
-                                           static_cast<T>(sum0[k]));
-                            sum1[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 3]),
-                                           static_cast<T>(x[col * bsr_dim + 1]),
-                                           static_cast<T>(sum1[k]));
-                        }
-                        else
-                        {
-                            sum0[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 0]),
-                                           static_cast<T>(x[col * bsr_dim + 0]),
-                                           static_cast<T>(sum0[k]));
-                            sum0[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 1]),
-                                           static_cast<T>(x[col * bsr_dim + 1]),
-                                           static_cast<T>(sum0[k]));
-                            sum1[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 2]),
-                                           static_cast<T>(x[col * bsr_dim + 0]),
-                                           static_cast<T>(sum1[k]));
-                            sum1[k]
-                                = std::fma(static_cast<T>(bsr_val[bsr_dim * bsr_dim * (j + k) + 3]),
-                                           static_cast<T>(x[col * bsr_dim + 1]),
-                                           static_cast<T>(sum1[k]));
-                        }
+                        sum[r][k] = std::fma(
+                            static_cast<T>(v), static_cast<T>(xb[l]), static_cast<T>(sum[r][k]));
                     }
                 }
             }
+        }
 
-            for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] += sum0[k + j];
-                    sum1[k] += sum1[k + j];
-                }
-            }
+        for(rocsparse_int r = 0; r < RBD; ++r)
+        {
+            host_bsrmv_lane_reduce(sum[r], WFSIZE);
+            host_bsrmv_update(alpha, sum[r][0], beta, y[static_cast<int64_t>(RBD) * row + r]);
+        }
+    }
+}
 
-            if(beta != static_cast<T>(0))
-            {
-                y[row * bsr_dim + 0] = std::fma(static_cast<T>(beta),
-                                                static_cast<T>(y[row * bsr_dim + 0]),
-                                                static_cast<T>(alpha * sum0[0]));
-                y[row * bsr_dim + 1] = std::fma(static_cast<T>(beta),
-                                                static_cast<T>(y[row * bsr_dim + 1]),
-                                                static_cast<T>(alpha * sum1[0]));
-            }
-            else
+// Computes y = alpha * A * x + beta * y for the block rows of A that are listed in mask, or for
+// all size block rows of A if mask is nullptr. The lanes of the wavefront process the columns of
+// each block, such that all blocks of a block row are processed one after another. The row block
+// dimension RBD is known at compile time, the column block dimension CBD is taken from
+// col_block_dim if it is 0.
+template <rocsparse_int       RBD,
+          rocsparse_int       CBD,
+          rocsparse_direction DIR,
+          typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y>
+static void host_bsrmv_column_lanes(J                    size,
+                                    const J*             mask,
+                                    T                    alpha,
+                                    const I*             bsr_row_ptr,
+                                    const I*             bsr_end_ptr,
+                                    const J*             bsr_col_ind,
+                                    const A*             bsr_val,
+                                    J                    row_block_dim,
+                                    J                    col_block_dim,
+                                    const X*             x,
+                                    T                    beta,
+                                    Y*                   y,
+                                    uint32_t             WFSIZE,
+                                    rocsparse_index_base base)
+{
+    static constexpr uint32_t WF = (RBD <= 8) ? 8 : 16;
+
+    const J       cbd        = (CBD > 0) ? CBD : col_block_dim;
+    const int64_t block_size = static_cast<int64_t>(RBD) * cbd;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J idx = 0; idx < size; ++idx)
+    {
+        J row       = (mask != nullptr) ? mask[idx] - base : idx;
+        I row_begin = bsr_row_ptr[row] - base;
+        I row_end   = bsr_end_ptr[row] - base;
+
+        T sum[RBD][WF];
+
+        for(rocsparse_int r = 0; r < RBD; ++r)
+        {
+            for(uint32_t k = 0; k < WF; ++k)
             {
-                y[row * bsr_dim + 0] = alpha * sum0[0];
-                y[row * bsr_dim + 1] = alpha * sum1[0];
+                sum[r][k] = static_cast<T>(0);
             }
         }
-        else
+
+        for(I j = row_begin; j < row_end; ++j)
         {
-            for(J bi = 0; bi < bsr_dim; ++bi)
+            const A* val = bsr_val + block_size * j;
+            const X* xb  = x + static_cast<int64_t>(cbd) * (bsr_col_ind[j] - base);
+
+            for(J bj = 0; bj < cbd; bj += WF)
             {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
+                const J kend = std::min(static_cast<J>(WF), cbd - bj);
 
-                for(I j = row_begin; j < row_end; ++j)
+                for(J k = 0; k < kend; ++k)
                 {
-                    J col = bsr_col_ind[j] - base;
-
-                    for(J bj = 0; bj < bsr_dim; bj += WFSIZE)
+                    for(rocsparse_int r = 0; r < RBD; ++r)
                     {
-                        for(uint32_t k = 0; k < WFSIZE; ++k)
-                        {
-                            if(bj + k < bsr_dim)
-                            {
-                                if(dir == rocsparse_direction_column)
-                                {
-                                    sum[k] = std::fma(
-                                        static_cast<T>(bsr_val[bsr_dim * bsr_dim * j
-                                                               + bsr_dim * (bj + k) + bi]),
-                                        static_cast<T>(x[bsr_dim * col + (bj + k)]),
-                                        static_cast<T>(sum[k]));
-                                }
-                                else
-                                {
-                                    sum[k] = std::fma(
-                                        static_cast<T>(bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bi
-                                                               + (bj + k)]),
-                                        static_cast<T>(x[bsr_dim * col + (bj + k)]),
-                                        static_cast<T>(sum[k]));
-                                }
-                            }
-                        }
+                        A v = (DIR == rocsparse_direction_column) ? val[RBD * (bj + k) + r]
+                                                                  : val[cbd * r + (bj + k)];
+
+                        sum[r][k] = std::fma(static_cast<T>(v),
+                                             static_cast<T>(xb[bj + k]),
+                                             static_cast<T>(sum[r][k]));
                     }
                 }
+            }
+        }
+
+        for(rocsparse_int r = 0; r < RBD; ++r)
+        {
+            host_bsrmv_lane_reduce(sum[r], WF);
+            host_bsrmv_update(alpha, sum[r][0], beta, y[static_cast<int64_t>(RBD) * row + r]);
+        }
+    }
+}
+
+// Generic fallback of the host BSR kernels above, for block dimensions that are only known at
+// run time.
+template <rocsparse_direction DIR,
+          typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y>
+static void host_bsrmv_general(J                    size,
+                               const J*             mask,
+                               T                    alpha,
+                               const I*             bsr_row_ptr,
+                               const I*             bsr_end_ptr,
+                               const J*             bsr_col_ind,
+                               const A*             bsr_val,
+                               J                    row_block_dim,
+                               J                    col_block_dim,
+                               const X*             x,
+                               T                    beta,
+                               Y*                   y,
+                               uint32_t             WFSIZE,
+                               rocsparse_index_base base)
+{
+    const int64_t block_size = static_cast<int64_t>(row_block_dim) * col_block_dim;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J idx = 0; idx < size; ++idx)
+    {
+        J row       = (mask != nullptr) ? mask[idx] - base : idx;
+        I row_begin = bsr_row_ptr[row] - base;
+        I row_end   = bsr_end_ptr[row] - base;
+
+        std::vector<T> sum(WFSIZE);
+
+        for(J bi = 0; bi < row_block_dim; ++bi)
+        {
+            std::fill(sum.begin(), sum.end(), static_cast<T>(0));
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                J col = bsr_col_ind[j] - base;
 
-                for(uint32_t j = 1; j < WFSIZE; j <<= 1)
+                for(J bj = 0; bj < col_block_dim; bj += WFSIZE)
                 {
-                    for(uint32_t k = 0; k < WFSIZE - j; ++k)
+                    const J kend = std::min(static_cast<J>(WFSIZE), col_block_dim - bj);
+
+                    for(J k = 0; k < kend; ++k)
                     {
-                        sum[k] += sum[k + j];
+                        A v = (DIR == rocsparse_direction_column)
+                                  ? bsr_val[block_size * j + row_block_dim * (bj + k) + bi]
+                                  : bsr_val[block_size * j + col_block_dim * bi + (bj + k)];
+
+                        sum[k] = std::fma(static_cast<T>(v),
+                                          static_cast<T>(x[col_block_dim * col + (bj + k)]),
+                                          static_cast<T>(sum[k]));
                     }
                 }
+            }
 
-                if(beta != static_cast<T>(0))
-                {
-                    y[row * bsr_dim + bi] = std::fma(static_cast<T>(beta),
-                                                     static_cast<T>(y[row * bsr_dim + bi]),
-                                                     static_cast<T>(alpha * sum[0]));
-                }
-                else
-                {
-                    y[row * bsr_dim + bi] = alpha * sum[0];
-                }
+            host_bsrmv_lane_reduce(sum.data(), WFSIZE);
+            host_bsrmv_update(
+                alpha, sum[0], beta, y[static_cast<int64_t>(row_block_dim) * row + bi]);
+        }
+    }
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+using host_bsrmv_kernel_t = void (*)(J,
+                                     const J*,
+                                     T,
+                                     const I*,
+                                     const I*,
+                                     const J*,
+                                     const A*,
+                                     J,
+                                     J,
+                                     const X*,
+                                     T,
+                                     Y*,
+                                     uint32_t,
+                                     rocsparse_index_base);
+
+// Size of the dispatch tables of the host BSR kernels, which are indexed by the (row) block
+// dimension. Block dimensions 2 to 8 and 16 have kernels that are specialized at compile time.
+static constexpr rocsparse_int host_bsr_kernel_table_size = 17;
+
+// Selects the host BSR kernel for square blocks of dimension bsr_dim
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+static host_bsrmv_kernel_t<T, I, J, A, X, Y> host_bsrmv_kernel(rocsparse_direction dir,
+                                                                J                   bsr_dim)
+{
+    static constexpr host_bsrmv_kernel_t<T, I, J, A, X, Y> table[2][host_bsr_kernel_table_size]
+        = {{host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_block_lanes<2, 2, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<3, 3, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<4, 4, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<5, 5, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<6, 6, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<7, 7, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<8, 8, rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_column_lanes<16, 16, rocsparse_direction_row>},
+           {host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_block_lanes<2, 2, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<3, 3, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<4, 4, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<5, 5, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<6, 6, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<7, 7, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<8, 8, rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_column_lanes<16, 16, rocsparse_direction_column>}};
+
+    const int d = (dir == rocsparse_direction_row) ? 0 : 1;
+
+    return (bsr_dim < host_bsr_kernel_table_size) ? table[d][bsr_dim] : table[d][0];
+}
+
+// Selects the host BSR kernel for general blocks with row block dimension row_block_dim
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+static host_bsrmv_kernel_t<T, I, J, A, X, Y> host_gebsrmv_kernel(rocsparse_direction dir,
+                                                                  J                   row_block_dim)
+{
+    static constexpr host_bsrmv_kernel_t<T, I, J, A, X, Y> table[2][host_bsr_kernel_table_size]
+        = {{host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_block_lanes<2, 0, rocsparse_direction_row>,
+            host_bsrmv_block_lanes<3, 0, rocsparse_direction_row>,
+            host_bsrmv_block_lanes<4, 0, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<5, 0, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<6, 0, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<7, 0, rocsparse_direction_row>,
+            host_bsrmv_column_lanes<8, 0, rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_general<rocsparse_direction_row>,
+            host_bsrmv_column_lanes<16, 0, rocsparse_direction_row>},
+           {host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_block_lanes<2, 0, rocsparse_direction_column>,
+            host_bsrmv_block_lanes<3, 0, rocsparse_direction_column>,
+            host_bsrmv_block_lanes<4, 0, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<5, 0, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<6, 0, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<7, 0, rocsparse_direction_column>,
+            host_bsrmv_column_lanes<8, 0, rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_general<rocsparse_direction_column>,
+            host_bsrmv_column_lanes<16, 0, rocsparse_direction_column>}};
+
+    const int d = (dir == rocsparse_direction_row) ? 0 : 1;
+
+    return (row_block_dim < host_bsr_kernel_table_size) ? table[d][row_block_dim] : table[d][0];
+}
+
+// Wavefront size that is used by the device BSR kernels
+template <typename I, typename J>
+static uint32_t host_bsrmv_wfsize(J mb, I nnzb, J row_block_dim, bool block_lanes)
+{
+    if(block_lanes)
+    {
+        I blocks_per_row = (mb != 0) ? (nnzb / mb) : 0;
+
+        if(blocks_per_row < 8)
+        {
+            return 4;
+        }
+        else if(blocks_per_row < 16)
+        {
+            return 8;
+        }
+        else if(blocks_per_row < 32)
+        {
+            return 16;
+        }
+        else if(blocks_per_row < 64)
+        {
+            return 32;
+        }
+        else
+        {
+            return 64;
+        }
+    }
+    else if(row_block_dim <= 8)
+    {
+        return 8;
+    }
+    else if(row_block_dim <= 16)
+    {
+        return 16;
+    }
+    else
+    {
+        return 32;
+    }
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_bsrmv(rocsparse_direction  dir,
+                rocsparse_operation  trans,
+                J                    mb,
+                J                    nb,
+                I                    nnzb,
+                T                    alpha,
+                const I*             bsr_row_ptr,
+                const I*             bsr_end_ptr,
+                const J*             bsr_col_ind,
+                const A*             bsr_val,
+                J                    bsr_dim,
+                const X*             x,
+                T                    beta,
+                Y*                   y,
+                rocsparse_index_base base)
+{
+    // Quick return
+    if(alpha == static_cast<T>(0))
+    {
+        if(beta != static_cast<T>(1))
+        {
+            for(J i = 0; i < mb * bsr_dim; ++i)
+            {
+                y[i] *= beta;
             }
         }
+
+        return;
     }
+
+    uint32_t WFSIZE = host_bsrmv_wfsize(mb, nnzb, bsr_dim, bsr_dim == 2);
+
+    host_bsrmv_kernel<T, I, J, A, X, Y>(dir, bsr_dim)(mb,
+                                                      nullptr,
+                                                      alpha,
+                                                      bsr_row_ptr,
+                                                      bsr_end_ptr,
+                                                      bsr_col_ind,
+                                                      bsr_val,
+                                                      bsr_dim,
+                                                      bsr_dim,
+                                                      x,
+                                                      beta,
+                                                      y,
+                                                      WFSIZE,
+                                                      base);
 }
 
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
@@ -436,204 +690,50 @@ void host_bsrxmv(rocsparse_direction  dir,
         return;
     }
 
-    rocsparse_int WFSIZE;
+    uint32_t WFSIZE = host_bsrmv_wfsize(mb, nnzb, bsr_dim, bsr_dim == 2);
+
+    host_bsrmv_kernel<T, rocsparse_int, rocsparse_int, T, T, T>(dir, bsr_dim)(size_of_mask,
+                                                                              bsr_mask_ptr,
+                                                                              alpha,
+                                                                              bsr_row_ptr,
+                                                                              bsr_end_ptr,
+                                                                              bsr_col_ind,
+                                                                              bsr_val,
+                                                                              bsr_dim,
+                                                                              bsr_dim,
+                                                                              x,
+                                                                              beta,
+                                                                              y,
+                                                                              WFSIZE,
+                                                                              base);
+}
 
-    if(bsr_dim == 2)
+template <typename T>
+void host_gebsrmv(rocsparse_direction  dir,
+                  rocsparse_operation  trans,
+                  rocsparse_int        mb,
+                  rocsparse_int        nb,
+                  rocsparse_int        nnzb,
+                  T                    alpha,
+                  const rocsparse_int* bsr_row_ptr,
+                  const rocsparse_int* bsr_col_ind,
+                  const T*             bsr_val,
+                  rocsparse_int        row_block_dim,
+                  rocsparse_int        col_block_dim,
+                  const T*             x,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base)
+{
+    // Quick return
+    if(alpha == static_cast<T>(0))
     {
-        rocsparse_int blocks_per_row = (mb != 0) ? (nnzb / mb) : 0;
-
-        if(blocks_per_row < 8)
-        {
-            WFSIZE = 4;
-        }
-        else if(blocks_per_row < 16)
-        {
-            WFSIZE = 8;
-        }
-        else if(blocks_per_row < 32)
-        {
-            WFSIZE = 16;
-        }
-        else if(blocks_per_row < 64)
-        {
-            WFSIZE = 32;
-        }
-        else
+        if(beta != static_cast<T>(1))
         {
-            WFSIZE = 64;
-        }
-    }
-    else if(bsr_dim <= 8)
-    {
-        WFSIZE = 8;
-    }
-    else if(bsr_dim <= 16)
-    {
-        WFSIZE = 16;
-    }
-    else
-    {
-        WFSIZE = 32;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int mask_idx = 0; mask_idx < size_of_mask; ++mask_idx)
-    {
-        rocsparse_int row       = bsr_mask_ptr[mask_idx] - base;
-        rocsparse_int row_begin = bsr_row_ptr[row] - base;
-        rocsparse_int row_end   = bsr_end_ptr[row] - base;
-
-        if(bsr_dim == 2)
-        {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
-
-                        if(dir == rocsparse_direction_column)
-                        {
-                            sum0[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                               x[col * bsr_dim + 0],
-                                               sum0[k]);
-                            sum1[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                               x[col * bsr_dim + 0],
-                                               sum1[k]);
-                            sum0[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                               x[col * bsr_dim + 1],
-                                               sum0[k]);
-                            sum1[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                               x[col * bsr_dim + 1],
-                                               sum1[k]);
-                        }
-                        else
-                        {
-                            sum0[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                               x[col * bsr_dim + 0],
-                                               sum0[k]);
-                            sum0[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                               x[col * bsr_dim + 1],
-                                               sum0[k]);
-                            sum1[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                               x[col * bsr_dim + 0],
-                                               sum1[k]);
-                            sum1[k] = std::fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                               x[col * bsr_dim + 1],
-                                               sum1[k]);
-                        }
-                    }
-                }
-            }
-
-            for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] += sum0[k + j];
-                    sum1[k] += sum1[k + j];
-                }
-            }
-
-            if(beta != static_cast<T>(0))
-            {
-                y[row * bsr_dim + 0] = std::fma(beta, y[row * bsr_dim + 0], alpha * sum0[0]);
-                y[row * bsr_dim + 1] = std::fma(beta, y[row * bsr_dim + 1], alpha * sum1[0]);
-            }
-            else
-            {
-                y[row * bsr_dim + 0] = alpha * sum0[0];
-                y[row * bsr_dim + 1] = alpha * sum1[0];
-            }
-        }
-        else
-        {
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
-            {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
-
-                for(rocsparse_int j = row_begin; j < row_end; ++j)
-                {
-                    rocsparse_int col = bsr_col_ind[j] - base;
-
-                    for(rocsparse_int bj = 0; bj < bsr_dim; bj += WFSIZE)
-                    {
-                        for(uint32_t k = 0; k < WFSIZE; ++k)
-                        {
-                            if(bj + k < bsr_dim)
-                            {
-                                if(dir == rocsparse_direction_column)
-                                {
-                                    sum[k] = std::fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * (bj + k) + bi],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                                else
-                                {
-                                    sum[k] = std::fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bi + (bj + k)],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-                {
-                    for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                    {
-                        sum[k] += sum[k + j];
-                    }
-                }
-
-                if(beta != static_cast<T>(0))
-                {
-                    y[row * bsr_dim + bi] = std::fma(beta, y[row * bsr_dim + bi], alpha * sum[0]);
-                }
-                else
-                {
-                    y[row * bsr_dim + bi] = alpha * sum[0];
-                }
-            }
-        }
-    }
-}
-
-template <typename T>
-void host_gebsrmv(rocsparse_direction  dir,
-                  rocsparse_operation  trans,
-                  rocsparse_int        mb,
-                  rocsparse_int        nb,
-                  rocsparse_int        nnzb,
-                  T                    alpha,
-                  const rocsparse_int* bsr_row_ptr,
-                  const rocsparse_int* bsr_col_ind,
-                  const T*             bsr_val,
-                  rocsparse_int        row_block_dim,
-                  rocsparse_int        col_block_dim,
-                  const T*             x,
-                  T                    beta,
-                  T*                   y,
-                  rocsparse_index_base base)
-{
-    // Quick return
-    if(alpha == static_cast<T>(0))
-    {
-        if(beta != static_cast<T>(1))
-        {
-            for(rocsparse_int i = 0; i < mb * row_block_dim; ++i)
-            {
-                y[i] *= beta;
-            }
+            for(rocsparse_int i = 0; i < mb * row_block_dim; ++i)
+            {
+                y[i] *= beta;
+            }
         }
 
         return;
@@ -659,340 +759,24 @@ void host_gebsrmv(rocsparse_direction  dir,
         return;
     }
 
-    rocsparse_int WFSIZE;
-
-    if(row_block_dim == 2 || row_block_dim == 3 || row_block_dim == 4)
-    {
-        rocsparse_int blocks_per_row = (mb != 0) ? (nnzb / mb) : 0;
-
-        if(blocks_per_row < 8)
-        {
-            WFSIZE = 4;
-        }
-        else if(blocks_per_row < 16)
-        {
-            WFSIZE = 8;
-        }
-        else if(blocks_per_row < 32)
-        {
-            WFSIZE = 16;
-        }
-        else if(blocks_per_row < 64)
-        {
-            WFSIZE = 32;
-        }
-        else
-        {
-            WFSIZE = 64;
-        }
-    }
-    else if(row_block_dim <= 8)
-    {
-        WFSIZE = 8;
-    }
-    else if(row_block_dim <= 16)
-    {
-        WFSIZE = 16;
-    }
-    else
-    {
-        WFSIZE = 32;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int row = 0; row < mb; ++row)
-    {
-        rocsparse_int row_begin = bsr_row_ptr[row] - base;
-        rocsparse_int row_end   = bsr_row_ptr[row + 1] - base;
-
-        if(row_block_dim == 2)
-        {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
-
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
-                        {
-                            if(dir == rocsparse_direction_column)
-                            {
-                                sum0[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l],
-                                                   x[col * col_block_dim + l],
-                                                   sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 1],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                            }
-                            else
-                            {
-                                sum0[k]
-                                    = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k) + l],
-                                               x[col * col_block_dim + l],
-                                               sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] += sum0[k + j];
-                    sum1[k] += sum1[k + j];
-                }
-            }
-
-            if(beta != static_cast<T>(0))
-            {
-                y[row * row_block_dim + 0]
-                    = std::fma(beta, y[row * row_block_dim + 0], alpha * sum0[0]);
-                y[row * row_block_dim + 1]
-                    = std::fma(beta, y[row * row_block_dim + 1], alpha * sum1[0]);
-            }
-            else
-            {
-                y[row * row_block_dim + 0] = alpha * sum0[0];
-                y[row * row_block_dim + 1] = alpha * sum1[0];
-            }
-        }
-        else if(row_block_dim == 3)
-        {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum2(WFSIZE, static_cast<T>(0));
-
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
-
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
-                        {
-                            if(dir == rocsparse_direction_column)
-                            {
-                                sum0[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l],
-                                                   x[col * col_block_dim + l],
-                                                   sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 1],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                                sum2[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 2],
-                                                   x[col * col_block_dim + l],
-                                                   sum2[k]);
-                            }
-                            else
-                            {
-                                sum0[k]
-                                    = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k) + l],
-                                               x[col * col_block_dim + l],
-                                               sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                                sum2[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + 2 * col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum2[k]);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] += sum0[k + j];
-                    sum1[k] += sum1[k + j];
-                    sum2[k] += sum2[k + j];
-                }
-            }
-
-            if(beta != static_cast<T>(0))
-            {
-                y[row * row_block_dim + 0]
-                    = std::fma(beta, y[row * row_block_dim + 0], alpha * sum0[0]);
-                y[row * row_block_dim + 1]
-                    = std::fma(beta, y[row * row_block_dim + 1], alpha * sum1[0]);
-                y[row * row_block_dim + 2]
-                    = std::fma(beta, y[row * row_block_dim + 2], alpha * sum2[0]);
-            }
-            else
-            {
-                y[row * row_block_dim + 0] = alpha * sum0[0];
-                y[row * row_block_dim + 1] = alpha * sum1[0];
-                y[row * row_block_dim + 2] = alpha * sum2[0];
-            }
-        }
-        else if(row_block_dim == 4)
-        {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum2(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum3(WFSIZE, static_cast<T>(0));
-
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
-
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
-                        {
-                            if(dir == rocsparse_direction_column)
-                            {
-                                sum0[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l],
-                                                   x[col * col_block_dim + l],
-                                                   sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 1],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                                sum2[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 2],
-                                                   x[col * col_block_dim + l],
-                                                   sum2[k]);
-                                sum3[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + row_block_dim * l + 3],
-                                                   x[col * col_block_dim + l],
-                                                   sum3[k]);
-                            }
-                            else
-                            {
-                                sum0[k]
-                                    = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k) + l],
-                                               x[col * col_block_dim + l],
-                                               sum0[k]);
-                                sum1[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum1[k]);
-                                sum2[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + 2 * col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum2[k]);
-                                sum3[k] = std::fma(bsr_val[row_block_dim * col_block_dim * (j + k)
-                                                           + 3 * col_block_dim + l],
-                                                   x[col * col_block_dim + l],
-                                                   sum3[k]);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] += sum0[k + j];
-                    sum1[k] += sum1[k + j];
-                    sum2[k] += sum2[k + j];
-                    sum3[k] += sum3[k + j];
-                }
-            }
-
-            if(beta != static_cast<T>(0))
-            {
-                y[row * row_block_dim + 0]
-                    = std::fma(beta, y[row * row_block_dim + 0], alpha * sum0[0]);
-                y[row * row_block_dim + 1]
-                    = std::fma(beta, y[row * row_block_dim + 1], alpha * sum1[0]);
-                y[row * row_block_dim + 2]
-                    = std::fma(beta, y[row * row_block_dim + 2], alpha * sum2[0]);
-                y[row * row_block_dim + 3]
-                    = std::fma(beta, y[row * row_block_dim + 3], alpha * sum3[0]);
-            }
-            else
-            {
-                y[row * row_block_dim + 0] = alpha * sum0[0];
-                y[row * row_block_dim + 1] = alpha * sum1[0];
-                y[row * row_block_dim + 2] = alpha * sum2[0];
-                y[row * row_block_dim + 3] = alpha * sum3[0];
-            }
-        }
-        else
-        {
-            for(rocsparse_int bi = 0; bi < row_block_dim; ++bi)
-            {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
-
-                for(rocsparse_int j = row_begin; j < row_end; ++j)
-                {
-                    rocsparse_int col = bsr_col_ind[j] - base;
-
-                    for(rocsparse_int bj = 0; bj < col_block_dim; bj += WFSIZE)
-                    {
-                        for(uint32_t k = 0; k < WFSIZE; ++k)
-                        {
-                            if(bj + k < col_block_dim)
-                            {
-                                if(dir == rocsparse_direction_column)
-                                {
-                                    sum[k] = std::fma(bsr_val[row_block_dim * col_block_dim * j
-                                                              + row_block_dim * (bj + k) + bi],
-                                                      x[col_block_dim * col + (bj + k)],
-                                                      sum[k]);
-                                }
-                                else
-                                {
-                                    sum[k] = std::fma(bsr_val[row_block_dim * col_block_dim * j
-                                                              + col_block_dim * bi + (bj + k)],
-                                                      x[col_block_dim * col + (bj + k)],
-                                                      sum[k]);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                for(uint32_t j = 1; j < WFSIZE; j <<= 1)
-                {
-                    for(uint32_t k = 0; k < WFSIZE - j; ++k)
-                    {
-                        sum[k] += sum[k + j];
-                    }
-                }
-
-                if(beta != static_cast<T>(0))
-                {
-                    y[row * row_block_dim + bi]
-                        = std::fma(beta, y[row * row_block_dim + bi], alpha * sum[0]);
-                }
-                else
-                {
-                    y[row * row_block_dim + bi] = alpha * sum[0];
-                }
-            }
-        }
-    }
+    uint32_t WFSIZE = host_bsrmv_wfsize(
+        mb, nnzb, row_block_dim, row_block_dim == 2 || row_block_dim == 3 || row_block_dim == 4);
+
+    host_gebsrmv_kernel<T, rocsparse_int, rocsparse_int, T, T, T>(dir, row_block_dim)(
+        mb,
+        nullptr,
+        alpha,
+        bsr_row_ptr,
+        bsr_row_ptr + 1,
+        bsr_col_ind,
+        bsr_val,
+        row_block_dim,
+        col_block_dim,
+        x,
+        beta,
+        y,
+        WFSIZE,
+        base);
 }
 
 template <typename T>
@@ -1433,33 +1217,409 @@ void host_coomv_aos(rocsparse_operation  trans,
     case rocsparse_operation_transpose:
     case rocsparse_operation_conjugate_transpose:
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I i = 0; i < N; ++i)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(I i = 0; i < N; ++i)
+        {
+            y[i] *= beta;
+        }
+
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            I row = coo_ind[2 * i] - base;
+            I col = coo_ind[2 * i + 1] - base;
+            T val = (trans == rocsparse_operation_transpose) ? coo_val[i]
+                                                             : rocsparse_conj(coo_val[i]);
+
+            y[col] = std::fma(alpha * val, x[row], y[col]);
+        }
+
+        break;
+    }
+    }
+}
+
+template <typename A>
+inline A conj_val(A val, bool conj)
+{
+    return conj ? rocsparse_conj(val) : val;
+}
+
+// Compensated accumulation of prod into sum, with the rounding error accumulated in err
+template <typename T>
+static inline void host_two_sum(T prod, T& sum, T& err)
+{
+    T old = sum;
+
+    sum = sum + prod;
+    err = (old - (sum - (sum - old))) + (prod - (sum - old)) + err;
+}
+
+// Computes sum + err = sum_j alpha * op(csr_val[j]) * x[csr_col_ind[j] - base] for
+// j in [j_begin, j_end) using compensated summation.
+template <typename T, typename I, typename J, typename A, typename X>
+static inline void host_csrmv_dot_scalar(I                    j_begin,
+                                         I                    j_end,
+                                         T                    alpha,
+                                         const J*             csr_col_ind,
+                                         const A*             csr_val,
+                                         const X*             x,
+                                         rocsparse_index_base base,
+                                         bool                 conj,
+                                         T&                   sum,
+                                         T&                   err)
+{
+    for(I j = j_begin; j < j_end; ++j)
+    {
+        T prod = alpha * conj_val(csr_val[j], conj) * x[csr_col_ind[j] - base];
+
+        host_two_sum(prod, sum, err);
+    }
+}
+
+#ifdef ROCSPARSE_HOST_X86_SIMD
+typedef enum host_simd_isa_
+{
+    host_simd_isa_none,
+    host_simd_isa_avx2,
+    host_simd_isa_avx512
+} host_simd_isa;
+
+// Instruction set available on the host, determined once at runtime
+static host_simd_isa host_get_simd_isa()
+{
+    static const host_simd_isa isa = []() {
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx512f"))
+        {
+            return host_simd_isa_avx512;
+        }
+        else if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return host_simd_isa_avx2;
+        }
+
+        return host_simd_isa_none;
+    }();
+
+    return isa;
+}
+
+// Gathers x[ind[0:width] - base]
+__attribute__((target("avx2"))) static inline __m256d
+    host_gather_avx2(const double* x, const int32_t* ind, rocsparse_index_base base)
+{
+    __m128i idx  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ind));
+    __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(
+        _mm256_setzero_pd(), x, _mm_sub_epi32(idx, _mm_set1_epi32(base)), mask, 8);
+}
+
+__attribute__((target("avx2"))) static inline __m256d
+    host_gather_avx2(const double* x, const int64_t* ind, rocsparse_index_base base)
+{
+    __m256i idx  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ind));
+    __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i64gather_pd(
+        _mm256_setzero_pd(), x, _mm256_sub_epi64(idx, _mm256_set1_epi64x(base)), mask, 8);
+}
+
+__attribute__((target("avx2"))) static inline __m256
+    host_gather_avx2(const float* x, const int32_t* ind, rocsparse_index_base base)
+{
+    __m256i idx  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ind));
+    __m256  mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    return _mm256_mask_i32gather_ps(
+        _mm256_setzero_ps(), x, _mm256_sub_epi32(idx, _mm256_set1_epi32(base)), mask, 4);
+}
+
+__attribute__((target("avx2"))) static inline __m256
+    host_gather_avx2(const float* x, const int64_t* ind, rocsparse_index_base base)
+{
+    __m256i vbase = _mm256_set1_epi64x(base);
+    __m256i lo    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ind));
+    __m256i hi    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ind + 4));
+    __m128  mask  = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+    return _mm256_set_m128(
+        _mm256_mask_i64gather_ps(_mm_setzero_ps(), x, _mm256_sub_epi64(hi, vbase), mask, 4),
+        _mm256_mask_i64gather_ps(_mm_setzero_ps(), x, _mm256_sub_epi64(lo, vbase), mask, 4));
+}
+
+__attribute__((target("avx512f"))) static inline __m512d
+    host_gather_avx512(const double* x, const int32_t* ind, rocsparse_index_base base)
+{
+    __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ind));
+    return _mm512_mask_i32gather_pd(
+        _mm512_setzero_pd(), 0xFF, _mm256_sub_epi32(idx, _mm256_set1_epi32(base)), x, 8);
+}
+
+__attribute__((target("avx512f"))) static inline __m512d
+    host_gather_avx512(const double* x, const int64_t* ind, rocsparse_index_base base)
+{
+    __m512i idx = _mm512_loadu_si512(ind);
+    return _mm512_mask_i64gather_pd(
+        _mm512_setzero_pd(), 0xFF, _mm512_sub_epi64(idx, _mm512_set1_epi64(base)), x, 8);
+}
+
+__attribute__((target("avx512f"))) static inline __m512
+    host_gather_avx512(const float* x, const int32_t* ind, rocsparse_index_base base)
+{
+    __m512i idx = _mm512_loadu_si512(ind);
+    return _mm512_mask_i32gather_ps(
+        _mm512_setzero_ps(), 0xFFFF, _mm512_sub_epi32(idx, _mm512_set1_epi32(base)), x, 4);
+}
+
+__attribute__((target("avx512f"))) static inline __m512
+    host_gather_avx512(const float* x, const int64_t* ind, rocsparse_index_base base)
+{
+    __m512i vbase = _mm512_set1_epi64(base);
+    __m512i lo    = _mm512_loadu_si512(ind);
+    __m512i hi    = _mm512_loadu_si512(ind + 8);
+
+    __m256 xlo
+        = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), 0xFF, _mm512_sub_epi64(lo, vbase), x, 4);
+    __m256 xhi
+        = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), 0xFF, _mm512_sub_epi64(hi, vbase), x, 4);
+
+    __m512d zero = _mm512_setzero_pd();
+    __m512d v    = _mm512_mask_insertf64x4(zero, 0xFF, zero, _mm256_castps_pd(xlo), 0);
+    return _mm512_castpd_ps(_mm512_mask_insertf64x4(zero, 0xFF, v, _mm256_castps_pd(xhi), 1));
+}
+
+// Vector types and arithmetic of the SIMD SpMV kernels
+template <host_simd_isa ISA, typename T>
+struct host_simd;
+
+#define ROCSPARSE_HOST_SIMD_TRAITS(ISA, TARGET, TYPE, VTYPE, WIDTH, SFX, PREFIX)   \
+    template <>                                                                    \
+    struct host_simd<host_simd_isa_##ISA, TYPE>                                    \
+    {                                                                              \
+        typedef VTYPE        type;                                                 \
+        static constexpr int width = WIDTH;                                        \
+        __attribute__((target(TARGET))) static inline VTYPE set1(TYPE a)           \
+        {                                                                          \
+            return PREFIX##_set1_##SFX(a);                                         \
+        }                                                                          \
+        __attribute__((target(TARGET))) static inline VTYPE load(const TYPE* p)    \
+        {                                                                          \
+            return PREFIX##_loadu_##SFX(p);                                        \
+        }                                                                          \
+        __attribute__((target(TARGET))) static inline void store(TYPE* p, VTYPE a) \
+        {                                                                          \
+            PREFIX##_storeu_##SFX(p, a);                                           \
+        }                                                                          \
+        __attribute__((target(TARGET))) static inline VTYPE add(VTYPE a, VTYPE b)  \
+        {                                                                          \
+            return PREFIX##_add_##SFX(a, b);                                       \
+        }                                                                          \
+        __attribute__((target(TARGET))) static inline VTYPE sub(VTYPE a, VTYPE b)  \
+        {                                                                          \
+            return PREFIX##_sub_##SFX(a, b);                                       \
+        }                                                                          \
+        __attribute__((target(TARGET))) static inline VTYPE mul(VTYPE a, VTYPE b)  \
+        {                                                                          \
+            return PREFIX##_mul_##SFX(a, b);                                       \
+        }                                                                          \
+        template <typename J>                                                      \
+        __attribute__((target(TARGET))) static inline VTYPE                        \
+            gather(const TYPE* x, const J* ind, rocsparse_index_base base)         \
+        {                                                                          \
+            return host_gather_##ISA(x, ind, base);                                \
+        }                                                                          \
+    }
+
+ROCSPARSE_HOST_SIMD_TRAITS(avx2, "avx2,fma", double, __m256d, 4, pd, _mm256);
+ROCSPARSE_HOST_SIMD_TRAITS(avx2, "avx2,fma", float, __m256, 8, ps, _mm256);
+ROCSPARSE_HOST_SIMD_TRAITS(avx512, "avx512f", double, __m512d, 8, pd, _mm512);
+ROCSPARSE_HOST_SIMD_TRAITS(avx512, "avx512f", float, __m512, 16, ps, _mm512);
+
+#undef ROCSPARSE_HOST_SIMD_TRAITS
+
+// Vectorized compensated dot product. Each lane accumulates its own sum and error,
+// lanes are combined using compensated summation as well.
+#define ROCSPARSE_HOST_CSRMV_DOT_SIMD(ISA, TARGET)                           \
+    template <typename T, typename I, typename J>                            \
+    __attribute__((target(TARGET))) static void host_csrmv_dot_##ISA(        \
+        I j_begin, I j_end, T alpha, const J* ind, const T* val, const T* x, \
+        rocsparse_index_base base, T& sum, T& err)                           \
+    {                                                                        \
+        typedef host_simd<host_simd_isa_##ISA, T> S;                         \
+        typedef typename S::type                   V;                        \
+                                                                             \
+        V vsum   = S::set1(static_cast<T>(0));                               \
+        V verr   = S::set1(static_cast<T>(0));                               \
+        V valpha = S::set1(alpha);                                           \
+                                                                             \
+        I j = j_begin;                                                       \
+        for(; j + S::width <= j_end; j += S::width)                          \
+        {                                                                    \
+            V prod = S::mul(S::mul(valpha, S::load(val + j)),                \
+                            S::gather(x, ind + j, base));                    \
+            V old  = vsum;                                                   \
+                                                                             \
+            vsum = S::add(vsum, prod);                                       \
+                                                                             \
+            V bp = S::sub(vsum, old);                                        \
+            V e  = S::add(S::sub(old, S::sub(vsum, bp)), S::sub(prod, bp));  \
+            verr = S::add(e, verr);                                          \
+        }                                                                    \
+                                                                             \
+        T lane_sum[S::width];                                                \
+        T lane_err[S::width];                                                \
+                                                                             \
+        S::store(lane_sum, vsum);                                            \
+        S::store(lane_err, verr);                                            \
+                                                                             \
+        for(int k = 0; k < S::width; ++k)                                    \
+        {                                                                    \
+            host_two_sum(lane_sum[k], sum, err);                             \
+            err += lane_err[k];                                              \
+        }                                                                    \
+                                                                             \
+        for(; j < j_end; ++j)                                                \
+        {                                                                    \
+            host_two_sum(alpha * val[j] * x[ind[j] - base], sum, err);       \
+        }                                                                    \
+    }
+
+ROCSPARSE_HOST_CSRMV_DOT_SIMD(avx2, "avx2,fma")
+ROCSPARSE_HOST_CSRMV_DOT_SIMD(avx512, "avx512f")
+
+#undef ROCSPARSE_HOST_CSRMV_DOT_SIMD
+#endif
+
+// Dot product of a row segment. Real single and double precision are dispatched to the
+// widest instruction set supported by the host, all other precisions use the scalar path.
+template <typename T, typename I, typename J, typename A, typename X>
+struct host_csrmv_dot
+{
+    static void run(I                    j_begin,
+                    I                    j_end,
+                    T                    alpha,
+                    const J*             csr_col_ind,
+                    const A*             csr_val,
+                    const X*             x,
+                    rocsparse_index_base base,
+                    bool                 conj,
+                    T&                   sum,
+                    T&                   err)
+    {
+        host_csrmv_dot_scalar(j_begin, j_end, alpha, csr_col_ind, csr_val, x, base, conj, sum, err);
+    }
+};
+
+template <typename T, typename I, typename J>
+struct host_csrmv_dot_real
+{
+    static void run(I                    j_begin,
+                    I                    j_end,
+                    T                    alpha,
+                    const J*             csr_col_ind,
+                    const T*             csr_val,
+                    const T*             x,
+                    rocsparse_index_base base,
+                    bool                 conj,
+                    T&                   sum,
+                    T&                   err)
+    {
+#ifdef ROCSPARSE_HOST_X86_SIMD
+        switch(host_get_simd_isa())
+        {
+        case host_simd_isa_avx512:
+            host_csrmv_dot_avx512(j_begin, j_end, alpha, csr_col_ind, csr_val, x, base, sum, err);
+            return;
+        case host_simd_isa_avx2:
+            host_csrmv_dot_avx2(j_begin, j_end, alpha, csr_col_ind, csr_val, x, base, sum, err);
+            return;
+        case host_simd_isa_none:
+            break;
+        }
+#endif
+
+        host_csrmv_dot_scalar(j_begin, j_end, alpha, csr_col_ind, csr_val, x, base, conj, sum, err);
+    }
+};
+
+template <typename I, typename J>
+struct host_csrmv_dot<float, I, J, float, float> : host_csrmv_dot_real<float, I, J>
+{
+};
+
+template <typename I, typename J>
+struct host_csrmv_dot<double, I, J, double, double> : host_csrmv_dot_real<double, I, J>
+{
+};
+
+// Merge path search. Finds the split point of diagonal in the merge of the row end
+// offsets of A with the natural numbers 0, ..., nnz - 1, see Merrill and Garland,
+// "Merge-based Parallel Sparse Matrix-Vector Multiplication", SC16.
+template <typename I, typename J>
+static inline void host_csrmv_merge_path_search(int64_t              diagonal,
+                                                J                    M,
+                                                I                    nnz,
+                                                const I*             csr_row_ptr,
+                                                rocsparse_index_base base,
+                                                J&                   row,
+                                                I&                   idx)
+{
+    int64_t x_min = std::max(diagonal - static_cast<int64_t>(nnz), static_cast<int64_t>(0));
+    int64_t x_max = std::min(diagonal, static_cast<int64_t>(M));
+
+    while(x_min < x_max)
+    {
+        int64_t pivot = (x_min + x_max) >> 1;
+
+        if(static_cast<int64_t>(csr_row_ptr[pivot + 1] - base) <= diagonal - pivot - 1)
         {
-            y[i] *= beta;
+            x_min = pivot + 1;
         }
-
-        for(int64_t i = 0; i < nnz; ++i)
+        else
         {
-            I row = coo_ind[2 * i] - base;
-            I col = coo_ind[2 * i + 1] - base;
-            T val = (trans == rocsparse_operation_transpose) ? coo_val[i]
-                                                             : rocsparse_conj(coo_val[i]);
-
-            y[col] = std::fma(alpha * val, x[row], y[col]);
+            x_max = pivot;
         }
-
-        break;
-    }
     }
+
+    row = static_cast<J>(x_min);
+    idx = static_cast<I>(diagonal - x_min);
 }
 
-template <typename A>
-inline A conj_val(A val, bool conj)
+// Number of segments the merge path of A is split into. It only depends on the path length, such
+// that the summation order and hence the result do not change with the number of threads.
+template <typename I, typename J>
+static inline int64_t host_csrmv_merge_path_nparts(J M, I nnz, int64_t max_parts)
 {
-    return conj ? rocsparse_conj(val) : val;
+    static constexpr int64_t items_per_part = 4096;
+
+    int64_t path_length = static_cast<int64_t>(M) + nnz;
+
+    return std::max(std::min((path_length + items_per_part - 1) / items_per_part, max_parts),
+                    static_cast<int64_t>(1));
+}
+
+// Splits the merge path of A into nparts segments of equal work and returns the
+// segment part
+template <typename I, typename J>
+static inline void host_csrmv_merge_path_partition(int64_t              nparts,
+                                                   int64_t              part,
+                                                   J                    M,
+                                                   I                    nnz,
+                                                   const I*             csr_row_ptr,
+                                                   rocsparse_index_base base,
+                                                   J&                   row_begin,
+                                                   I&                   idx_begin,
+                                                   J&                   row_end,
+                                                   I&                   idx_end)
+{
+    int64_t path_length    = static_cast<int64_t>(M) + nnz;
+    int64_t items_per_part = (path_length + nparts - 1) / nparts;
+    int64_t diagonal_begin = std::min(items_per_part * part, path_length);
+    int64_t diagonal_end   = std::min(diagonal_begin + items_per_part, path_length);
+
+    host_csrmv_merge_path_search(diagonal_begin, M, nnz, csr_row_ptr, base, row_begin, idx_begin);
+    host_csrmv_merge_path_search(diagonal_end, M, nnz, csr_row_ptr, base, row_end, idx_end);
 }
 
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
@@ -1484,13 +1644,7 @@ static void host_csrmv_general(rocsparse_operation  trans,
     {
         if(algo == rocsparse_spmv_alg_csr_stream)
         {
-            // Get device properties
-            int             dev;
-            hipDeviceProp_t prop;
-
-            hipGetDevice(&dev);
-            hipGetDeviceProperties(&prop, dev);
-
+            // Long rows are grouped as on a 64 wide wavefront, independently of the device
             int WF_SIZE;
             J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
 
@@ -1502,7 +1656,7 @@ static void host_csrmv_general(rocsparse_operation  trans,
                 WF_SIZE = 8;
             else if(nnz_per_row < 32)
                 WF_SIZE = 16;
-            else if(nnz_per_row < 64 || prop.warpSize == 32)
+            else if(nnz_per_row < 64)
                 WF_SIZE = 32;
             else
                 WF_SIZE = 64;
@@ -1550,58 +1704,144 @@ static void host_csrmv_general(rocsparse_operation  trans,
         }
         else
         {
+            // Merge path SpMV. Each segment holds the same amount of rows and non-zeros,
+            // such that long rows are shared among several segments. Partial sums of rows
+            // that cross segment boundaries are added in a fix up step.
+            int64_t nparts
+                = host_csrmv_merge_path_nparts(M, nnz, std::numeric_limits<int64_t>::max());
+
+            std::vector<J> carry_row(nparts);
+            std::vector<T> carry_val(nparts);
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
-            for(J i = 0; i < M; ++i)
+            for(int64_t part = 0; part < nparts; ++part)
             {
-                T sum = static_cast<T>(0);
-                T err = static_cast<T>(0);
+                J row_begin, row_end;
+                I idx_begin, idx_end;
 
-                I row_begin = csr_row_ptr[i] - base;
-                I row_end   = csr_row_ptr[i + 1] - base;
+                host_csrmv_merge_path_partition(nparts,
+                                                part,
+                                                M,
+                                                nnz,
+                                                csr_row_ptr,
+                                                base,
+                                                row_begin,
+                                                idx_begin,
+                                                row_end,
+                                                idx_end);
 
-                for(I j = row_begin; j < row_end; ++j)
+                I j = idx_begin;
+
+                // Rows that end within this segment
+                for(J i = row_begin; i < row_end; ++i)
                 {
-                    T old  = sum;
-                    T prod = alpha * conj_val(csr_val[j], conj) * x[csr_col_ind[j] - base];
+                    T sum = static_cast<T>(0);
+                    T err = static_cast<T>(0);
 
-                    sum = sum + prod;
-                    err = (old - (sum - (sum - old))) + (prod - (sum - old)) + err;
-                }
+                    I row_end_j = csr_row_ptr[i + 1] - base;
 
-                if(beta != static_cast<T>(0))
-                {
-                    y[i] = std::fma(beta, y[i], sum + err);
+                    host_csrmv_dot<T, I, J, A, X>::run(
+                        j, row_end_j, alpha, csr_col_ind, csr_val, x, base, conj, sum, err);
+
+                    j = row_end_j;
+
+                    if(beta != static_cast<T>(0))
+                    {
+                        y[i] = std::fma(beta, y[i], sum + err);
+                    }
+                    else
+                    {
+                        y[i] = sum + err;
+                    }
                 }
-                else
+
+                // Partial sum of the row that continues in the next segment
+                T sum = static_cast<T>(0);
+                T err = static_cast<T>(0);
+
+                host_csrmv_dot<T, I, J, A, X>::run(
+                    j, idx_end, alpha, csr_col_ind, csr_val, x, base, conj, sum, err);
+
+                carry_row[part] = row_end;
+                carry_val[part] = sum + err;
+            }
+
+            // Fix up rows that span multiple segments
+            for(size_t t = 0; t < carry_row.size(); ++t)
+            {
+                if(carry_row[t] < M)
                 {
-                    y[i] = sum + err;
+                    y[carry_row[t]] += carry_val[t];
                 }
             }
         }
     }
     else
     {
-        // Scale y with beta
-        for(J i = 0; i < N; ++i)
-        {
-            y[i] *= beta;
-        }
+        // Transposed SpMV. Each segment of the merge path is accumulated into a private
+        // copy of y, the private copies are reduced in segment order afterwards. The number
+        // of segments is bounded to limit the memory of the private copies.
+        static constexpr int64_t max_parts = 64;
 
-        // Transposed SpMV
-        for(J i = 0; i < M; ++i)
+        int64_t nparts = host_csrmv_merge_path_nparts(M, nnz, max_parts);
+
+        std::vector<T> y_private(static_cast<size_t>(nparts) * N, static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
         {
-            I row_begin = csr_row_ptr[i] - base;
-            I row_end   = csr_row_ptr[i + 1] - base;
-            T row_val   = alpha * x[i];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int64_t part = 0; part < nparts; ++part)
+            {
+                J row_begin, row_end;
+                I idx_begin, idx_end;
 
-            for(I j = row_begin; j < row_end; ++j)
+                host_csrmv_merge_path_partition(nparts,
+                                                part,
+                                                M,
+                                                nnz,
+                                                csr_row_ptr,
+                                                base,
+                                                row_begin,
+                                                idx_begin,
+                                                row_end,
+                                                idx_end);
+
+                T* y_part = y_private.data() + static_cast<size_t>(part) * N;
+
+                for(J i = row_begin; i <= row_end && i < M; ++i)
+                {
+                    I j_begin = std::max(idx_begin, static_cast<I>(csr_row_ptr[i] - base));
+                    I j_end   = std::min(idx_end, static_cast<I>(csr_row_ptr[i + 1] - base));
+                    T row_val = alpha * x[i];
+
+                    for(I j = j_begin; j < j_end; ++j)
+                    {
+                        J col       = csr_col_ind[j] - base;
+                        A val       = conj_val(csr_val[j], conj);
+                        y_part[col] = std::fma(static_cast<T>(val), row_val, y_part[col]);
+                    }
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for(J i = 0; i < N; ++i)
             {
-                J col  = csr_col_ind[j] - base;
-                A val  = conj_val(csr_val[j], conj);
-                y[col] = std::fma(
-                    static_cast<T>(val), static_cast<T>(row_val), static_cast<T>(y[col]));
+                T sum = static_cast<T>(0);
+
+                for(int64_t part = 0; part < nparts; ++part)
+                {
+                    sum += y_private[static_cast<size_t>(part) * N + i];
+                }
+
+                y[i] = y[i] * beta + sum;
             }
         }
     }
@@ -1627,13 +1867,7 @@ static void host_csrmv_symmetric(rocsparse_operation  trans,
 
     if(algo == rocsparse_spmv_alg_csr_stream || trans != rocsparse_operation_none)
     {
-        // Get device properties
-        int             dev;
-        hipDeviceProp_t prop;
-
-        hipGetDevice(&dev);
-        hipGetDeviceProperties(&prop, dev);
-
+        // Long rows are grouped as on a 64 wide wavefront, independently of the device
         int WF_SIZE;
         J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
 
@@ -1645,7 +1879,7 @@ static void host_csrmv_symmetric(rocsparse_operation  trans,
             WF_SIZE = 8;
         else if(nnz_per_row < 32)
             WF_SIZE = 16;
-        else if(nnz_per_row < 64 || prop.warpSize == 32)
+        else if(nnz_per_row < 64)
             WF_SIZE = 32;
         else
             WF_SIZE = 64;
@@ -1893,220 +2127,448 @@ void host_cscmv(rocsparse_operation trans,
     }
 }
 
-template <typename I, typename J, typename T>
-static void host_csr_lsolve(J                    M,
-                            T                    alpha,
-                            const I*             csr_row_ptr,
-                            const J*             csr_col_ind,
-                            const T*             csr_val,
-                            const T*             x,
-                            int64_t              x_inc,
-                            T*                   y,
-                            rocsparse_diag_type  diag_type,
-                            rocsparse_index_base base,
-                            J*                   struct_pivot,
-                            J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
+template <typename I, typename J>
+void host_trm_analysis(rocsparse_operation  trans,
+                       J                    M,
+                       I                    nnz,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
+                       rocsparse_fill_mode  fill_mode,
+                       rocsparse_index_base base,
+                       host_trm_info<I, J>& info)
+{
+    info.trans     = trans;
+    info.fill_mode = fill_mode;
+    info.m         = M;
+    info.nnz       = nnz;
+
+    const I* row_ptr = csr_row_ptr;
+    const J* col_ind = csr_col_ind;
+
+    info.trmt_row_ptr.clear();
+    info.trmt_col_ind.clear();
+    info.trmt_perm.clear();
+
+    if(trans != rocsparse_operation_none)
     {
-        temp.assign(prop.warpSize, static_cast<T>(0));
-        temp[0] = alpha * x[x_inc * row];
+        // Transpose the pattern and keep track of the value permutation, such that
+        // subsequent solves only need to gather the values
+        info.trmt_row_ptr.assign(M + 1, 0);
+        info.trmt_col_ind.resize(nnz);
+        info.trmt_perm.resize(nnz);
 
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
+        for(I i = 0; i < nnz; ++i)
+        {
+            ++info.trmt_row_ptr[csr_col_ind[i] - base + 1];
+        }
 
-        T diag_val = static_cast<T>(0);
+        for(J i = 0; i < M; ++i)
+        {
+            info.trmt_row_ptr[i + 1] += info.trmt_row_ptr[i];
+        }
 
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
+        for(J row = 0; row < M; ++row)
         {
-            for(uint32_t k = 0; k < prop.warpSize; ++k)
+            for(I j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
             {
-                I j = l + k;
+                J col = csr_col_ind[j] - base;
+                I idx = info.trmt_row_ptr[col]++;
 
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
+                info.trmt_col_ind[idx] = row + base;
+                info.trmt_perm[idx]    = j;
+            }
+        }
 
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+        for(J i = M; i > 0; --i)
+        {
+            info.trmt_row_ptr[i] = info.trmt_row_ptr[i - 1] + base;
+        }
 
-                if(local_val == static_cast<T>(0) && local_col == row
-                   && diag_type == rocsparse_diag_type_non_unit)
-                {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = static_cast<T>(1);
-                }
+        info.trmt_row_ptr[0] = base;
 
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
+        row_ptr = info.trmt_row_ptr.data();
+        col_ind = info.trmt_col_ind.data();
 
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+        // Lower triangular part of A is the upper triangular part of A^T
+        fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
+                                                             : rocsparse_fill_mode_lower;
+    }
+
+    // Compute the level of each row. Only entries that are accessed by the solve
+    // contribute a dependency, i.e. all strictly lower entries up to the diagonal
+    // for lower triangular matrices and all strictly upper entries otherwise.
+    std::vector<J> level(M, 0);
+    J              nlevels = (M > 0) ? 1 : 0;
+
+    if(fill_mode == rocsparse_fill_mode_lower)
+    {
+        for(J row = 0; row < M; ++row)
+        {
+            J lvl = 0;
+
+            for(I j = row_ptr[row] - base; j < row_ptr[row + 1] - base; ++j)
+            {
+                J col = col_ind[j] - base;
 
+                if(col >= row)
+                {
                     break;
                 }
 
-                // Lower triangular part
-                temp[k] = std::fma(-local_val, y[local_col], temp[k]);
+                lvl = std::max(lvl, level[col] + 1);
             }
-        }
 
-        for(uint32_t j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(uint32_t k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] += temp[k + j];
-            }
+            level[row] = lvl;
+            nlevels    = std::max(nlevels, lvl + 1);
         }
-
-        if(diag_type == rocsparse_diag_type_non_unit)
+    }
+    else
+    {
+        for(J row = M - 1; row >= 0; --row)
         {
-            if(diag == -1)
+            J lvl = 0;
+
+            for(I j = row_ptr[row] - base; j < row_ptr[row + 1] - base; ++j)
             {
-                *struct_pivot = std::min(*struct_pivot, row + base);
+                J col = col_ind[j] - base;
+
+                if(col > row)
+                {
+                    lvl = std::max(lvl, level[col] + 1);
+                }
             }
 
-            y[row] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[row] = temp[0];
+            level[row] = lvl;
+            nlevels    = std::max(nlevels, lvl + 1);
         }
     }
-}
 
-template <typename I, typename J, typename T>
-static void host_csr_usolve(J                    M,
-                            T                    alpha,
-                            const I*             csr_row_ptr,
-                            const J*             csr_col_ind,
-                            const T*             csr_val,
-                            const T*             x,
-                            int64_t              x_inc,
-                            T*                   y,
-                            rocsparse_diag_type  diag_type,
-                            rocsparse_index_base base,
-                            J*                   struct_pivot,
-                            J*                   numeric_pivot)
-{
+    // Bucket rows by level, rows within a level keep their natural order
+    info.level_ptr.assign(nlevels + 1, 0);
+    info.level_row.resize(M);
 
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
+    for(J row = 0; row < M; ++row)
+    {
+        ++info.level_ptr[level[row] + 1];
+    }
 
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
+    for(J l = 0; l < nlevels; ++l)
+    {
+        info.level_ptr[l + 1] += info.level_ptr[l];
+    }
 
-    std::vector<T> temp(prop.warpSize);
+    std::vector<J> offset(info.level_ptr.begin(), info.level_ptr.end() - 1);
 
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
+    for(J row = 0; row < M; ++row)
     {
+        info.level_row[offset[level[row]]++] = row;
+    }
+}
 
-        temp.assign(prop.warpSize, static_cast<T>(0));
-        temp[0] = alpha * x[x_inc * row];
+// Solves a single row of a level scheduled triangular system for nrhs right-hand sides.
+// The right-hand side of row r and column i is x[r * x_inc + i * x_ld] and the solution
+// is written to y[r * y_inc + i * y_ld]. x and y might alias.
+template <typename I, typename J, typename T>
+static inline void host_trm_solve_row(J                    row,
+                                      J                    nrhs,
+                                      T                    alpha,
+                                      const I*             csr_row_ptr,
+                                      const J*             csr_col_ind,
+                                      const T*             csr_val,
+                                      const T*             x,
+                                      int64_t              x_inc,
+                                      int64_t              x_ld,
+                                      bool                 conj_x,
+                                      T*                   y,
+                                      int64_t              y_inc,
+                                      int64_t              y_ld,
+                                      rocsparse_diag_type  diag_type,
+                                      rocsparse_fill_mode  fill_mode,
+                                      rocsparse_index_base base,
+                                      J&                   struct_pivot,
+                                      J&                   numeric_pivot)
+{
+    I row_begin = csr_row_ptr[row] - base;
+    I row_end   = csr_row_ptr[row + 1] - base;
 
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
+    I diag     = -1;
+    T diag_val = static_cast<T>(0);
 
-        T diag_val = static_cast<T>(0);
+    // Range of entries that are part of the triangular solve
+    I dep_begin = row_begin;
+    I dep_end   = row_end;
 
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+    if(fill_mode == rocsparse_fill_mode_lower)
+    {
+        // Ignore all entries that are above the diagonal
+        for(dep_end = row_begin; dep_end < row_end; ++dep_end)
         {
-            for(uint32_t k = 0; k < prop.warpSize; ++k)
+            if(csr_col_ind[dep_end] - base >= row)
             {
-                I j = l - k;
+                break;
+            }
+        }
 
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
+        if(dep_end < row_end && csr_col_ind[dep_end] - base == row
+           && diag_type == rocsparse_diag_type_non_unit)
+        {
+            T local_val = csr_val[dep_end];
 
-                J local_col = csr_col_ind[j] - base;
+            if(local_val == static_cast<T>(0))
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                numeric_pivot = std::min(numeric_pivot, row + base);
+                local_val     = static_cast<T>(1);
+            }
+
+            diag     = dep_end;
+            diag_val = static_cast<T>(1) / local_val;
+        }
+    }
+    else if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        for(I j = row_end - 1; j >= row_begin; --j)
+        {
+            if(csr_col_ind[j] - base == row)
+            {
                 T local_val = csr_val[j];
 
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
+                // Check for numerical zero
+                if(local_val == static_cast<T>(0))
                 {
-                    continue;
+                    numeric_pivot = std::min(numeric_pivot, row + base);
+                    local_val     = static_cast<T>(1);
                 }
 
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        // Check for numerical zero
-                        if(local_val == static_cast<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = static_cast<T>(1);
-                        }
+                diag     = j;
+                diag_val = static_cast<T>(1) / local_val;
+            }
+        }
+    }
 
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+    if(diag_type == rocsparse_diag_type_non_unit && diag == -1)
+    {
+        struct_pivot = std::min(struct_pivot, row + base);
+    }
 
-                    continue;
-                }
+    for(J i = 0; i < nrhs; ++i)
+    {
+        T sum = x[x_inc * row + x_ld * i];
+        sum   = alpha * (conj_x ? rocsparse_conj(sum) : sum);
 
-                // Upper triangular part
-                temp[k] = std::fma(-local_val, y[local_col], temp[k]);
+        if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            for(I j = dep_begin; j < dep_end; ++j)
+            {
+                J local_col = csr_col_ind[j] - base;
+                sum         = std::fma(-csr_val[j], y[y_inc * local_col + y_ld * i], sum);
             }
         }
-
-        for(uint32_t j = 1; j < prop.warpSize; j <<= 1)
+        else
         {
-            for(uint32_t k = 0; k < prop.warpSize - j; ++k)
+            for(I j = dep_end - 1; j >= dep_begin; --j)
             {
-                temp[k] += temp[k + j];
+                J local_col = csr_col_ind[j] - base;
+
+                // Ignore all entries that are on or below the diagonal
+                if(local_col > row)
+                {
+                    sum = std::fma(-csr_val[j], y[y_inc * local_col + y_ld * i], sum);
+                }
             }
         }
 
-        if(diag_type == rocsparse_diag_type_non_unit)
+        y[y_inc * row + y_ld * i]
+            = (diag_type == rocsparse_diag_type_non_unit) ? sum * diag_val : sum;
+    }
+}
+
+// Minimum number of rows of a level to be distributed among threads
+static constexpr int64_t host_trm_min_parallel_level_size = 256;
+
+// Calls f(row) for all rows of a level schedule, such that f(row) is called after f has been
+// called for all rows that row depends on. Must be encountered by all threads of a parallel
+// region. Levels are processed one after another, rows within a level are distributed among
+// threads. Consecutive levels that are too small to be worth a thread barrier are merged and
+// processed by a single thread.
+template <typename I, typename J, typename F>
+static void host_trm_level_for_each(const host_trm_info<I, J>& info, F&& f)
+{
+    const J  nlevels   = static_cast<J>(info.level_ptr.size()) - 1;
+    const J* level_ptr = info.level_ptr.data();
+    const J* level_row = info.level_row.data();
+
+    J l = 0;
+    while(l < nlevels)
+    {
+        J level_begin = level_ptr[l];
+        J level_end   = level_ptr[l + 1];
+
+        if(level_end - level_begin >= host_trm_min_parallel_level_size)
         {
-            if(diag == -1)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(J k = level_begin; k < level_end; ++k)
             {
-                *struct_pivot = std::min(*struct_pivot, row + base);
+                f(level_row[k]);
             }
 
-            y[row] = temp[0] * diag_val;
+            ++l;
         }
         else
         {
-            y[row] = temp[0];
+            // Merge consecutive small levels
+            while(l < nlevels
+                  && level_ptr[l + 1] - level_ptr[l] < host_trm_min_parallel_level_size)
+            {
+                ++l;
+            }
+
+            level_end = level_ptr[l];
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+            for(J k = level_begin; k < level_end; ++k)
+            {
+                f(level_row[k]);
+            }
+        }
+    }
+}
+
+// Level scheduled triangular solve
+template <typename I, typename J, typename T>
+static void host_trm_solve(const host_trm_info<I, J>& info,
+                           J                          nrhs,
+                           T                          alpha,
+                           const I*                   csr_row_ptr,
+                           const J*                   csr_col_ind,
+                           const T*                   csr_val,
+                           const T*                   x,
+                           int64_t                    x_inc,
+                           int64_t                    x_ld,
+                           bool                       conj_x,
+                           T*                         y,
+                           int64_t                    y_inc,
+                           int64_t                    y_ld,
+                           rocsparse_diag_type        diag_type,
+                           rocsparse_index_base       base,
+                           J*                         struct_pivot,
+                           J*                         numeric_pivot)
+{
+    const J        M = info.m;
+    std::vector<T> trmt_val;
+
+    rocsparse_fill_mode fill_mode = info.fill_mode;
+
+    if(info.trans != rocsparse_operation_none)
+    {
+        // Gather values of the transposed matrix
+        trmt_val.resize(info.nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(I i = 0; i < info.nnz; ++i)
+        {
+            trmt_val[i] = (info.trans == rocsparse_operation_conjugate_transpose)
+                              ? rocsparse_conj(csr_val[info.trmt_perm[i]])
+                              : csr_val[info.trmt_perm[i]];
+        }
+
+        csr_row_ptr = info.trmt_row_ptr.data();
+        csr_col_ind = info.trmt_col_ind.data();
+        csr_val     = trmt_val.data();
+
+        fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
+                                                             : rocsparse_fill_mode_lower;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel if(M >= host_trm_min_parallel_level_size)
+#endif
+    {
+        J local_struct_pivot  = M + 1;
+        J local_numeric_pivot = M + 1;
+
+        host_trm_level_for_each(info, [&](J row) {
+            host_trm_solve_row(row,
+                               nrhs,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               x_inc,
+                               x_ld,
+                               conj_x,
+                               y,
+                               y_inc,
+                               y_ld,
+                               diag_type,
+                               fill_mode,
+                               base,
+                               local_struct_pivot,
+                               local_numeric_pivot);
+        });
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
         }
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csrsv(const host_trm_info<I, J>& info,
+                T                          alpha,
+                const I*                   csr_row_ptr,
+                const J*                   csr_col_ind,
+                const T*                   csr_val,
+                const T*                   x,
+                int64_t                    x_inc,
+                T*                         y,
+                rocsparse_diag_type        diag_type,
+                rocsparse_index_base       base,
+                J*                         struct_pivot,
+                J*                         numeric_pivot)
+{
+    const J M = info.m;
+
+    // Initialize pivot
+    *struct_pivot  = M + 1;
+    *numeric_pivot = M + 1;
+
+    host_trm_solve(info,
+                   static_cast<J>(1),
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val,
+                   x,
+                   x_inc,
+                   static_cast<int64_t>(0),
+                   false,
+                   y,
+                   static_cast<int64_t>(1),
+                   static_cast<int64_t>(0),
+                   diag_type,
+                   base,
+                   struct_pivot,
+                   numeric_pivot);
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+}
+
 template <typename I, typename J, typename T>
 void host_csrsv(rocsparse_operation  trans,
                 J                    M,
@@ -2124,108 +2586,21 @@ void host_csrsv(rocsparse_operation  trans,
                 J*                   struct_pivot,
                 J*                   numeric_pivot)
 {
-
-    // Initialize pivot
-    *struct_pivot  = M + 1;
-    *numeric_pivot = M + 1;
-
-    if(trans == rocsparse_operation_none)
-    {
-        if(fill_mode == rocsparse_fill_mode_lower)
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            x_inc,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            x_inc,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
-    else if(trans == rocsparse_operation_transpose
-            || trans == rocsparse_operation_conjugate_transpose)
-    {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
-
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr,
-                        csr_col_ind,
-                        csr_val,
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        rocsparse_action_numeric,
-                        base);
-
-        if(trans == rocsparse_operation_conjugate_transpose)
-        {
-            for(size_t i = 0; i < csrt_val.size(); i++)
-            {
-                csrt_val[i] = rocsparse_conj(csrt_val[i]);
-            }
-        }
-
-        if(fill_mode == rocsparse_fill_mode_lower)
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            x_inc,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            x_inc,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
-
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+    host_trm_info<I, J> info;
+    host_trm_analysis(trans, M, nnz, csr_row_ptr, csr_col_ind, fill_mode, base, info);
+
+    host_csrsv(info,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               csr_val,
+               x,
+               x_inc,
+               y,
+               diag_type,
+               base,
+               struct_pivot,
+               numeric_pivot);
 }
 
 template <typename I, typename T>
@@ -2414,6 +2789,183 @@ void host_hybmv(rocsparse_operation  trans,
  *    level 3 SPARSE
  * ===========================================================================
  */
+// Computes block row i and column j of C = alpha * A * op(B) + beta * C for a block dimension
+// BSR_DIM that is known at compile time. inc_B is the stride between consecutive rows of op(B).
+template <rocsparse_int BSR_DIM, rocsparse_direction DIR, typename T>
+static void host_bsrmm_block_row(rocsparse_int        i,
+                                 rocsparse_int        j,
+                                 T                    alpha,
+                                 const rocsparse_int* bsr_row_ptr_A,
+                                 const rocsparse_int* bsr_col_ind_A,
+                                 const T*             bsr_val_A,
+                                 rocsparse_int        block_dim,
+                                 const T*             B,
+                                 int64_t              offset_B,
+                                 int64_t              inc_B,
+                                 T                    beta,
+                                 T*                   C,
+                                 int64_t              ldc,
+                                 rocsparse_index_base base)
+{
+    T sum[BSR_DIM];
+
+    for(rocsparse_int r = 0; r < BSR_DIM; ++r)
+    {
+        sum[r] = static_cast<T>(0);
+    }
+
+    rocsparse_int row_begin = bsr_row_ptr_A[i] - base;
+    rocsparse_int row_end   = bsr_row_ptr_A[i + 1] - base;
+
+    for(rocsparse_int s = row_begin; s < row_end; s++)
+    {
+        int64_t col = bsr_col_ind_A[s] - base;
+
+        const T* val = bsr_val_A + static_cast<int64_t>(BSR_DIM * BSR_DIM) * s;
+        const T* b   = B + offset_B + BSR_DIM * col * inc_B;
+
+        for(rocsparse_int t = 0; t < BSR_DIM; t++)
+        {
+            T bt = b[t * inc_B];
+
+            for(rocsparse_int r = 0; r < BSR_DIM; ++r)
+            {
+                T a = (DIR == rocsparse_direction_row) ? val[BSR_DIM * r + t]
+                                                       : val[BSR_DIM * t + r];
+
+                sum[r] = std::fma(a, bt, sum[r]);
+            }
+        }
+    }
+
+    T* c = C + ldc * j + BSR_DIM * i;
+
+    for(rocsparse_int r = 0; r < BSR_DIM; ++r)
+    {
+        if(beta == static_cast<T>(0))
+        {
+            c[r] = alpha * sum[r];
+        }
+        else
+        {
+            c[r] = std::fma(beta, c[r], alpha * sum[r]);
+        }
+    }
+}
+
+// Generic fallback of host_bsrmm_block_row, for block dimensions that are only known at run
+// time.
+template <rocsparse_direction DIR, typename T>
+static void host_bsrmm_block_row_general(rocsparse_int        i,
+                                         rocsparse_int        j,
+                                         T                    alpha,
+                                         const rocsparse_int* bsr_row_ptr_A,
+                                         const rocsparse_int* bsr_col_ind_A,
+                                         const T*             bsr_val_A,
+                                         rocsparse_int        block_dim,
+                                         const T*             B,
+                                         int64_t              offset_B,
+                                         int64_t              inc_B,
+                                         T                    beta,
+                                         T*                   C,
+                                         int64_t              ldc,
+                                         rocsparse_index_base base)
+{
+    rocsparse_int row_begin = bsr_row_ptr_A[i] - base;
+    rocsparse_int row_end   = bsr_row_ptr_A[i + 1] - base;
+
+    for(rocsparse_int r = 0; r < block_dim; ++r)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int s = row_begin; s < row_end; s++)
+        {
+            for(rocsparse_int t = 0; t < block_dim; t++)
+            {
+                int64_t idx_A = (DIR == rocsparse_direction_row)
+                                    ? block_dim * block_dim * s + block_dim * r + t
+                                    : block_dim * block_dim * s + block_dim * t + r;
+                int64_t idx_B
+                    = offset_B + (block_dim * (bsr_col_ind_A[s] - base) + t) * inc_B;
+
+                sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
+            }
+        }
+
+        int64_t idx_C = ldc * j + block_dim * i + r;
+
+        if(beta == static_cast<T>(0))
+        {
+            C[idx_C] = alpha * sum;
+        }
+        else
+        {
+            C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+        }
+    }
+}
+
+template <typename T>
+using host_bsrmm_kernel_t = void (*)(rocsparse_int,
+                                     rocsparse_int,
+                                     T,
+                                     const rocsparse_int*,
+                                     const rocsparse_int*,
+                                     const T*,
+                                     rocsparse_int,
+                                     const T*,
+                                     int64_t,
+                                     int64_t,
+                                     T,
+                                     T*,
+                                     int64_t,
+                                     rocsparse_index_base);
+
+// Selects the host BSR SpMM kernel for blocks of dimension block_dim
+template <typename T>
+static host_bsrmm_kernel_t<T> host_bsrmm_kernel(rocsparse_direction dir, rocsparse_int block_dim)
+{
+    static constexpr host_bsrmm_kernel_t<T> table[2][host_bsr_kernel_table_size]
+        = {{host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row<2, rocsparse_direction_row>,
+            host_bsrmm_block_row<3, rocsparse_direction_row>,
+            host_bsrmm_block_row<4, rocsparse_direction_row>,
+            host_bsrmm_block_row<5, rocsparse_direction_row>,
+            host_bsrmm_block_row<6, rocsparse_direction_row>,
+            host_bsrmm_block_row<7, rocsparse_direction_row>,
+            host_bsrmm_block_row<8, rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row_general<rocsparse_direction_row>,
+            host_bsrmm_block_row<16, rocsparse_direction_row>},
+           {host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row<2, rocsparse_direction_column>,
+            host_bsrmm_block_row<3, rocsparse_direction_column>,
+            host_bsrmm_block_row<4, rocsparse_direction_column>,
+            host_bsrmm_block_row<5, rocsparse_direction_column>,
+            host_bsrmm_block_row<6, rocsparse_direction_column>,
+            host_bsrmm_block_row<7, rocsparse_direction_column>,
+            host_bsrmm_block_row<8, rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row_general<rocsparse_direction_column>,
+            host_bsrmm_block_row<16, rocsparse_direction_column>}};
+
+    const int d = (dir == rocsparse_direction_row) ? 0 : 1;
+
+    return (block_dim < host_bsr_kernel_table_size) ? table[d][block_dim] : table[d][0];
+}
+
 template <typename T>
 void host_bsrmm(rocsparse_handle          handle,
                 rocsparse_direction       dir,
@@ -2447,48 +2999,37 @@ void host_bsrmm(rocsparse_handle          handle,
         return;
     }
 
-    rocsparse_int M = Mb * block_dim;
+    host_bsrmm_kernel_t<T> kernel = host_bsrmm_kernel<T>(dir, block_dim);
+
+    // Rows of op(B) are either contiguous or ldb apart
+    int64_t inc_B = (transB == rocsparse_operation_none) ? 1 : ldb;
+
+    int64_t size = static_cast<int64_t>(Mb) * N;
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int i = 0; i < M; i++)
-    {
-        rocsparse_int local_row = i % block_dim;
-
-        rocsparse_int row_begin = bsr_row_ptr_A[i / block_dim] - base;
-        rocsparse_int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
-
-        for(rocsparse_int j = 0; j < N; j++)
-        {
-            int64_t idx_C = i + j * ldc;
-
-            T sum = static_cast<T>(0);
-
-            for(rocsparse_int s = row_begin; s < row_end; s++)
-            {
-                for(rocsparse_int t = 0; t < block_dim; t++)
-                {
-                    int64_t idx_A = (dir == rocsparse_direction_row)
-                                        ? block_dim * block_dim * s + block_dim * local_row + t
-                                        : block_dim * block_dim * s + block_dim * t + local_row;
-                    int64_t idx_B = (transB == rocsparse_operation_none)
-                                        ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
-                                        : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
-
-                    sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
-                }
-            }
-
-            if(*beta == static_cast<T>(0))
-            {
-                C[idx_C] = *alpha * sum;
-            }
-            else
-            {
-                C[idx_C] = std::fma(*beta, C[idx_C], *alpha * sum);
-            }
-        }
+    for(int64_t idx = 0; idx < size; idx++)
+    {
+        rocsparse_int i = idx % Mb;
+        rocsparse_int j = idx / Mb;
+
+        int64_t offset_B = (transB == rocsparse_operation_none) ? j * ldb : j;
+
+        kernel(i,
+               j,
+               *alpha,
+               bsr_row_ptr_A,
+               bsr_col_ind_A,
+               bsr_val_A,
+               block_dim,
+               B,
+               offset_B,
+               inc_B,
+               *beta,
+               C,
+               ldc,
+               base);
     }
 }
 
@@ -2563,22 +3104,422 @@ void host_gebsrmm(rocsparse_handle          handle,
                               : (col_block_dim * (bsr_col_ind_A[at] - base) + col_local_idx) * ldb
                                     + col_idx;
 
-                    sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
-                }
+                    sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
+                }
+            }
+
+            if(*beta == static_cast<T>(0))
+            {
+                C[idx_C] = *alpha * sum;
+            }
+            else
+            {
+                C[idx_C] = std::fma(*beta, C[idx_C], *alpha * sum);
+            }
+        }
+    }
+}
+
+// Maximum number of columns of B and C that are processed at once by the host SpMM kernels
+static constexpr int csrmm_tile_size = 16;
+
+// Computes a tile of NT consecutive columns j, ..., j + NT - 1 of row i of C = alpha * A * op(B)
+// + beta * C. B_ROW and C_ROW indicate whether the columns of op(B) and C are contiguous in
+// memory, such that the tile can be accessed with unit stride.
+template <int NT, bool B_ROW, bool C_ROW, typename T, typename I, typename J>
+static inline void host_csrmm_row_tile(J                    i,
+                                       J                    j,
+                                       T                    alpha,
+                                       const I*             csr_row_ptr_A,
+                                       const J*             csr_col_ind_A,
+                                       const T*             csr_val_A,
+                                       const T*             B,
+                                       int64_t              ldb,
+                                       T                    beta,
+                                       T*                   C,
+                                       int64_t              ldc,
+                                       rocsparse_index_base base,
+                                       bool                 conj_A,
+                                       bool                 conj_B)
+{
+    const int64_t inc_B = B_ROW ? 1 : ldb;
+    const int64_t inc_C = C_ROW ? 1 : ldc;
+
+    T sum[NT];
+
+    for(int t = 0; t < NT; ++t)
+    {
+        sum[t] = static_cast<T>(0);
+    }
+
+    I row_begin = csr_row_ptr_A[i] - base;
+    I row_end   = csr_row_ptr_A[i + 1] - base;
+
+    for(I k = row_begin; k < row_end; ++k)
+    {
+        int64_t col = csr_col_ind_A[k] - base;
+        T       val = conj_val(csr_val_A[k], conj_A);
+
+        const T* b = B_ROW ? B + col * ldb + j : B + col + j * ldb;
+
+        for(int t = 0; t < NT; ++t)
+        {
+            sum[t] = std::fma(val, conj_val(b[t * inc_B], conj_B), sum[t]);
+        }
+    }
+
+    T* c = C_ROW ? C + i * ldc + j : C + i + j * ldc;
+
+    if(beta == static_cast<T>(0))
+    {
+        for(int t = 0; t < NT; ++t)
+        {
+            c[t * inc_C] = alpha * sum[t];
+        }
+    }
+    else
+    {
+        for(int t = 0; t < NT; ++t)
+        {
+            c[t * inc_C] = std::fma(beta, c[t * inc_C], alpha * sum[t]);
+        }
+    }
+}
+
+// Computes row i of C = alpha * A * op(B) + beta * C using tiles of 16, 8, 4 and 1 columns
+template <bool B_ROW, bool C_ROW, typename T, typename I, typename J>
+static void host_csrmm_row(J                    i,
+                           J                    N,
+                           T                    alpha,
+                           const I*             csr_row_ptr_A,
+                           const J*             csr_col_ind_A,
+                           const T*             csr_val_A,
+                           const T*             B,
+                           int64_t              ldb,
+                           T                    beta,
+                           T*                   C,
+                           int64_t              ldc,
+                           rocsparse_index_base base,
+                           bool                 conj_A,
+                           bool                 conj_B)
+{
+    J j = 0;
+
+    for(; j + csrmm_tile_size <= N; j += csrmm_tile_size)
+    {
+        host_csrmm_row_tile<csrmm_tile_size, B_ROW, C_ROW>(i,
+                                                           j,
+                                                           alpha,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           csr_val_A,
+                                                           B,
+                                                           ldb,
+                                                           beta,
+                                                           C,
+                                                           ldc,
+                                                           base,
+                                                           conj_A,
+                                                           conj_B);
+    }
+
+    if(j + 8 <= N)
+    {
+        host_csrmm_row_tile<8, B_ROW, C_ROW>(i,
+                                             j,
+                                             alpha,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             csr_val_A,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc,
+                                             base,
+                                             conj_A,
+                                             conj_B);
+        j += 8;
+    }
+
+    if(j + 4 <= N)
+    {
+        host_csrmm_row_tile<4, B_ROW, C_ROW>(i,
+                                             j,
+                                             alpha,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             csr_val_A,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc,
+                                             base,
+                                             conj_A,
+                                             conj_B);
+        j += 4;
+    }
+
+    for(; j < N; ++j)
+    {
+        host_csrmm_row_tile<1, B_ROW, C_ROW>(i,
+                                             j,
+                                             alpha,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             csr_val_A,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc,
+                                             base,
+                                             conj_A,
+                                             conj_B);
+    }
+}
+
+// Accumulates alpha * A^T * op(B) into the NT consecutive columns j, ..., j + NT - 1 of C.
+// Each tile of columns of C is owned by a single thread, such that no atomics are required.
+template <int NT, bool B_ROW, bool C_ROW, typename T, typename I, typename J>
+static inline void host_csrmm_trans_tile(J                    M,
+                                         J                    j,
+                                         T                    alpha,
+                                         const I*             csr_row_ptr_A,
+                                         const J*             csr_col_ind_A,
+                                         const T*             csr_val_A,
+                                         const T*             B,
+                                         int64_t              ldb,
+                                         T*                   C,
+                                         int64_t              ldc,
+                                         rocsparse_index_base base,
+                                         bool                 conj_A,
+                                         bool                 conj_B)
+{
+    const int64_t inc_B = B_ROW ? 1 : ldb;
+    const int64_t inc_C = C_ROW ? 1 : ldc;
+
+    for(J i = 0; i < M; ++i)
+    {
+        const T* b = B_ROW ? B + i * ldb + j : B + i + j * ldb;
+
+        T b_tile[NT];
+
+        for(int t = 0; t < NT; ++t)
+        {
+            b_tile[t] = conj_val(b[t * inc_B], conj_B);
+        }
+
+        I row_begin = csr_row_ptr_A[i] - base;
+        I row_end   = csr_row_ptr_A[i + 1] - base;
+
+        for(I k = row_begin; k < row_end; ++k)
+        {
+            int64_t col = csr_col_ind_A[k] - base;
+            T       val = conj_val(csr_val_A[k], conj_A);
+
+            T* c = C_ROW ? C + col * ldc + j : C + col + j * ldc;
+
+            for(int t = 0; t < NT; ++t)
+            {
+                c[t * inc_C] += alpha * val * b_tile[t];
+            }
+        }
+    }
+}
+
+// Batched SpMM for a given memory layout of op(B) and C. Work is distributed across batches
+// and rows of C (non-transposed A) or batches and column tiles of C (transposed A).
+template <bool B_ROW, bool C_ROW, typename T, typename I, typename J>
+static void host_csrmm_layout(J                    M,
+                              J                    N,
+                              J                    K,
+                              J                    batch_count,
+                              int64_t              offsets_batch_stride_A,
+                              int64_t              columns_values_batch_stride_A,
+                              rocsparse_operation  transA,
+                              T                    alpha,
+                              const I*             csr_row_ptr_A,
+                              const J*             csr_col_ind_A,
+                              const T*             csr_val_A,
+                              const T*             B,
+                              int64_t              ldb,
+                              int64_t              batch_stride_B,
+                              T                    beta,
+                              T*                   C,
+                              int64_t              ldc,
+                              int64_t              batch_stride_C,
+                              rocsparse_index_base base,
+                              bool                 conj_A,
+                              bool                 conj_B)
+{
+    if(transA == rocsparse_operation_none)
+    {
+        int64_t nrows = static_cast<int64_t>(batch_count) * M;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+        for(int64_t r = 0; r < nrows; ++r)
+        {
+            int64_t batch = r / M;
+            J       i     = static_cast<J>(r % M);
+
+            host_csrmm_row<B_ROW, C_ROW>(i,
+                                         N,
+                                         alpha,
+                                         csr_row_ptr_A + offsets_batch_stride_A * batch,
+                                         csr_col_ind_A + columns_values_batch_stride_A * batch,
+                                         csr_val_A + columns_values_batch_stride_A * batch,
+                                         B + batch_stride_B * batch,
+                                         ldb,
+                                         beta,
+                                         C + batch_stride_C * batch,
+                                         ldc,
+                                         base,
+                                         conj_A,
+                                         conj_B);
+        }
+    }
+    else
+    {
+        // scale C by beta
+        int64_t nrows = static_cast<int64_t>(batch_count) * K;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int64_t r = 0; r < nrows; ++r)
+        {
+            int64_t batch = r / K;
+            int64_t i     = r % K;
+
+            T* c = C + batch_stride_C * batch;
+
+            for(J j = 0; j < N; ++j)
+            {
+                int64_t idx_C = C_ROW ? i * ldc + j : i + j * ldc;
+                c[idx_C]      = beta * c[idx_C];
             }
+        }
 
-            if(*beta == static_cast<T>(0))
+        J       ntiles = (N - 1) / csrmm_tile_size + 1;
+        int64_t nwork  = (N == 0) ? 0 : static_cast<int64_t>(batch_count) * ntiles;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t w = 0; w < nwork; ++w)
+        {
+            int64_t batch = w / ntiles;
+            J       j     = static_cast<J>(w % ntiles) * csrmm_tile_size;
+
+            const I* row_ptr = csr_row_ptr_A + offsets_batch_stride_A * batch;
+            const J* col_ind = csr_col_ind_A + columns_values_batch_stride_A * batch;
+            const T* val     = csr_val_A + columns_values_batch_stride_A * batch;
+            const T* b       = B + batch_stride_B * batch;
+            T*       c       = C + batch_stride_C * batch;
+
+            if(j + csrmm_tile_size <= N)
             {
-                C[idx_C] = *alpha * sum;
+                host_csrmm_trans_tile<csrmm_tile_size, B_ROW, C_ROW>(
+                    M, j, alpha, row_ptr, col_ind, val, b, ldb, c, ldc, base, conj_A, conj_B);
             }
             else
             {
-                C[idx_C] = std::fma(*beta, C[idx_C], *alpha * sum);
+                for(; j < N; ++j)
+                {
+                    host_csrmm_trans_tile<1, B_ROW, C_ROW>(
+                        M, j, alpha, row_ptr, col_ind, val, b, ldb, c, ldc, base, conj_A, conj_B);
+                }
             }
         }
     }
 }
 
+template <typename T, typename I, typename J>
+static void host_csrmm_strided(J                    M,
+                               J                    N,
+                               J                    K,
+                               J                    batch_count,
+                               int64_t              offsets_batch_stride_A,
+                               int64_t              columns_values_batch_stride_A,
+                               rocsparse_operation  transA,
+                               rocsparse_operation  transB,
+                               T                    alpha,
+                               const I*             csr_row_ptr_A,
+                               const J*             csr_col_ind_A,
+                               const T*             csr_val_A,
+                               const T*             B,
+                               int64_t              ldb,
+                               int64_t              batch_stride_B,
+                               rocsparse_order      order_B,
+                               T                    beta,
+                               T*                   C,
+                               int64_t              ldc,
+                               int64_t              batch_stride_C,
+                               rocsparse_order      order_C,
+                               rocsparse_index_base base,
+                               bool                 force_conj_A)
+{
+    bool conj_A = (transA == rocsparse_operation_conjugate_transpose || force_conj_A);
+    bool conj_B = (transB == rocsparse_operation_conjugate_transpose);
+
+    // Columns of op(B) are contiguous if op(B) is stored in row major order
+    bool B_row = (transB == rocsparse_operation_none) ? (order_B == rocsparse_order_row)
+                                                      : (order_B == rocsparse_order_column);
+    bool C_row = (order_C == rocsparse_order_row);
+
+#define HOST_CSRMM_LAYOUT(B_ROW, C_ROW)                            \
+    host_csrmm_layout<B_ROW, C_ROW>(M,                             \
+                                    N,                             \
+                                    K,                             \
+                                    batch_count,                   \
+                                    offsets_batch_stride_A,        \
+                                    columns_values_batch_stride_A, \
+                                    transA,                        \
+                                    alpha,                         \
+                                    csr_row_ptr_A,                 \
+                                    csr_col_ind_A,                 \
+                                    csr_val_A,                     \
+                                    B,                             \
+                                    ldb,                           \
+                                    batch_stride_B,                \
+                                    beta,                          \
+                                    C,                             \
+                                    ldc,                           \
+                                    batch_stride_C,                \
+                                    base,                          \
+                                    conj_A,                        \
+                                    conj_B)
+
+    if(B_row)
+    {
+        if(C_row)
+        {
+            HOST_CSRMM_LAYOUT(true, true);
+        }
+        else
+        {
+            HOST_CSRMM_LAYOUT(true, false);
+        }
+    }
+    else
+    {
+        if(C_row)
+        {
+            HOST_CSRMM_LAYOUT(false, true);
+        }
+        else
+        {
+            HOST_CSRMM_LAYOUT(false, false);
+        }
+    }
+
+#undef HOST_CSRMM_LAYOUT
+}
+
 template <typename T, typename I, typename J>
 void host_csrmm(J                    M,
                 J                    N,
@@ -2599,102 +3540,29 @@ void host_csrmm(J                    M,
                 rocsparse_index_base base,
                 bool                 force_conj_A)
 {
-    bool conj_A = (transA == rocsparse_operation_conjugate_transpose || force_conj_A);
-    bool conj_B = (transB == rocsparse_operation_conjugate_transpose);
-
-    if(transA == rocsparse_operation_none)
-    {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(J i = 0; i < M; i++)
-        {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
-
-            for(J j = 0; j < N; ++j)
-            {
-                T sum = static_cast<T>(0);
-
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    int64_t idx_B = 0;
-                    if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                       || (transB == rocsparse_operation_transpose
-                           && order_B == rocsparse_order_row)
-                       || (transB == rocsparse_operation_conjugate_transpose
-                           && order_B == rocsparse_order_row))
-                    {
-                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
-                    }
-
-                    sum = std::fma(conj_val(csr_val_A[k], conj_A), conj_val(B[idx_B], conj_B), sum);
-                }
-
-                int64_t idx_C = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
-
-                if(beta == static_cast<T>(0))
-                {
-                    C[idx_C] = alpha * sum;
-                }
-                else
-                {
-                    C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
-                }
-            }
-        }
-    }
-    else
-    {
-        // scale C by beta
-        for(J i = 0; i < K; i++)
-        {
-            for(J j = 0; j < N; ++j)
-            {
-                int64_t idx_C = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
-                C[idx_C]      = beta * C[idx_C];
-            }
-        }
-
-        for(J i = 0; i < M; i++)
-        {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
-
-            for(J j = 0; j < N; ++j)
-            {
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    J col = csr_col_ind_A[k] - base;
-                    T val = conj_val(csr_val_A[k], conj_A);
-
-                    int64_t idx_B = 0;
-
-                    if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                       || (transB == rocsparse_operation_transpose
-                           && order_B == rocsparse_order_row)
-                       || (transB == rocsparse_operation_conjugate_transpose
-                           && order_B == rocsparse_order_row))
-                    {
-                        idx_B = (i + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + i * ldb);
-                    }
-
-                    int64_t idx_C
-                        = (order_C == rocsparse_order_column) ? col + j * ldc : col * ldc + j;
-
-                    C[idx_C] += alpha * val * conj_val(B[idx_B], conj_B);
-                }
-            }
-        }
-    }
+    host_csrmm_strided(M,
+                       N,
+                       K,
+                       static_cast<J>(1),
+                       0,
+                       0,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       B,
+                       ldb,
+                       0,
+                       order_B,
+                       beta,
+                       C,
+                       ldc,
+                       0,
+                       order_C,
+                       base,
+                       force_conj_A);
 }
 
 template <typename T, typename I, typename J>
@@ -2733,78 +3601,40 @@ void host_csrmm_batched(J                    M,
         return;
     }
 
+    // A shared matrix A or B is expressed by a batch stride of zero
     if(Ci_A_Bi)
     {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A,
-                       csr_col_ind_A,
-                       csr_val_A,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
-        }
+        offsets_batch_stride_A        = 0;
+        columns_values_batch_stride_A = 0;
     }
     else if(Ci_Ai_B)
     {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
-        }
+        batch_stride_B = 0;
     }
-    else if(Ci_Ai_Bi)
-    {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
+
+    host_csrmm_strided(M,
                        N,
                        K,
+                       batch_count_C,
+                       offsets_batch_stride_A,
+                       columns_values_batch_stride_A,
                        transA,
                        transB,
                        alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B + batch_stride_B * i,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       B,
                        ldb,
+                       batch_stride_B,
                        order_B,
                        beta,
-                       C + batch_stride_C * i,
+                       C,
                        ldc,
+                       batch_stride_C,
                        order_C,
                        base,
                        force_conj_A);
-        }
-    }
 }
 
 template <typename T, typename I>
@@ -3228,209 +4058,59 @@ void host_cscmm_batched(J                    M,
 }
 
 template <typename I, typename J, typename T>
-static inline void host_lssolve(J                    M,
-                                J                    nrhs,
-                                rocsparse_operation  transB,
-                                T                    alpha,
-                                const I*             csr_row_ptr,
-                                const J*             csr_col_ind,
-                                const T*             csr_val,
-                                T*                   B,
-                                int64_t              ldb,
-                                rocsparse_order      order_B,
-                                rocsparse_diag_type  diag_type,
-                                rocsparse_index_base base,
-                                J*                   struct_pivot,
-                                J*                   numeric_pivot)
-{
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
-        {
-            int64_t idx_B
-                = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            T sum = static_cast<T>(0);
-            if(transB == rocsparse_operation_conjugate_transpose)
-            {
-                sum = alpha * rocsparse_conj(B[idx_B]);
-            }
-            else
-            {
-                sum = alpha * B[idx_B];
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = static_cast<T>(0);
-
-            for(I j = row_begin; j < row_end; ++j)
-            {
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                if(local_val == static_cast<T>(0) && local_col == row
-                   && diag_type == rocsparse_diag_type_non_unit)
-                {
-                    // Numerical zero pivot found, avoid division by 0 and store
-                    // index for later use
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = static_cast<T>(1);
-                }
-
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
-
-                    break;
-                }
-
-                // Lower triangular part
-                int64_t idx
-                    = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                          ? i * ldb + local_col
-                          : local_col * ldb + i;
-
-                sum = std::fma(-local_val, B[idx], sum);
-            }
-
-            if(diag_type == rocsparse_diag_type_non_unit)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
-
-                B[idx_B] = sum * diag_val;
-            }
-            else
-            {
-                B[idx_B] = sum;
-            }
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-static inline void host_ussolve(J                    M,
-                                J                    nrhs,
-                                rocsparse_operation  transB,
-                                T                    alpha,
-                                const I*             csr_row_ptr,
-                                const J*             csr_col_ind,
-                                const T*             csr_val,
-                                T*                   B,
-                                int64_t              ldb,
-                                rocsparse_order      order_B,
-                                rocsparse_diag_type  diag_type,
-                                rocsparse_index_base base,
-                                J*                   struct_pivot,
-                                J*                   numeric_pivot)
+void host_csrsm(const host_trm_info<I, J>& info,
+                J                          nrhs,
+                rocsparse_operation        transB,
+                T                          alpha,
+                const I*                   csr_row_ptr,
+                const J*                   csr_col_ind,
+                const T*                   csr_val,
+                T*                         B,
+                int64_t                    ldb,
+                rocsparse_order            order_B,
+                rocsparse_diag_type        diag_type,
+                rocsparse_index_base       base,
+                J*                         struct_pivot,
+                J*                         numeric_pivot)
 {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
-        {
-            int64_t idx_B
-                = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            T sum = static_cast<T>(0);
-            if(transB == rocsparse_operation_conjugate_transpose)
-            {
-                sum = alpha * rocsparse_conj(B[idx_B]);
-            }
-            else
-            {
-                sum = alpha * B[idx_B];
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = static_cast<T>(0);
+    const J M = info.m;
 
-            for(I j = row_end - 1; j >= row_begin; --j)
-            {
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        // Check for numerical zero
-                        if(local_val == static_cast<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = static_cast<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+    // Initialize pivot
+    *struct_pivot  = M + 1;
+    *numeric_pivot = M + 1;
 
-                    continue;
-                }
+    if(nrhs > 0)
+    {
+        // B is solved in-place, determine strides between rows and right-hand sides
+        bool col_major
+            = (transB == rocsparse_operation_none && order_B == rocsparse_order_column);
 
-                // Upper triangular part
-                int64_t idx
-                    = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                          ? i * ldb + local_col
-                          : local_col * ldb + i;
+        int64_t inc = col_major ? 1 : ldb;
+        int64_t ld  = col_major ? ldb : 1;
 
-                sum = std::fma(-local_val, B[idx], sum);
-            }
+        host_trm_solve(info,
+                       nrhs,
+                       alpha,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       B,
+                       inc,
+                       ld,
+                       transB == rocsparse_operation_conjugate_transpose,
+                       B,
+                       inc,
+                       ld,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+    }
 
-            if(diag_type == rocsparse_diag_type_non_unit)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
 
-                B[idx_B] = sum * diag_val;
-            }
-            else
-            {
-                B[idx_B] = sum;
-            }
-        }
-    }
+    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
 template <typename I, typename J, typename T>
@@ -3516,115 +4196,23 @@ void host_csrsm(J                    M,
     }
     else
     {
-        // Initialize pivot
-        *struct_pivot  = M + 1;
-        *numeric_pivot = M + 1;
-
-        if(transA == rocsparse_operation_none)
-        {
-            if(fill_mode == rocsparse_fill_mode_lower)
-            {
-                host_lssolve(M,
-                             nrhs,
-                             transB,
-                             alpha,
-                             csr_row_ptr,
-                             csr_col_ind,
-                             csr_val,
-                             B,
-                             ldb,
-                             order_B,
-                             diag_type,
-                             base,
-                             struct_pivot,
-                             numeric_pivot);
-            }
-            else
-            {
-                host_ussolve(M,
-                             nrhs,
-                             transB,
-                             alpha,
-                             csr_row_ptr,
-                             csr_col_ind,
-                             csr_val,
-                             B,
-                             ldb,
-                             order_B,
-                             diag_type,
-                             base,
-                             struct_pivot,
-                             numeric_pivot);
-            }
-        }
-        else if(transA == rocsparse_operation_transpose
-                || transA == rocsparse_operation_conjugate_transpose)
-        {
-            // Transpose matrix
-            std::vector<I> csrt_row_ptr(M + 1);
-            std::vector<J> csrt_col_ind(nnz);
-            std::vector<T> csrt_val(nnz);
-
-            host_csr_to_csc<I, J, T>(M,
-                                     M,
-                                     nnz,
-                                     csr_row_ptr,
-                                     csr_col_ind,
-                                     csr_val,
-                                     csrt_col_ind,
-                                     csrt_row_ptr,
-                                     csrt_val,
-                                     rocsparse_action_numeric,
-                                     base);
-
-            if(transA == rocsparse_operation_conjugate_transpose)
-            {
-                for(size_t i = 0; i < csrt_val.size(); i++)
-                {
-                    csrt_val[i] = rocsparse_conj(csrt_val[i]);
-                }
-            }
+        host_trm_info<I, J> info;
+        host_trm_analysis(transA, M, nnz, csr_row_ptr, csr_col_ind, fill_mode, base, info);
 
-            if(fill_mode == rocsparse_fill_mode_lower)
-            {
-                host_ussolve(M,
-                             nrhs,
-                             transB,
-                             alpha,
-                             csrt_row_ptr.data(),
-                             csrt_col_ind.data(),
-                             csrt_val.data(),
-                             B,
-                             ldb,
-                             order_B,
-                             diag_type,
-                             base,
-                             struct_pivot,
-                             numeric_pivot);
-            }
-            else
-            {
-                host_lssolve(M,
-                             nrhs,
-                             transB,
-                             alpha,
-                             csrt_row_ptr.data(),
-                             csrt_col_ind.data(),
-                             csrt_val.data(),
-                             B,
-                             ldb,
-                             order_B,
-                             diag_type,
-                             base,
-                             struct_pivot,
-                             numeric_pivot);
-            }
-        }
-
-        *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-        *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
-        *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+        host_csrsm(info,
+                   nrhs,
+                   transB,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val,
+                   B,
+                   ldb,
+                   order_B,
+                   diag_type,
+                   base,
+                   struct_pivot,
+                   numeric_pivot);
     }
 }
 
@@ -4700,6 +5288,277 @@ void host_csrgeam(rocsparse_int        M,
     }
 }
 
+// Thread local scratch memory of the host SpGEMM, re-used across all rows processed
+// by a thread.
+template <typename I, typename J, typename T>
+struct host_csrgemm_scratch
+{
+    // Columns and values of the current row, in order of first appearance
+    std::vector<J> col;
+    std::vector<T> val;
+    std::vector<J> perm;
+
+    // Open addressing hash table, mapping columns to positions in col / val
+    std::vector<J> hash_key;
+    std::vector<J> hash_pos;
+
+    // Dense marker array of size N, mapping columns to positions in col / val
+    std::vector<J> dense_pos;
+};
+
+// Accumulator selection thresholds of the host SpGEMM. Rows with at most
+// csrgemm_merge_max_products intermediate products are accumulated by sorting and
+// merging the products. Longer rows use a hash table, unless the number of products
+// exceeds N / csrgemm_dense_ratio, in which case a dense marker array is used.
+static constexpr int64_t csrgemm_merge_max_products = 32;
+static constexpr int64_t csrgemm_dense_ratio        = 16;
+
+// Computes row i of C = alpha * A * B + beta * D. If NUMERIC is false, only the number
+// of non-zero entries of the row is determined. Otherwise, the sorted column indices
+// and values are written to csr_col_ind_C and csr_val_C.
+template <bool NUMERIC, typename T, typename I, typename J>
+static J host_csrgemm_row(J                              i,
+                          J                              N,
+                          const T*                       alpha,
+                          const I*                       csr_row_ptr_A,
+                          const J*                       csr_col_ind_A,
+                          const T*                       csr_val_A,
+                          const I*                       csr_row_ptr_B,
+                          const J*                       csr_col_ind_B,
+                          const T*                       csr_val_B,
+                          const T*                       beta,
+                          const I*                       csr_row_ptr_D,
+                          const J*                       csr_col_ind_D,
+                          const T*                       csr_val_D,
+                          J*                             csr_col_ind_C,
+                          T*                             csr_val_C,
+                          rocsparse_index_base           base_A,
+                          rocsparse_index_base           base_B,
+                          rocsparse_index_base           base_C,
+                          rocsparse_index_base           base_D,
+                          host_csrgemm_scratch<I, J, T>& scratch)
+{
+    // Upper bound of intermediate products of this row
+    int64_t nprod = 0;
+
+    if(alpha)
+    {
+        for(I j = csr_row_ptr_A[i] - base_A; j < csr_row_ptr_A[i + 1] - base_A; ++j)
+        {
+            J col_A = csr_col_ind_A[j] - base_A;
+            nprod += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+        }
+    }
+
+    if(beta)
+    {
+        nprod += csr_row_ptr_D[i + 1] - csr_row_ptr_D[i];
+    }
+
+    std::vector<J>& col = scratch.col;
+    std::vector<T>& val = scratch.val;
+
+    col.clear();
+    val.clear();
+
+    // Visit all intermediate products in the order of the reference implementation,
+    // such that values of the same column are summed up in the same order
+    auto visit = [&](auto&& insert) {
+        if(alpha)
+        {
+            for(I j = csr_row_ptr_A[i] - base_A; j < csr_row_ptr_A[i + 1] - base_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - base_A;
+                T val_A = NUMERIC ? *alpha * csr_val_A[j] : static_cast<T>(0);
+
+                for(I k = csr_row_ptr_B[col_A] - base_B; k < csr_row_ptr_B[col_A + 1] - base_B;
+                    ++k)
+                {
+                    insert(csr_col_ind_B[k] - base_B,
+                           NUMERIC ? val_A * csr_val_B[k] : static_cast<T>(0));
+                }
+            }
+        }
+
+        if(beta)
+        {
+            for(I j = csr_row_ptr_D[i] - base_D; j < csr_row_ptr_D[i + 1] - base_D; ++j)
+            {
+                insert(csr_col_ind_D[j] - base_D,
+                       NUMERIC ? *beta * csr_val_D[j] : static_cast<T>(0));
+            }
+        }
+    };
+
+    bool sorted = false;
+
+    if(nprod <= csrgemm_merge_max_products)
+    {
+        // Sorted merge, collect all products and sort them by column
+        visit([&](J c, T v) {
+            col.push_back(c);
+            if(NUMERIC)
+            {
+                val.push_back(v);
+            }
+        });
+
+        J nentries = static_cast<J>(col.size());
+
+        scratch.perm.resize(nentries);
+        for(J j = 0; j < nentries; ++j)
+        {
+            scratch.perm[j] = j;
+        }
+
+        std::stable_sort(scratch.perm.begin(), scratch.perm.end(), [&](J a, J b) {
+            return col[a] < col[b];
+        });
+
+        // Merge duplicates
+        J row_nnz  = 0;
+        J prev_col = -1;
+
+        for(J j = 0; j < nentries; ++j)
+        {
+            J p = scratch.perm[j];
+
+            if(col[p] != prev_col)
+            {
+                if(NUMERIC)
+                {
+                    csr_col_ind_C[row_nnz] = col[p] + base_C;
+                    csr_val_C[row_nnz]     = val[p];
+                }
+
+                prev_col = col[p];
+                ++row_nnz;
+            }
+            else if(NUMERIC)
+            {
+                csr_val_C[row_nnz - 1] += val[p];
+            }
+        }
+
+        return row_nnz;
+    }
+    else if(nprod * csrgemm_dense_ratio < N)
+    {
+        // Open addressing hash table with linear probing
+        int64_t hash_size = 1;
+        while(hash_size < 2 * nprod)
+        {
+            hash_size <<= 1;
+        }
+
+        const int64_t hash_mask = hash_size - 1;
+
+        scratch.hash_key.assign(hash_size, -1);
+        scratch.hash_pos.resize(hash_size);
+
+        visit([&](J c, T v) {
+            int64_t slot = (static_cast<uint64_t>(c) * 2654435761ULL) & hash_mask;
+
+            while(scratch.hash_key[slot] != -1 && scratch.hash_key[slot] != c)
+            {
+                slot = (slot + 1) & hash_mask;
+            }
+
+            if(scratch.hash_key[slot] == -1)
+            {
+                scratch.hash_key[slot] = c;
+                scratch.hash_pos[slot] = static_cast<J>(col.size());
+                col.push_back(c);
+                if(NUMERIC)
+                {
+                    val.push_back(v);
+                }
+            }
+            else if(NUMERIC)
+            {
+                val[scratch.hash_pos[slot]] += v;
+            }
+        });
+    }
+    else
+    {
+        // Dense marker array
+        scratch.dense_pos.resize(N, -1);
+
+        visit([&](J c, T v) {
+            J pos = scratch.dense_pos[c];
+
+            if(pos == -1)
+            {
+                scratch.dense_pos[c] = static_cast<J>(col.size());
+                col.push_back(c);
+                if(NUMERIC)
+                {
+                    val.push_back(v);
+                }
+            }
+            else if(NUMERIC)
+            {
+                val[pos] += v;
+            }
+        });
+
+        J row_nnz = static_cast<J>(col.size());
+
+        if(NUMERIC && static_cast<int64_t>(row_nnz) * csrgemm_dense_ratio >= N)
+        {
+            // Row is dense enough to extract the sorted columns by scanning all markers
+            J k = 0;
+            for(J c = 0; c < N; ++c)
+            {
+                J pos = scratch.dense_pos[c];
+
+                if(pos != -1)
+                {
+                    csr_col_ind_C[k] = c + base_C;
+                    csr_val_C[k]     = val[pos];
+                    ++k;
+
+                    scratch.dense_pos[c] = -1;
+                }
+            }
+
+            sorted = true;
+        }
+        else
+        {
+            for(J j = 0; j < row_nnz; ++j)
+            {
+                scratch.dense_pos[col[j]] = -1;
+            }
+        }
+    }
+
+    J row_nnz = static_cast<J>(col.size());
+
+    if(NUMERIC && !sorted)
+    {
+        // Columns are unique, sort them
+        scratch.perm.resize(row_nnz);
+        for(J j = 0; j < row_nnz; ++j)
+        {
+            scratch.perm[j] = j;
+        }
+
+        std::sort(scratch.perm.begin(), scratch.perm.end(), [&](J a, J b) {
+            return col[a] < col[b];
+        });
+
+        for(J j = 0; j < row_nnz; ++j)
+        {
+            csr_col_ind_C[j] = col[scratch.perm[j]] + base_C;
+            csr_val_C[j]     = val[scratch.perm[j]];
+        }
+    }
+
+    return row_nnz;
+}
+
 template <typename T, typename I, typename J>
 void host_csrgemm_nnz(J                    M,
                       J                    N,
@@ -4732,110 +5591,67 @@ void host_csrgemm_nnz(J                    M,
         return;
     }
     else if(alpha && !beta && (K == 0))
-    {
-        *nnz_C = 0;
-        if(M > 0)
-        {
-            for(J i = 0; i <= M; ++i)
-            {
-                csr_row_ptr_C[i] = base_C;
-            }
-        }
-        return;
-    }
-    else if(!alpha && !beta)
-    {
-        *nnz_C = 0;
-        if(M > 0)
-        {
-            for(J i = 0; i <= M; ++i)
-            {
-                csr_row_ptr_C[i] = base_C;
-            }
-        }
-        return;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<J> nnz(N, -1);
-
-        int nthreads = 1;
-        int tid      = 0;
-
-#ifdef _OPENMP
-        nthreads = omp_get_num_threads();
-        tid      = omp_get_thread_num();
-#endif
-
-        J rows_per_thread = (M + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
-
-        // Index base
-        csr_row_ptr_C[0] = base_C;
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
-        {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
-
-            if(alpha)
-            {
-                I row_begin_A = csr_row_ptr_A[i] - base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - base_A;
-
-                    I row_begin_B = csr_row_ptr_B[col_A] - base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I k = row_begin_B; k < row_end_B; ++k)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[k] - base_B;
-
-                        // Check if a new nnz is generated
-                        if(nnz[col_B] != i)
-                        {
-                            nnz[col_B] = i;
-                            ++csr_row_ptr_C[i + 1];
-                        }
-                    }
-                }
+    {
+        *nnz_C = 0;
+        if(M > 0)
+        {
+            for(J i = 0; i <= M; ++i)
+            {
+                csr_row_ptr_C[i] = base_C;
             }
-
-            // Add nnz of D if beta != 0
-            if(beta)
+        }
+        return;
+    }
+    else if(!alpha && !beta)
+    {
+        *nnz_C = 0;
+        if(M > 0)
+        {
+            for(J i = 0; i <= M; ++i)
             {
-                I row_begin_D = csr_row_ptr_D[i] - base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+                csr_row_ptr_C[i] = base_C;
+            }
+        }
+        return;
+    }
 
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    J col_D = csr_col_ind_D[j] - base_D;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        host_csrgemm_scratch<I, J, T> scratch;
 
-                    // Check if a new nnz is generated
-                    if(nnz[col_D] != i)
-                    {
-                        nnz[col_D] = i;
-                        ++csr_row_ptr_C[i + 1];
-                    }
-                }
-            }
+        // Count nnz of each row of C
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            csr_row_ptr_C[i + 1] = host_csrgemm_row<false>(i,
+                                                           N,
+                                                           alpha,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           (const T*)nullptr,
+                                                           csr_row_ptr_B,
+                                                           csr_col_ind_B,
+                                                           (const T*)nullptr,
+                                                           beta,
+                                                           csr_row_ptr_D,
+                                                           csr_col_ind_D,
+                                                           (const T*)nullptr,
+                                                           (J*)nullptr,
+                                                           (T*)nullptr,
+                                                           base_A,
+                                                           base_B,
+                                                           base_C,
+                                                           base_D,
+                                                           scratch);
         }
     }
 
     // Scan to obtain row offsets
+    csr_row_ptr_C[0] = base_C;
     for(J i = 0; i < M; ++i)
     {
         csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
@@ -4883,132 +5699,35 @@ void host_csrgemm(J                    M,
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnz(N, -1);
-
-        int nthreads = 1;
-        int tid      = 0;
+        host_csrgemm_scratch<I, J, T> scratch;
 
 #ifdef _OPENMP
-        nthreads = omp_get_num_threads();
-        tid      = omp_get_thread_num();
+#pragma omp for schedule(dynamic, 64)
 #endif
-
-        J rows_per_thread = (M + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
+        for(J i = 0; i < M; ++i)
         {
             I row_begin_C = csr_row_ptr_C[i] - base_C;
-            I row_end_C   = row_begin_C;
-
-            if(alpha)
-            {
-                I row_begin_A = csr_row_ptr_A[i] - base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - base_A;
-                    // Current value of A
-                    T val_A = *alpha * csr_val_A[j];
-
-                    I row_begin_B = csr_row_ptr_B[col_A] - base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I k = row_begin_B; k < row_end_B; ++k)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[k] - base_B;
-                        // Current value of B
-                        T val_B = csr_val_B[k];
 
-                        // Check if a new nnz is generated or if the product is appended
-                        if(nnz[col_B] < row_begin_C)
-                        {
-                            nnz[col_B]               = row_end_C;
-                            csr_col_ind_C[row_end_C] = col_B + base_C;
-                            csr_val_C[row_end_C]     = val_A * val_B;
-                            ++row_end_C;
-                        }
-                        else
-                        {
-                            csr_val_C[nnz[col_B]] += val_A * val_B;
-                        }
-                    }
-                }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
-
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    // Current column of D
-                    J col_D = csr_col_ind_D[j] - base_D;
-                    // Current value of D
-                    T val_D = *beta * csr_val_D[j];
-
-                    // Check if a new nnz is generated or if the value is added
-                    if(nnz[col_D] < row_begin_C)
-                    {
-                        nnz[col_D] = row_end_C;
-
-                        csr_col_ind_C[row_end_C] = col_D + base_C;
-                        csr_val_C[row_end_C]     = val_D;
-                        ++row_end_C;
-                    }
-                    else
-                    {
-                        csr_val_C[nnz[col_D]] += val_D;
-                    }
-                }
-            }
-        }
-    }
-
-    I nnz = csr_row_ptr_C[M] - base_C;
-
-    std::vector<J> col(nnz);
-    std::vector<T> val(nnz);
-
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(J i = 0; i < M; ++i)
-    {
-        I row_begin = csr_row_ptr_C[i] - base_C;
-        I row_end   = csr_row_ptr_C[i + 1] - base_C;
-        J row_nnz   = row_end - row_begin;
-
-        std::vector<J> perm(row_nnz);
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            perm[j] = j;
-        }
-
-        J* col_entry = col.data() + row_begin;
-        T* val_entry = val.data() + row_begin;
-
-        std::sort(perm.begin(), perm.end(), [&](const J& a, const J& b) {
-            return col_entry[a] < col_entry[b];
-        });
-
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+            host_csrgemm_row<true>(i,
+                                   N,
+                                   alpha,
+                                   csr_row_ptr_A,
+                                   csr_col_ind_A,
+                                   csr_val_A,
+                                   csr_row_ptr_B,
+                                   csr_col_ind_B,
+                                   csr_val_B,
+                                   beta,
+                                   csr_row_ptr_D,
+                                   csr_col_ind_D,
+                                   csr_val_D,
+                                   csr_col_ind_C + row_begin_C,
+                                   csr_val_C + row_begin_C,
+                                   base_A,
+                                   base_B,
+                                   base_C,
+                                   base_D,
+                                   scratch);
         }
     }
 }
@@ -5304,19 +6023,29 @@ void rocsparse_host<T, I, J>::cscddmm(rocsparse_operation  transA,
  *    precond SPARSE
  * ===========================================================================
  */
+// Updates pivot with idx if idx is smaller, -1 indicates that no pivot has been found
+static inline void host_pivot_min(rocsparse_int& pivot, rocsparse_int idx)
+{
+    if(idx != -1)
+    {
+        pivot = (pivot == -1) ? idx : std::min(pivot, idx);
+    }
+}
+
 template <typename T>
-void host_bsric0(rocsparse_direction               direction,
-                 rocsparse_int                     Mb,
-                 rocsparse_int                     block_dim,
-                 const std::vector<rocsparse_int>& bsr_row_ptr,
-                 const std::vector<rocsparse_int>& bsr_col_ind,
-                 std::vector<T>&                   bsr_val,
-                 rocsparse_index_base              base,
-                 rocsparse_int*                    struct_pivot,
-                 rocsparse_int*                    numeric_pivot)
+void host_bsric0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                 rocsparse_direction                                direction,
+                 rocsparse_int                                      block_dim,
+                 const std::vector<rocsparse_int>&                  bsr_row_ptr,
+                 const std::vector<rocsparse_int>&                  bsr_col_ind,
+                 std::vector<T>&                                    bsr_val,
+                 rocsparse_index_base                               base,
+                 rocsparse_int*                                     struct_pivot,
+                 rocsparse_int*                                     numeric_pivot)
 
 {
-    rocsparse_int M = Mb * block_dim;
+    rocsparse_int Mb = info.m;
+    rocsparse_int M  = Mb * block_dim;
 
     // Initialize pivot
     *struct_pivot  = -1;
@@ -5325,7 +6054,6 @@ void host_bsric0(rocsparse_direction               direction,
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_block_offset(Mb);
     std::vector<rocsparse_int> diag_offset(M, -1);
-    std::vector<rocsparse_int> nnz_entries(M, -1);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -5345,217 +6073,256 @@ void host_bsric0(rocsparse_direction               direction,
         }
     }
 
-    for(rocsparse_int i = 0; i < M; i++)
+    // BSR rows are factorized in level order, rows within a BSR row are processed
+    // sequentially as they depend on each other
+#ifdef _OPENMP
+#pragma omp parallel if(Mb >= host_trm_min_parallel_level_size)
+#endif
     {
-        rocsparse_int local_row = i % block_dim;
+        std::vector<rocsparse_int> nnz_entries(M, -1);
 
-        rocsparse_int row_begin = bsr_row_ptr[i / block_dim] - base;
-        rocsparse_int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
+        rocsparse_int local_struct_pivot  = -1;
+        rocsparse_int local_numeric_pivot = -1;
 
-        for(rocsparse_int j = row_begin; j < row_end; j++)
-        {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
-
-            for(rocsparse_int k = 0; k < block_dim; k++)
+        host_trm_level_for_each(info, [&](rocsparse_int bsr_row) {
+            for(rocsparse_int i = bsr_row * block_dim; i < (bsr_row + 1) * block_dim; i++)
             {
-                if(direction == rocsparse_direction_row)
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * local_row + k;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * k + local_row;
-                }
-            }
-        }
-
-        T             sum            = static_cast<T>(0);
-        rocsparse_int diag_val_index = -1;
-
-        bool has_diag         = false;
-        bool break_outer_loop = false;
+                rocsparse_int local_row = i % block_dim;
 
-        for(rocsparse_int j = row_begin; j < row_end; j++)
-        {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
-
-            for(rocsparse_int k = 0; k < block_dim; k++)
-            {
-                rocsparse_int col_j = block_dim * block_col_j + k;
+                rocsparse_int row_begin = bsr_row_ptr[i / block_dim] - base;
+                rocsparse_int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
 
-                // Mark diagonal and skip row
-                if(col_j == i)
+                for(rocsparse_int j = row_begin; j < row_end; j++)
                 {
-                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
+                    rocsparse_int block_col_j = bsr_col_ind[j] - base;
 
-                    has_diag         = true;
-                    break_outer_loop = true;
-                    break;
+                    for(rocsparse_int k = 0; k < block_dim; k++)
+                    {
+                        if(direction == rocsparse_direction_row)
+                        {
+                            nnz_entries[block_dim * block_col_j + k]
+                                = block_dim * block_dim * j + block_dim * local_row + k;
+                        }
+                        else
+                        {
+                            nnz_entries[block_dim * block_col_j + k]
+                                = block_dim * block_dim * j + block_dim * k + local_row;
+                        }
+                    }
                 }
 
-                // Skip upper triangular
-                if(col_j > i)
-                {
-                    break_outer_loop = true;
-                    break;
-                }
+                T             sum            = static_cast<T>(0);
+                rocsparse_int diag_val_index = -1;
 
-                T val_j = static_cast<T>(0);
-                if(direction == rocsparse_direction_row)
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
-                }
-                else
+                bool has_diag         = false;
+                bool break_outer_loop = false;
+
+                for(rocsparse_int j = row_begin; j < row_end; j++)
                 {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
-                }
+                    rocsparse_int block_col_j = bsr_col_ind[j] - base;
 
-                rocsparse_int local_row_j = col_j % block_dim;
+                    for(rocsparse_int k = 0; k < block_dim; k++)
+                    {
+                        rocsparse_int col_j = block_dim * block_col_j + k;
 
-                rocsparse_int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
-                rocsparse_int row_end_j   = diag_block_offset[col_j / block_dim];
-                rocsparse_int row_diag_j  = diag_offset[col_j];
+                        // Mark diagonal and skip row
+                        if(col_j == i)
+                        {
+                            diag_val_index = block_dim * block_dim * j + block_dim * k + k;
 
-                T local_sum = static_cast<T>(0);
-                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : static_cast<T>(0);
+                            has_diag         = true;
+                            break_outer_loop = true;
+                            break;
+                        }
 
-                // Check for numeric zero
-                if(inv_diag == static_cast<T>(0))
-                {
-                    // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
-                    {
-                        *numeric_pivot = block_col_j + base;
-                    }
+                        // Skip upper triangular
+                        if(col_j > i)
+                        {
+                            break_outer_loop = true;
+                            break;
+                        }
 
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+                        T val_j = static_cast<T>(0);
+                        if(direction == rocsparse_direction_row)
+                        {
+                            val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
+                        }
+                        else
+                        {
+                            val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
+                        }
 
-                    inv_diag = static_cast<T>(1);
-                }
+                        rocsparse_int local_row_j = col_j % block_dim;
 
-                inv_diag = static_cast<T>(1) / inv_diag;
+                        rocsparse_int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
+                        rocsparse_int row_end_j   = diag_block_offset[col_j / block_dim];
+                        rocsparse_int row_diag_j  = diag_offset[col_j];
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(rocsparse_int l = row_begin_j; l < row_end_j + 1; l++)
-                {
-                    rocsparse_int block_col_l = bsr_col_ind[l] - base;
+                        T local_sum = static_cast<T>(0);
+                        T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : static_cast<T>(0);
 
-                    for(rocsparse_int m = 0; m < block_dim; m++)
-                    {
-                        rocsparse_int idx = nnz_entries[block_dim * block_col_l + m];
+                        // Check for numeric zero
+                        if(inv_diag == static_cast<T>(0))
+                        {
+                            // Numerical non-invertible block diagonal
+                            host_pivot_min(local_numeric_pivot, block_col_j + base);
+
+                            inv_diag = static_cast<T>(1);
+                        }
+
+                        inv_diag = static_cast<T>(1) / inv_diag;
 
-                        if(idx != -1 && block_dim * block_col_l + m < col_j)
+                        // loop over upper offset pointer and do linear combination for nnz entry
+                        for(rocsparse_int l = row_begin_j; l < row_end_j + 1; l++)
                         {
-                            if(direction == rocsparse_direction_row)
-                            {
-                                local_sum = std::fma(bsr_val[block_dim * block_dim * l
-                                                             + block_dim * local_row_j + m],
-                                                     rocsparse_conj(bsr_val[idx]),
-                                                     local_sum);
-                            }
-                            else
+                            rocsparse_int block_col_l = bsr_col_ind[l] - base;
+
+                            for(rocsparse_int m = 0; m < block_dim; m++)
                             {
-                                local_sum = std::fma(bsr_val[block_dim * block_dim * l
-                                                             + block_dim * m + local_row_j],
-                                                     rocsparse_conj(bsr_val[idx]),
-                                                     local_sum);
+                                rocsparse_int idx = nnz_entries[block_dim * block_col_l + m];
+
+                                if(idx != -1 && block_dim * block_col_l + m < col_j)
+                                {
+                                    if(direction == rocsparse_direction_row)
+                                    {
+                                        local_sum
+                                            = std::fma(bsr_val[block_dim * block_dim * l
+                                                               + block_dim * local_row_j + m],
+                                                       rocsparse_conj(bsr_val[idx]),
+                                                       local_sum);
+                                    }
+                                    else
+                                    {
+                                        local_sum
+                                            = std::fma(bsr_val[block_dim * block_dim * l
+                                                               + block_dim * m + local_row_j],
+                                                       rocsparse_conj(bsr_val[idx]),
+                                                       local_sum);
+                                    }
+                                }
                             }
                         }
-                    }
-                }
-
-                val_j = (val_j - local_sum) * inv_diag;
-                sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
-
-                if(direction == rocsparse_direction_row)
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
-                }
-                else
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
-                }
-            }
 
-            if(break_outer_loop)
-            {
-                break;
-            }
-        }
+                        val_j = (val_j - local_sum) * inv_diag;
+                        sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
 
-        if(!has_diag)
-        {
-            // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
-        }
+                        if(direction == rocsparse_direction_row)
+                        {
+                            bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
+                        }
+                        else
+                        {
+                            bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
+                        }
+                    }
 
-        // Process diagonal entry
-        if(has_diag)
-        {
-            T diag_entry            = std::sqrt(std::abs(bsr_val[diag_val_index] - sum));
-            bsr_val[diag_val_index] = diag_entry;
+                    if(break_outer_loop)
+                    {
+                        break;
+                    }
+                }
 
-            if(diag_entry == static_cast<T>(0))
-            {
-                // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
+                if(!has_diag)
                 {
-                    *numeric_pivot = i / block_dim + base;
+                    // Structural missing block diagonal
+                    host_pivot_min(local_struct_pivot, i / block_dim + base);
                 }
 
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
-            }
-
-            // Store diagonal offset
-            diag_offset[i] = diag_val_index;
-        }
+                // Process diagonal entry
+                if(has_diag)
+                {
+                    T diag_entry            = std::sqrt(std::abs(bsr_val[diag_val_index] - sum));
+                    bsr_val[diag_val_index] = diag_entry;
 
-        for(rocsparse_int j = row_begin; j < row_end; j++)
-        {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
+                    if(diag_entry == static_cast<T>(0))
+                    {
+                        // Numerical non-invertible block diagonal
+                        host_pivot_min(local_numeric_pivot, i / block_dim + base);
+                    }
 
-            for(rocsparse_int k = 0; k < block_dim; k++)
-            {
-                if(direction == rocsparse_direction_row)
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    // Store diagonal offset
+                    diag_offset[i] = diag_val_index;
                 }
-                else
+
+                for(rocsparse_int j = row_begin; j < row_end; j++)
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    rocsparse_int block_col_j = bsr_col_ind[j] - base;
+
+                    for(rocsparse_int k = 0; k < block_dim; k++)
+                    {
+                        nnz_entries[block_dim * block_col_j + k] = -1;
+                    }
                 }
             }
+        });
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            host_pivot_min(*struct_pivot, local_struct_pivot);
+            host_pivot_min(*numeric_pivot, local_numeric_pivot);
         }
     }
 }
 
+template <typename T>
+void host_bsric0(rocsparse_direction               direction,
+                 rocsparse_int                     Mb,
+                 rocsparse_int                     block_dim,
+                 const std::vector<rocsparse_int>& bsr_row_ptr,
+                 const std::vector<rocsparse_int>& bsr_col_ind,
+                 std::vector<T>&                   bsr_val,
+                 rocsparse_index_base              base,
+                 rocsparse_int*                    struct_pivot,
+                 rocsparse_int*                    numeric_pivot)
+
+{
+    host_trm_info<rocsparse_int, rocsparse_int> info;
+
+    host_trm_analysis(rocsparse_operation_none,
+                      Mb,
+                      bsr_row_ptr[Mb] - base,
+                      bsr_row_ptr.data(),
+                      bsr_col_ind.data(),
+                      rocsparse_fill_mode_lower,
+                      base,
+                      info);
+
+    host_bsric0(info,
+                direction,
+                block_dim,
+                bsr_row_ptr,
+                bsr_col_ind,
+                bsr_val,
+                base,
+                struct_pivot,
+                numeric_pivot);
+}
+
 template <typename T, typename U>
-void host_bsrilu0(rocsparse_direction               dir,
-                  rocsparse_int                     mb,
-                  const std::vector<rocsparse_int>& bsr_row_ptr,
-                  const std::vector<rocsparse_int>& bsr_col_ind,
-                  std::vector<T>&                   bsr_val,
-                  rocsparse_int                     bsr_dim,
-                  rocsparse_index_base              base,
-                  rocsparse_int*                    struct_pivot,
-                  rocsparse_int*                    numeric_pivot,
-                  bool                              boost,
-                  U                                 boost_tol,
-                  T                                 boost_val)
+void host_bsrilu0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                  rocsparse_direction                                dir,
+                  const std::vector<rocsparse_int>&                  bsr_row_ptr,
+                  const std::vector<rocsparse_int>&                  bsr_col_ind,
+                  std::vector<T>&                                    bsr_val,
+                  rocsparse_int                                      bsr_dim,
+                  rocsparse_index_base                               base,
+                  rocsparse_int*                                     struct_pivot,
+                  rocsparse_int*                                     numeric_pivot,
+                  bool                                               boost,
+                  U                                                  boost_tol,
+                  T                                                  boost_val)
 
 {
+    rocsparse_int mb = info.m;
+
     // Initialize pivots
     *struct_pivot  = mb + 1;
     *numeric_pivot = mb + 1;
 
     // Temporary vector to hold diagonal offset to access diagonal BSR block
     std::vector<rocsparse_int> diag_offset(mb);
-    std::vector<rocsparse_int> nnz_entries(mb, -1);
 
     if(mb > 0)
     {
@@ -5563,187 +6330,239 @@ void host_bsrilu0(rocsparse_direction               dir,
         diag_offset[0] = 0;
     }
 
-    // Loop over all BSR rows
+    // The factorization stops at the first BSR row without diagonal block, rows after
+    // this row are not processed
+    rocsparse_int last_row = mb - 1;
+
     for(rocsparse_int i = 0; i < mb; ++i)
     {
-        // Flag whether we have a diagonal block or not
         bool has_diag = false;
 
-        // BSR column entry and exit point
-        rocsparse_int row_begin = bsr_row_ptr[i] - base;
-        rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
-
-        rocsparse_int j;
-
-        // Set up entry points for linear combination
-        for(j = row_begin; j < row_end; ++j)
+        for(rocsparse_int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; ++j)
         {
-            rocsparse_int col_j = bsr_col_ind[j] - base;
-            nnz_entries[col_j]  = j;
+            if(bsr_col_ind[j] - base >= i)
+            {
+                has_diag = (bsr_col_ind[j] - base == i);
+                break;
+            }
         }
 
-        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
-        for(j = row_begin; j < row_end; ++j)
+        if(!has_diag)
         {
-            // Column index of current BSR block
-            rocsparse_int bsr_col = bsr_col_ind[j] - base;
+            last_row = i;
+            break;
+        }
+    }
 
-            // If this is a diagonal block, set diagonal flag to true and skip
-            // all upcoming blocks as we exceed the lower matrix part
-            if(bsr_col == i)
-            {
-                has_diag = true;
-                break;
-            }
+#ifdef _OPENMP
+#pragma omp parallel if(mb >= host_trm_min_parallel_level_size)
+#endif
+    {
+        std::vector<rocsparse_int> nnz_entries(mb, -1);
+
+        rocsparse_int local_struct_pivot  = mb + 1;
+        rocsparse_int local_numeric_pivot = mb + 1;
 
-            // Skip all upper matrix blocks
-            if(bsr_col > i)
+        host_trm_level_for_each(info, [&](rocsparse_int i) {
+            if(i > last_row)
             {
-                break;
+                return;
             }
 
-            // Process all lower matrix BSR blocks
+            // Flag whether we have a diagonal block or not
+            bool has_diag = false;
 
-            // Obtain corresponding row entry and exit point that corresponds with the
-            // current BSR column. Actually, we skip all lower matrix column indices,
-            // therefore starting with the diagonal entry.
-            rocsparse_int diag_j    = diag_offset[bsr_col];
-            rocsparse_int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+            // BSR column entry and exit point
+            rocsparse_int row_begin = bsr_row_ptr[i] - base;
+            rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
 
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            rocsparse_int j;
+
+            // Set up entry points for linear combination
+            for(j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col_j = bsr_col_ind[j] - base;
+                nnz_entries[col_j]  = j;
+            }
+
+            // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
+            for(j = row_begin; j < row_end; ++j)
             {
-                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+                // Column index of current BSR block
+                rocsparse_int bsr_col = bsr_col_ind[j] - base;
+
+                // If this is a diagonal block, set diagonal flag to true and skip
+                // all upcoming blocks as we exceed the lower matrix part
+                if(bsr_col == i)
+                {
+                    has_diag = true;
+                    break;
+                }
 
-                // Process all rows within the BSR block
-                for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                // Skip all upper matrix blocks
+                if(bsr_col > i)
                 {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                    break;
+                }
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+                // Process all lower matrix BSR blocks
 
-                    // Loop through columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                // Obtain corresponding row entry and exit point that corresponds with the
+                // current BSR column. Actually, we skip all lower matrix column indices,
+                // therefore starting with the diagonal entry.
+                rocsparse_int diag_j    = diag_offset[bsr_col];
+                rocsparse_int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+
+                // Loop through all rows within the BSR block
+                for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                {
+                    T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+
+                    // Process all rows within the BSR block
+                    for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-val,
-                                       bsr_val[BSR_IND(diag_j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                        // Multiplication factor
+                        bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+
+                        // Loop through columns of bk-th row and do linear combination
+                        for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                        {
+                            bsr_val[BSR_IND(j, bk, bj, dir)]
+                                = std::fma(-val,
+                                           bsr_val[BSR_IND(diag_j, bi, bj, dir)],
+                                           bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        }
                     }
                 }
-            }
 
-            // Loop over upper offset pointer and do linear combination for nnz entry
-            for(rocsparse_int k = diag_j + 1; k < row_end_j; ++k)
-            {
-                rocsparse_int bsr_col_k = bsr_col_ind[k] - base;
-
-                if(nnz_entries[bsr_col_k] != -1)
+                // Loop over upper offset pointer and do linear combination for nnz entry
+                for(rocsparse_int k = diag_j + 1; k < row_end_j; ++k)
                 {
-                    rocsparse_int m = nnz_entries[bsr_col_k];
+                    rocsparse_int bsr_col_k = bsr_col_ind[k] - base;
 
-                    // Loop through all rows within the BSR block
-                    for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                    if(nnz_entries[bsr_col_k] != -1)
                     {
-                        // Loop through columns of bi-th row and do linear combination
-                        for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
-                        {
-                            T sum = static_cast<T>(0);
+                        rocsparse_int m = nnz_entries[bsr_col_k];
 
-                            for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                        // Loop through all rows within the BSR block
+                        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                        {
+                            // Loop through columns of bi-th row and do linear combination
+                            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
                             {
-                                sum = std::fma(bsr_val[BSR_IND(j, bi, bk, dir)],
-                                               bsr_val[BSR_IND(k, bk, bj, dir)],
-                                               sum);
-                            }
+                                T sum = static_cast<T>(0);
+
+                                for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                                {
+                                    sum = std::fma(bsr_val[BSR_IND(j, bi, bk, dir)],
+                                                   bsr_val[BSR_IND(k, bk, bj, dir)],
+                                                   sum);
+                                }
 
-                            bsr_val[BSR_IND(m, bi, bj, dir)] -= sum;
+                                bsr_val[BSR_IND(m, bi, bj, dir)] -= sum;
+                            }
                         }
                     }
                 }
             }
-        }
-
-        // Check for structural pivot
-        if(!has_diag)
-        {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
-        }
 
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
-        {
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            // Check for structural pivot
+            if(!has_diag)
             {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+                local_struct_pivot = std::min(local_struct_pivot, i + base);
 
-                if(boost)
+                // Reset entry points
+                for(j = row_begin; j < row_end; ++j)
                 {
-                    diag = (boost_tol >= std::abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                    nnz_entries[bsr_col_ind[j] - base] = -1;
                 }
-                else
+
+                return;
+            }
+
+            // Process diagonal
+            if(bsr_col_ind[j] - base == i)
+            {
+                // Loop through all rows within the BSR block
+                for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
                 {
-                    // Check for numeric pivot
-                    if(diag == static_cast<T>(0))
+                    T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+
+                    if(boost)
                     {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
+                        diag = (boost_tol >= std::abs(diag)) ? boost_val : diag;
+                        bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                    }
+                    else
+                    {
+                        // Check for numeric pivot
+                        if(diag == static_cast<T>(0))
+                        {
+                            local_numeric_pivot = std::min(local_numeric_pivot, bsr_col_ind[j]);
+                            continue;
+                        }
                     }
-                }
 
-                // Process all rows within the BSR block after bi-th row
-                for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                    // Process all rows within the BSR block after bi-th row
+                    for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
+                    {
+                        T val = bsr_val[BSR_IND(j, bk, bi, dir)];
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+                        // Multiplication factor
+                        bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
 
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-val,
-                                       bsr_val[BSR_IND(j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        // Loop through remaining columns of bk-th row and do linear combination
+                        for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                        {
+                            bsr_val[BSR_IND(j, bk, bj, dir)]
+                                = std::fma(-val,
+                                           bsr_val[BSR_IND(j, bi, bj, dir)],
+                                           bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        }
                     }
                 }
             }
-        }
 
-        // Store diagonal BSR block entry point
-        rocsparse_int row_diag = diag_offset[i] = j;
+            // Store diagonal BSR block entry point
+            rocsparse_int row_diag = diag_offset[i] = j;
 
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
-        {
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            // Process upper diagonal BSR blocks
+            for(j = row_diag + 1; j < row_end; ++j)
             {
-                // Process all rows within the BSR block after bi-th row
-                for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
+                // Loop through all rows within the BSR block
+                for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
                 {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                    // Process all rows within the BSR block after bi-th row
+                    for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                       bsr_val[BSR_IND(j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        // Loop through columns of bk-th row and do linear combination
+                        for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                        {
+                            bsr_val[BSR_IND(j, bk, bj, dir)]
+                                = std::fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                           bsr_val[BSR_IND(j, bi, bj, dir)],
+                                           bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        }
                     }
                 }
             }
-        }
 
-        // Reset entry points
-        for(j = row_begin; j < row_end; ++j)
+            // Reset entry points
+            for(j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col_j = bsr_col_ind[j] - base;
+                nnz_entries[col_j]  = -1;
+            }
+        });
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            rocsparse_int col_j = bsr_col_ind[j] - base;
-            nnz_entries[col_j]  = -1;
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
         }
     }
 
@@ -5751,17 +6570,59 @@ void host_bsrilu0(rocsparse_direction               dir,
     *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
+template <typename T, typename U>
+void host_bsrilu0(rocsparse_direction               dir,
+                  rocsparse_int                     mb,
+                  const std::vector<rocsparse_int>& bsr_row_ptr,
+                  const std::vector<rocsparse_int>& bsr_col_ind,
+                  std::vector<T>&                   bsr_val,
+                  rocsparse_int                     bsr_dim,
+                  rocsparse_index_base              base,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot,
+                  bool                              boost,
+                  U                                 boost_tol,
+                  T                                 boost_val)
+
+{
+    host_trm_info<rocsparse_int, rocsparse_int> info;
+
+    host_trm_analysis(rocsparse_operation_none,
+                      mb,
+                      bsr_row_ptr[mb] - base,
+                      bsr_row_ptr.data(),
+                      bsr_col_ind.data(),
+                      rocsparse_fill_mode_lower,
+                      base,
+                      info);
+
+    host_bsrilu0(info,
+                 dir,
+                 bsr_row_ptr,
+                 bsr_col_ind,
+                 bsr_val,
+                 bsr_dim,
+                 base,
+                 struct_pivot,
+                 numeric_pivot,
+                 boost,
+                 boost_tol,
+                 boost_val);
+}
+
 template <typename T>
-void host_csric0(rocsparse_int                     M,
-                 const std::vector<rocsparse_int>& csr_row_ptr,
-                 const std::vector<rocsparse_int>& csr_col_ind,
-                 std::vector<T>&                   csr_val,
-                 rocsparse_index_base              base,
-                 rocsparse_int*                    struct_pivot,
-                 rocsparse_int*                    numeric_pivot,
-                 rocsparse_int*                    singular_pivot,
-                 double                            tol)
+void host_csric0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                 const std::vector<rocsparse_int>&                  csr_row_ptr,
+                 const std::vector<rocsparse_int>&                  csr_col_ind,
+                 std::vector<T>&                                    csr_val,
+                 rocsparse_index_base                               base,
+                 rocsparse_int*                                     struct_pivot,
+                 rocsparse_int*                                     numeric_pivot,
+                 rocsparse_int*                                     singular_pivot,
+                 double                                             tol)
 {
+    rocsparse_int M = info.m;
+
     // Initialize pivot
     *struct_pivot   = -1;
     *numeric_pivot  = -1;
@@ -5769,128 +6630,140 @@ void host_csric0(rocsparse_int                     M,
 
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
+#ifdef _OPENMP
+#pragma omp parallel if(M >= host_trm_min_parallel_level_size)
+#endif
     {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
-
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - base] = j;
-        }
+        std::vector<rocsparse_int> nnz_entries(M, 0);
 
-        T sum = static_cast<T>(0);
-
-        bool has_diag = false;
-
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            rocsparse_int col_j = csr_col_ind[j] - base;
-            T             val_j = csr_val[j];
+        rocsparse_int local_struct_pivot   = -1;
+        rocsparse_int local_numeric_pivot  = -1;
+        rocsparse_int local_singular_pivot = -1;
 
-            // Mark diagonal and skip row
-            if(col_j == ai)
-            {
-                has_diag = true;
-                break;
-            }
+        // Rows are processed in level order, such that all rows ai depends on are complete
+        host_trm_level_for_each(info, [&](rocsparse_int ai) {
+            // ai-th row entries
+            rocsparse_int row_begin = csr_row_ptr[ai] - base;
+            rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+            rocsparse_int j;
 
-            // Skip upper triangular
-            if(col_j > ai)
+            // nnz position of ai-th row in val array
+            for(j = row_begin; j < row_end; ++j)
             {
-                break;
+                nnz_entries[csr_col_ind[j] - base] = j;
             }
 
-            rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
-            rocsparse_int row_diag_j  = diag_offset[col_j];
+            T sum = static_cast<T>(0);
 
-            T local_sum = static_cast<T>(0);
-            T diag_val  = csr_val[row_diag_j];
-            T inv_diag  = static_cast<T>(0);
+            bool has_diag = false;
 
-            // Check for numeric negative
-            if((std::real(diag_val) <= tol) && (std::imag(diag_val) == 0))
+            // loop over ai-th row nnz entries
+            for(j = row_begin; j < row_end; ++j)
             {
-                // Numerical negative diagonal
-                *singular_pivot = (*singular_pivot == -1) ? (col_j + base)
-                                                          : std::min(*singular_pivot, col_j + base);
-            }
+                rocsparse_int col_j = csr_col_ind[j] - base;
+                T             val_j = csr_val[j];
 
-            // Check for numeric zero
-            if(diag_val == static_cast<T>(0))
-            {
-                // Numerical zero diagonal
-                *numeric_pivot = (*numeric_pivot == -1) ? (col_j + base)
-                                                        : std::min(*numeric_pivot, col_j + base);
-            }
-            else
-            {
+                // Mark diagonal and skip row
+                if(col_j == ai)
+                {
+                    has_diag = true;
+                    break;
+                }
 
-                inv_diag = static_cast<T>(1) / diag_val;
-            }
+                // Skip upper triangular
+                if(col_j > ai)
+                {
+                    break;
+                }
 
-            // loop over upper offset pointer and do linear combination for nnz entry
-            for(rocsparse_int k = row_begin_j; k < row_diag_j; ++k)
-            {
-                rocsparse_int col_k = csr_col_ind[k] - base;
+                rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
+                rocsparse_int row_diag_j  = diag_offset[col_j];
 
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
+                T local_sum = static_cast<T>(0);
+                T diag_val  = csr_val[row_diag_j];
+                T inv_diag  = static_cast<T>(0);
+
+                // Check for numeric negative
+                if((std::real(diag_val) <= tol) && (std::imag(diag_val) == 0))
                 {
-                    rocsparse_int idx = nnz_entries[col_k];
-                    local_sum = std::fma(csr_val[k], rocsparse_conj(csr_val[idx]), local_sum);
+                    // Numerical negative diagonal
+                    host_pivot_min(local_singular_pivot, col_j + base);
                 }
-            }
 
-            val_j = (val_j - local_sum) * inv_diag;
-            sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
+                // Check for numeric zero
+                if(diag_val == static_cast<T>(0))
+                {
+                    // Numerical zero diagonal
+                    host_pivot_min(local_numeric_pivot, col_j + base);
+                }
+                else
+                {
+
+                    inv_diag = static_cast<T>(1) / diag_val;
+                }
 
-            csr_val[j] = val_j;
-        }
+                // loop over upper offset pointer and do linear combination for nnz entry
+                for(rocsparse_int k = row_begin_j; k < row_diag_j; ++k)
+                {
+                    rocsparse_int col_k = csr_col_ind[k] - base;
 
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            *struct_pivot
-                = (*struct_pivot == -1) ? (ai + base) : std::min(*struct_pivot, ai + base);
-            *numeric_pivot
-                = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
-        }
-        else
-        {
-            // Store diagonal offset
-            diag_offset[ai] = j;
+                    // if nnz at this position do linear combination
+                    if(nnz_entries[col_k] != 0)
+                    {
+                        rocsparse_int idx = nnz_entries[col_k];
+                        local_sum = std::fma(csr_val[k], rocsparse_conj(csr_val[idx]), local_sum);
+                    }
+                }
+
+                val_j = (val_j - local_sum) * inv_diag;
+                sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
 
-            // Process diagonal entry
-            T diag_entry = csr_val[j] - sum;
-            csr_val[j]   = std::sqrt(std::abs(diag_entry));
+                csr_val[j] = val_j;
+            }
 
-            auto tolXtol = tol * tol;
-            if((std::real(diag_entry) <= tolXtol) && (std::imag(diag_entry) == 0))
+            if(!has_diag)
+            {
+                // Structural (and numerical) zero diagonal
+                host_pivot_min(local_struct_pivot, ai + base);
+                host_pivot_min(local_numeric_pivot, ai + base);
+            }
+            else
             {
-                *singular_pivot
-                    = (*singular_pivot == -1) ? (ai + base) : std::min(*singular_pivot, ai + base);
+                // Store diagonal offset
+                diag_offset[ai] = j;
+
+                // Process diagonal entry
+                T diag_entry = csr_val[j] - sum;
+                csr_val[j]   = std::sqrt(std::abs(diag_entry));
+
+                auto tolXtol = tol * tol;
+                if((std::real(diag_entry) <= tolXtol) && (std::imag(diag_entry) == 0))
+                {
+                    host_pivot_min(local_singular_pivot, ai + base);
+                }
+
+                // check for zero diagonal
+                if(diag_entry == static_cast<T>(0))
+                {
+                    host_pivot_min(local_numeric_pivot, ai + base);
+                }
             }
 
-            // check for zero diagonal
-            if(diag_entry == static_cast<T>(0))
+            // clear nnz entries
+            for(j = row_begin; j < row_end; ++j)
             {
-                *numeric_pivot
-                    = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
+                nnz_entries[csr_col_ind[j] - base] = 0;
             }
-        }
+        });
 
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            nnz_entries[csr_col_ind[j] - base] = 0;
+            host_pivot_min(*struct_pivot, local_struct_pivot);
+            host_pivot_min(*numeric_pivot, local_numeric_pivot);
+            host_pivot_min(*singular_pivot, local_singular_pivot);
         }
     }
 
@@ -5907,19 +6780,52 @@ void host_csric0(rocsparse_int                     M,
     }
 }
 
+template <typename T>
+void host_csric0(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 std::vector<T>&                   csr_val,
+                 rocsparse_index_base              base,
+                 rocsparse_int*                    struct_pivot,
+                 rocsparse_int*                    numeric_pivot,
+                 rocsparse_int*                    singular_pivot,
+                 double                            tol)
+{
+    host_trm_info<rocsparse_int, rocsparse_int> info;
+
+    host_trm_analysis(rocsparse_operation_none,
+                      M,
+                      csr_row_ptr[M] - base,
+                      csr_row_ptr.data(),
+                      csr_col_ind.data(),
+                      rocsparse_fill_mode_lower,
+                      base,
+                      info);
+
+    host_csric0(info,
+                csr_row_ptr,
+                csr_col_ind,
+                csr_val,
+                base,
+                struct_pivot,
+                numeric_pivot,
+                singular_pivot,
+                tol);
+}
+
 template <typename T, typename U>
-void host_csrilu0(rocsparse_int                     M,
-                  const std::vector<rocsparse_int>& csr_row_ptr,
-                  const std::vector<rocsparse_int>& csr_col_ind,
-                  std::vector<T>&                   csr_val,
-                  rocsparse_index_base              base,
-                  rocsparse_int*                    struct_pivot,
-                  rocsparse_int*                    numeric_pivot,
-                  rocsparse_int*                    singular_pivot,
-                  double                            tol,
-                  bool                              boost,
-                  U                                 boost_tol,
-                  T                                 boost_val)
+void host_csrilu0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                  const std::vector<rocsparse_int>&                  csr_row_ptr,
+                  const std::vector<rocsparse_int>&                  csr_col_ind,
+                  std::vector<T>&                                    csr_val,
+                  rocsparse_index_base                               base,
+                  rocsparse_int*                                     struct_pivot,
+                  rocsparse_int*                                     numeric_pivot,
+                  rocsparse_int*                                     singular_pivot,
+                  double                                             tol,
+                  bool                                               boost,
+                  U                                                  boost_tol,
+                  T                                                  boost_val)
 {
     if((struct_pivot == nullptr) || (numeric_pivot == nullptr) || (singular_pivot == nullptr))
     {
@@ -5929,6 +6835,8 @@ void host_csrilu0(rocsparse_int                     M,
         throw(1);
     }
 
+    rocsparse_int M = info.m;
+
     // Initialize pivot
     *struct_pivot   = -1;
     *numeric_pivot  = -1;
@@ -5936,134 +6844,132 @@ void host_csrilu0(rocsparse_int                     M,
 
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_offset(M, -1);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
+#ifdef _OPENMP
+#pragma omp parallel if(M >= host_trm_min_parallel_level_size)
+#endif
     {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
+        std::vector<rocsparse_int> nnz_entries(M, 0);
 
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - base] = j;
-        }
+        rocsparse_int local_struct_pivot   = -1;
+        rocsparse_int local_numeric_pivot  = -1;
+        rocsparse_int local_singular_pivot = -1;
 
-        bool          has_diag = false;
-        rocsparse_int diag_pos = -1;
+        // Rows are processed in level order, such that all rows ai depends on are complete
+        host_trm_level_for_each(info, [&](rocsparse_int ai) {
+            // ai-th row entries
+            rocsparse_int row_begin = csr_row_ptr[ai] - base;
+            rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+            rocsparse_int j;
 
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            // if nnz entry is in lower matrix
-            if(csr_col_ind[j] - base < ai)
+            // nnz position of ai-th row in val array
+            for(j = row_begin; j < row_end; ++j)
             {
+                nnz_entries[csr_col_ind[j] - base] = j;
+            }
 
-                rocsparse_int col_j  = csr_col_ind[j] - base;
-                rocsparse_int diag_j = diag_offset[col_j];
-                if(diag_j < 0)
-                    continue;
-
-                T diag_val = csr_val[diag_j];
+            bool          has_diag = false;
+            rocsparse_int diag_pos = -1;
 
-                if(boost)
-                {
-                    diag_val        = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
-                    csr_val[diag_j] = diag_val;
-                }
-                else
+            // loop over ai-th row nnz entries
+            for(j = row_begin; j < row_end; ++j)
+            {
+                // if nnz entry is in lower matrix
+                if(csr_col_ind[j] - base < ai)
                 {
 
-                    // Check for numeric singular pivot
-                    if(std::abs(diag_val) <= tol)
-                    {
-                        *singular_pivot = (*singular_pivot == -1)
-                                              ? (col_j + base)
-                                              : std::min(*singular_pivot, col_j + base);
-                    }
+                    rocsparse_int col_j  = csr_col_ind[j] - base;
+                    rocsparse_int diag_j = diag_offset[col_j];
+                    if(diag_j < 0)
+                        continue;
 
-                    // Check for numeric zero pivot
-                    if(diag_val == static_cast<T>(0))
+                    T diag_val = csr_val[diag_j];
+
+                    if(boost)
                     {
-                        *numeric_pivot = (*numeric_pivot == -1)
-                                             ? (col_j + base)
-                                             : std::min(*numeric_pivot, col_j + base);
-                        continue;
+                        // The diagonal of row col_j has already been boosted when row
+                        // col_j has been factorized
+                        diag_val = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
                     }
-                }
+                    else
+                    {
 
-                {
-                    // multiplication factor
+                        // Check for numeric singular pivot
+                        if(std::abs(diag_val) <= tol)
+                        {
+                            host_pivot_min(local_singular_pivot, col_j + base);
+                        }
 
-                    csr_val[j] = csr_val[j] / diag_val;
+                        // Check for numeric zero pivot
+                        if(diag_val == static_cast<T>(0))
+                        {
+                            host_pivot_min(local_numeric_pivot, col_j + base);
+                            continue;
+                        }
+                    }
 
-                    // loop over upper offset pointer and do linear combination for nnz entry
-                    for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
                     {
-                        // if nnz at this position do linear combination
-                        if(nnz_entries[csr_col_ind[k] - base] != 0)
+                        // multiplication factor
+
+                        csr_val[j] = csr_val[j] / diag_val;
+
+                        // loop over upper offset pointer and do linear combination for nnz entry
+                        for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
                         {
-                            rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
-                            csr_val[idx]      = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
+                            // if nnz at this position do linear combination
+                            if(nnz_entries[csr_col_ind[k] - base] != 0)
+                            {
+                                rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
+                                csr_val[idx] = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
+                            }
                         }
                     }
                 }
+                else if(csr_col_ind[j] - base == ai)
+                {
+                    has_diag = true;
+                    diag_pos = j;
+                    break;
+                }
+                else
+                {
+                    break;
+                }
             }
-            else if(csr_col_ind[j] - base == ai)
-            {
-                has_diag = true;
-                diag_pos = j;
-                break;
-            }
-            else
-            {
-                break;
-            }
-        }
 
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            *struct_pivot
-                = (*struct_pivot == -1) ? (ai + base) : std::min(*struct_pivot, ai + base);
-            *numeric_pivot
-                = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
-        }
-        else
-        {
-            // set diagonal pointer to diagonal element
-            diag_offset[ai] = diag_pos;
-            if(boost)
+            if(!has_diag)
             {
-                if(std::abs(csr_val[diag_pos]) <= boost_tol)
-                {
-                    csr_val[diag_pos] = boost_val;
-                }
+                // Structural (and numerical) zero diagonal
+                host_pivot_min(local_struct_pivot, ai + base);
+                host_pivot_min(local_numeric_pivot, ai + base);
             }
             else
             {
-                const rocsparse_int diag_pos = diag_offset[ai];
-                const bool is_diag = (diag_pos >= 0) && (csr_col_ind[diag_pos] == (ai + base));
-
-                const bool is_singular_diag = is_diag && (std::abs(csr_val[diag_pos]) <= tol);
-                const bool is_zero_diag     = is_diag && (csr_val[diag_pos] == static_cast<T>(0));
-
-                // check for singular diagonal
-                if(is_singular_diag)
+                // set diagonal pointer to diagonal element
+                diag_offset[ai] = diag_pos;
+                if(boost)
                 {
-                    *singular_pivot = (*singular_pivot == -1)
-                                          ? (ai + base)
-                                          : std::min(*singular_pivot, (ai + base));
+                    if(std::abs(csr_val[diag_pos]) <= boost_tol)
+                    {
+                        csr_val[diag_pos] = boost_val;
+                    }
                 }
-
-                // check for zero diagonal
-                if(is_zero_diag)
+                else
                 {
-                    *numeric_pivot = (*numeric_pivot == -1) ? (ai + base)
-                                                            : std::min(*numeric_pivot, (ai + base));
+                    const bool is_singular_diag = (std::abs(csr_val[diag_pos]) <= tol);
+                    const bool is_zero_diag     = (csr_val[diag_pos] == static_cast<T>(0));
+
+                    // check for singular diagonal
+                    if(is_singular_diag)
+                    {
+                        host_pivot_min(local_singular_pivot, ai + base);
+                    }
+
+                    // check for zero diagonal
+                    if(is_zero_diag)
+                    {
+                        host_pivot_min(local_numeric_pivot, ai + base);
+                    }
                 }
             }
 
@@ -6072,6 +6978,15 @@ void host_csrilu0(rocsparse_int                     M,
             {
                 nnz_entries[csr_col_ind[j] - base] = 0;
             }
+        });
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            host_pivot_min(*struct_pivot, local_struct_pivot);
+            host_pivot_min(*numeric_pivot, local_numeric_pivot);
+            host_pivot_min(*singular_pivot, local_singular_pivot);
         }
     }
 
@@ -6088,126 +7003,182 @@ void host_csrilu0(rocsparse_int                     M,
     }
 }
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
-template <typename T>
-void host_gtsv_no_pivot(rocsparse_int         m,
-                        rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
-                        rocsparse_int         ldb)
+template <typename T, typename U>
+void host_csrilu0(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  std::vector<T>&                   csr_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot,
+                  rocsparse_int*                    singular_pivot,
+                  double                            tol,
+                  bool                              boost,
+                  U                                 boost_tol,
+                  T                                 boost_val)
 {
-    //
-    // Compute BLOCKSIZE as the lowest power of 2 greater or equal than m,
-    // and compute the exponent 'iter' of (BLOCKSIZE / 2).
-    // Note: if m = 1 then the calculation below leads to iter = -1 which is, in this algorithm, as acceptable as log2(m / 2) = -Inf.
-    //
-    rocsparse_int iter;
-    size_t        BLOCKSIZE;
-    for(iter = 0, BLOCKSIZE = 1; BLOCKSIZE < m; BLOCKSIZE <<= 1, ++iter)
-        ;
-    --iter;
-
-    for(rocsparse_int col = 0; col < n; col++)
-    {
-        rocsparse_int stride = 1;
+    host_trm_info<rocsparse_int, rocsparse_int> info;
+
+    host_trm_analysis(rocsparse_operation_none,
+                      M,
+                      csr_row_ptr[M] - base,
+                      csr_row_ptr.data(),
+                      csr_col_ind.data(),
+                      rocsparse_fill_mode_lower,
+                      base,
+                      info);
+
+    host_csrilu0(info,
+                 csr_row_ptr,
+                 csr_col_ind,
+                 csr_val,
+                 base,
+                 struct_pivot,
+                 numeric_pivot,
+                 singular_pivot,
+                 tol,
+                 boost,
+                 boost_tol,
+                 boost_val);
+}
 
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+// Number of systems that are processed simultaneously by the batched tridiagonal and
+// pentadiagonal solvers. A group of systems spans 64 bytes, i.e. 16, 8 or 4 systems depending
+// on the precision, such that the innermost loop over the systems of a group vectorizes.
+template <typename T>
+struct host_batch_group_size
+{
+    static constexpr rocsparse_int value = 64 / sizeof(T);
+};
+
+// Parallel cyclic reduction of a group of G systems of the strided batch. The diagonals of
+// consecutive systems are matrix_stride apart, which is 0 if all systems share the same matrix.
+// The work arrays are of size G * BLOCKSIZE each and hold the G systems interleaved.
+template <rocsparse_int G, typename T>
+static void host_gtsv_no_pivot_strided_batch_group(rocsparse_int m,
+                                                   rocsparse_int iter,
+                                                   size_t        BLOCKSIZE,
+                                                   const T*      dl,
+                                                   const T*      d,
+                                                   const T*      du,
+                                                   rocsparse_int matrix_stride,
+                                                   T*            x,
+                                                   rocsparse_int batch_stride,
+                                                   T*            a,
+                                                   T*            b,
+                                                   T*            c,
+                                                   T*            rhs,
+                                                   T*            sa,
+                                                   T*            sb,
+                                                   T*            sc,
+                                                   T*            srhs,
+                                                   T*            y)
+{
+    rocsparse_int stride = 1;
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
+    std::fill(a, a + G * BLOCKSIZE, static_cast<T>(0));
+    std::fill(b, b + G * BLOCKSIZE, static_cast<T>(0));
+    std::fill(c, c + G * BLOCKSIZE, static_cast<T>(0));
+    std::fill(rhs, rhs + G * BLOCKSIZE, static_cast<T>(0));
+    std::fill(y, y + G * BLOCKSIZE, static_cast<T>(0));
 
+    for(rocsparse_int k = 0; k < G; k++)
+    {
         for(rocsparse_int i = 0; i < m; i++)
         {
-            a[i]   = dl[i];
-            b[i]   = d[i];
-            c[i]   = du[i];
-            rhs[i] = B[ldb * col + i];
+            a[G * i + k]   = dl[matrix_stride * k + i];
+            b[G * i + k]   = d[matrix_stride * k + i];
+            c[G * i + k]   = du[matrix_stride * k + i];
+            rhs[G * i + k] = x[batch_stride * k + i];
         }
+    }
 
-        for(rocsparse_int j = 0; j < iter; j++)
+    for(rocsparse_int j = 0; j < iter; j++)
+    {
+        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
         {
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                rocsparse_int right = tid + stride;
-                if(right >= m)
-                    right = m - 1;
+            rocsparse_int right = tid + stride;
+            if(right >= m)
+                right = m - 1;
 
-                rocsparse_int left = tid - stride;
-                if(left < 0)
-                    left = 0;
+            rocsparse_int left = tid - stride;
+            if(left < 0)
+                left = 0;
 
-                T k1 = a[tid] / b[left];
-                T k2 = c[tid] / b[right];
+            for(rocsparse_int k = 0; k < G; k++)
+            {
+                T k1 = a[G * tid + k] / b[G * left + k];
+                T k2 = c[G * tid + k] / b[G * right + k];
 
-                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
-                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
-                T ta   = -a[left] * k1;
-                T tc   = -c[right] * k2;
+                T tb   = b[G * tid + k] - c[G * left + k] * k1 - a[G * right + k] * k2;
+                T trhs = rhs[G * tid + k] - rhs[G * left + k] * k1 - rhs[G * right + k] * k2;
+                T ta   = -a[G * left + k] * k1;
+                T tc   = -c[G * right + k] * k2;
 
-                sb[tid]   = tb;
-                srhs[tid] = trhs;
-                sa[tid]   = ta;
-                sc[tid]   = tc;
+                sb[G * tid + k]   = tb;
+                srhs[G * tid + k] = trhs;
+                sa[G * tid + k]   = ta;
+                sc[G * tid + k]   = tc;
             }
+        }
 
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                a[tid]   = sa[tid];
-                b[tid]   = sb[tid];
-                c[tid]   = sc[tid];
-                rhs[tid] = srhs[tid];
-            }
+        std::copy(sa, sa + G * BLOCKSIZE, a);
+        std::copy(sb, sb + G * BLOCKSIZE, b);
+        std::copy(sc, sc + G * BLOCKSIZE, c);
+        std::copy(srhs, srhs + G * BLOCKSIZE, rhs);
 
-            stride *= 2;
-        }
+        stride *= 2;
+    }
 
-        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+    for(rocsparse_int tid = 0; tid < BLOCKSIZE / 2; tid++)
+    {
+        rocsparse_int i = tid;
+        rocsparse_int j = tid + stride;
+
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            if(tid < BLOCKSIZE / 2)
+            if(j < m)
             {
-                rocsparse_int i = tid;
-                rocsparse_int j = tid + stride;
+                // Solve 2x2 systems
+                T det = b[G * j + k] * b[G * i + k] - c[G * i + k] * a[G * j + k];
 
-                if(j < m)
-                {
-                    // Solve 2x2 systems
-                    T det = b[j] * b[i] - c[i] * a[j];
-                    x[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
-                    x[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
-                }
-                else
-                {
-                    // Solve 1x1 systems
-                    x[i] = rhs[i] / b[i];
-                }
+                y[G * i + k]
+                    = (b[G * j + k] * rhs[G * i + k] - c[G * i + k] * rhs[G * j + k]) / det;
+                y[G * j + k]
+                    = (rhs[G * j + k] * b[G * i + k] - rhs[G * i + k] * a[G * j + k]) / det;
+            }
+            else
+            {
+                // Solve 1x1 systems
+                y[G * i + k] = rhs[G * i + k] / b[G * i + k];
             }
         }
+    }
 
+    for(rocsparse_int k = 0; k < G; k++)
+    {
         for(rocsparse_int i = 0; i < m; i++)
         {
-            B[ldb * col + i] = x[i];
+            x[batch_stride * k + i] = y[G * i + k];
         }
     }
 }
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang.
+// Solves batch_count systems whose diagonals are matrix_stride apart and whose right-hand sides
+// are batch_stride apart.
 template <typename T>
-void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
-                                      const std::vector<T>& dl,
-                                      const std::vector<T>& d,
-                                      const std::vector<T>& du,
-                                      std::vector<T>&       x,
-                                      rocsparse_int         batch_count,
-                                      rocsparse_int         batch_stride)
+static void host_gtsv_no_pivot_strided_batch(rocsparse_int m,
+                                             const T*      dl,
+                                             const T*      d,
+                                             const T*      du,
+                                             rocsparse_int matrix_stride,
+                                             T*            x,
+                                             rocsparse_int batch_count,
+                                             rocsparse_int batch_stride)
 {
+    static constexpr rocsparse_int G = host_batch_group_size<T>::value;
+
     //
     // Compute BLOCKSIZE as the lowest power of 2 greater or equal than m,
     // and compute the exponent 'iter' of (BLOCKSIZE / 2).
@@ -6219,91 +7190,158 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
         ;
     --iter;
 
-    for(rocsparse_int col = 0; col < batch_count; col++)
-    {
-        rocsparse_int stride = 1;
-
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+    rocsparse_int ngroups = batch_count / G;
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> y(BLOCKSIZE, static_cast<T>(0));
-
-        for(rocsparse_int i = 0; i < m; i++)
-        {
-            a[i]   = dl[batch_stride * col + i];
-            b[i]   = d[batch_stride * col + i];
-            c[i]   = du[batch_stride * col + i];
-            rhs[i] = x[batch_stride * col + i];
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<T> a(G * BLOCKSIZE);
+        std::vector<T> b(G * BLOCKSIZE);
+        std::vector<T> c(G * BLOCKSIZE);
+        std::vector<T> rhs(G * BLOCKSIZE);
+        std::vector<T> sa(G * BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sb(G * BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sc(G * BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> srhs(G * BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> y(G * BLOCKSIZE);
+
+        // Groups of G systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int g = 0; g < ngroups; g++)
+        {
+            int64_t matrix_offset = static_cast<int64_t>(matrix_stride) * G * g;
+            int64_t offset        = static_cast<int64_t>(batch_stride) * G * g;
+
+            host_gtsv_no_pivot_strided_batch_group<G>(m,
+                                                      iter,
+                                                      BLOCKSIZE,
+                                                      dl + matrix_offset,
+                                                      d + matrix_offset,
+                                                      du + matrix_offset,
+                                                      matrix_stride,
+                                                      x + offset,
+                                                      batch_stride,
+                                                      a.data(),
+                                                      b.data(),
+                                                      c.data(),
+                                                      rhs.data(),
+                                                      sa.data(),
+                                                      sb.data(),
+                                                      sc.data(),
+                                                      srhs.data(),
+                                                      y.data());
+        }
+
+        // Remaining systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int col = G * ngroups; col < batch_count; col++)
+        {
+            int64_t matrix_offset = static_cast<int64_t>(matrix_stride) * col;
+            int64_t offset        = static_cast<int64_t>(batch_stride) * col;
+
+            host_gtsv_no_pivot_strided_batch_group<1>(m,
+                                                      iter,
+                                                      BLOCKSIZE,
+                                                      dl + matrix_offset,
+                                                      d + matrix_offset,
+                                                      du + matrix_offset,
+                                                      matrix_stride,
+                                                      x + offset,
+                                                      batch_stride,
+                                                      a.data(),
+                                                      b.data(),
+                                                      c.data(),
+                                                      rhs.data(),
+                                                      sa.data(),
+                                                      sb.data(),
+                                                      sc.data(),
+                                                      srhs.data(),
+                                                      y.data());
         }
+    }
+}
 
-        for(rocsparse_int j = 0; j < iter; j++)
-        {
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                rocsparse_int right = tid + stride;
-                if(right >= m)
-                    right = m - 1;
-
-                rocsparse_int left = tid - stride;
-                if(left < 0)
-                    left = 0;
+template <typename T>
+void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride)
+{
+    host_gtsv_no_pivot_strided_batch(
+        m, dl.data(), d.data(), du.data(), batch_stride, x.data(), batch_count, batch_stride);
+}
 
-                T k1 = a[tid] / b[left];
-                T k2 = c[tid] / b[right];
+// The n right-hand sides of B share the tridiagonal matrix, they are solved as a strided batch
+// of n systems of stride ldb with a zero matrix stride.
+template <typename T>
+void host_gtsv_no_pivot(rocsparse_int         m,
+                        rocsparse_int         n,
+                        const std::vector<T>& dl,
+                        const std::vector<T>& d,
+                        const std::vector<T>& du,
+                        std::vector<T>&       B,
+                        rocsparse_int         ldb)
+{
+    host_gtsv_no_pivot_strided_batch(m, dl.data(), d.data(), du.data(), 0, B.data(), n, ldb);
+}
 
-                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
-                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
-                T ta   = -a[left] * k1;
-                T tc   = -c[right] * k2;
+// Thomas algorithm on a group of G interleaved systems. The pointers are offset to the first
+// system of the group and the work arrays are of size G * m each.
+template <rocsparse_int G, typename T>
+static void host_gtsv_interleaved_batch_thomas_group(rocsparse_int m,
+                                                     const T*      dl,
+                                                     const T*      d,
+                                                     const T*      du,
+                                                     T*            x,
+                                                     rocsparse_int batch_stride,
+                                                     T*            c1,
+                                                     T*            x1)
+{
+    // Forward elimination
+    for(rocsparse_int k = 0; k < G; k++)
+    {
+        c1[k] = du[k] / d[k];
+        x1[k] = x[k] / d[k];
+    }
 
-                sb[tid]   = tb;
-                srhs[tid] = trhs;
-                sa[tid]   = ta;
-                sc[tid]   = tc;
-            }
+    for(rocsparse_int i = 1; i < m; i++)
+    {
+        for(rocsparse_int k = 0; k < G; k++)
+        {
+            rocsparse_int index = G * i + k;
+            rocsparse_int minus = G * (i - 1) + k;
 
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                a[tid]   = sa[tid];
-                b[tid]   = sb[tid];
-                c[tid]   = sc[tid];
-                rhs[tid] = srhs[tid];
-            }
+            T tdu = du[batch_stride * i + k];
+            T td  = d[batch_stride * i + k];
+            T tdl = dl[batch_stride * i + k];
+            T tx  = x[batch_stride * i + k];
 
-            stride *= 2;
+            c1[index] = tdu / (td - c1[minus] * tdl);
+            x1[index] = (tx - x1[minus] * tdl) / (td - c1[minus] * tdl);
         }
+    }
 
-        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-        {
-            if(tid < BLOCKSIZE / 2)
-            {
-                rocsparse_int i = tid;
-                rocsparse_int j = tid + stride;
-
-                if(j < m)
-                {
-                    // Solve 2x2 systems
-                    T det = b[j] * b[i] - c[i] * a[j];
-                    y[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
-                    y[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
-                }
-                else
-                {
-                    // Solve 1x1 systems
-                    y[i] = rhs[i] / b[i];
-                }
-            }
-        }
+    // backward substitution
+    for(rocsparse_int k = 0; k < G; k++)
+    {
+        x[batch_stride * (m - 1) + k] = x1[G * (m - 1) + k];
+    }
 
-        for(rocsparse_int i = 0; i < m; i++)
+    for(rocsparse_int i = m - 2; i >= 0; i--)
+    {
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            x[batch_stride * col + i] = y[i];
+            rocsparse_int index = G * i + k;
+
+            x[batch_stride * i + k] = x1[index] - c1[index] * x[batch_stride * (i + 1) + k];
         }
     }
 }
@@ -6317,199 +7355,160 @@ void host_gtsv_interleaved_batch_thomas(rocsparse_int m,
                                         rocsparse_int batch_count,
                                         rocsparse_int batch_stride)
 {
-    std::vector<T> c1(m * batch_count, 0);
-    std::vector<T> x1(m * batch_count, 0);
+    static constexpr rocsparse_int G = host_batch_group_size<T>::value;
+
+    rocsparse_int ngroups = batch_count / G;
 
-    // Forward elimination
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
     {
-        c1[j] = du[j] / d[j];
-        x1[j] = x[j] / d[j];
-    }
+        std::vector<T> c1(G * m);
+        std::vector<T> x1(G * m);
 
-    for(rocsparse_int i = 1; i < m; i++)
-    {
+        // Groups of G systems
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp for schedule(dynamic, 1)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int g = 0; g < ngroups; g++)
         {
-            rocsparse_int index = batch_count * i + j;
-            rocsparse_int minus = batch_count * (i - 1) + j;
-
-            T tdu = du[batch_stride * i + j];
-            T td  = d[batch_stride * i + j];
-            T tdl = dl[batch_stride * i + j];
-            T tx  = x[batch_stride * i + j];
+            rocsparse_int j = G * g;
 
-            c1[index] = tdu / (td - c1[minus] * tdl);
-            x1[index] = (tx - x1[minus] * tdl) / (td - c1[minus] * tdl);
+            host_gtsv_interleaved_batch_thomas_group<G>(
+                m, dl + j, d + j, du + j, x + j, batch_stride, c1.data(), x1.data());
         }
-    }
-
-    // backward substitution
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
-    {
-        x[batch_stride * (m - 1) + j] = x1[batch_count * (m - 1) + j];
-    }
 
-    for(rocsparse_int i = m - 2; i >= 0; i--)
-    {
+        // Remaining systems
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp for schedule(dynamic, 1)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = G * ngroups; j < batch_count; j++)
         {
-            rocsparse_int index = batch_count * i + j;
-
-            x[batch_stride * i + j] = x1[index] - c1[index] * x[batch_stride * (i + 1) + j];
+            host_gtsv_interleaved_batch_thomas_group<1>(
+                m, dl + j, d + j, du + j, x + j, batch_stride, c1.data(), x1.data());
         }
     }
 }
 
-template <typename T>
-void host_gtsv_interleaved_batch_lu(rocsparse_int m,
-                                    const T*      dl,
-                                    const T*      d,
-                                    const T*      du,
-                                    T*            x,
-                                    rocsparse_int batch_count,
-                                    rocsparse_int batch_stride)
+// LU decomposition with partial pivoting on a group of G interleaved systems. The pointers
+// are offset to the first system of the group and the work arrays are of size G * m each.
+template <rocsparse_int G, typename T>
+static void host_gtsv_interleaved_batch_lu_group(rocsparse_int  m,
+                                                 const T*       dl,
+                                                 const T*       d,
+                                                 const T*       du,
+                                                 T*             x,
+                                                 rocsparse_int  batch_stride,
+                                                 T*             l,
+                                                 T*             u0,
+                                                 T*             u1,
+                                                 T*             u2,
+                                                 rocsparse_int* p)
 {
-    std::vector<T>             l(m * batch_count, 0);
-    std::vector<T>             u0(m * batch_count, 0);
-    std::vector<T>             u1(m * batch_count, 0);
-    std::vector<T>             u2(m * batch_count, 0);
-    std::vector<rocsparse_int> p(m * batch_count, 0);
+    std::fill(u2, u2 + G * m, static_cast<T>(0));
+    std::fill(p, p + G * m, 0);
 
     for(rocsparse_int i = 0; i < m; i++)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            l[batch_count * i + j]  = dl[batch_stride * i + j];
-            u0[batch_count * i + j] = d[batch_stride * i + j];
-            u1[batch_count * i + j] = du[batch_stride * i + j];
+            l[G * i + k]  = dl[batch_stride * i + k];
+            u0[G * i + k] = d[batch_stride * i + k];
+            u1[G * i + k] = du[batch_stride * i + k];
         }
     }
 
     // LU decomposition
     for(rocsparse_int i = 0; i < m - 1; i++)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            T ak_1 = l[batch_count * (i + 1) + j];
-            T bk   = u0[batch_count * i + j];
+            T ak_1 = l[G * (i + 1) + k];
+            T bk   = u0[G * i + k];
 
             if(std::abs(bk) < std::abs(ak_1))
             {
-                T bk_1 = u0[batch_count * (i + 1) + j];
-                T ck   = u1[batch_count * i + j];
-                T ck_1 = u1[batch_count * (i + 1) + j];
-                T dk   = u2[batch_count * i + j];
+                T bk_1 = u0[G * (i + 1) + k];
+                T ck   = u1[G * i + k];
+                T ck_1 = u1[G * (i + 1) + k];
+                T dk   = u2[G * i + k];
 
-                u0[batch_count * i + j] = ak_1;
-                u1[batch_count * i + j] = bk_1;
-                u2[batch_count * i + j] = ck_1;
+                u0[G * i + k] = ak_1;
+                u1[G * i + k] = bk_1;
+                u2[G * i + k] = ck_1;
 
-                u0[batch_count * (i + 1) + j] = ck;
-                u1[batch_count * (i + 1) + j] = dk;
+                u0[G * (i + 1) + k] = ck;
+                u1[G * (i + 1) + k] = dk;
 
-                rocsparse_int pk             = p[batch_count * i + j];
-                p[batch_count * i + j]       = i + 1;
-                p[batch_count * (i + 1) + j] = pk;
+                rocsparse_int pk   = p[G * i + k];
+                p[G * i + k]       = i + 1;
+                p[G * (i + 1) + k] = pk;
 
-                T xk                          = x[batch_stride * i + j];
-                x[batch_stride * i + j]       = x[batch_stride * (i + 1) + j];
-                x[batch_stride * (i + 1) + j] = xk;
+                T xk                          = x[batch_stride * i + k];
+                x[batch_stride * i + k]       = x[batch_stride * (i + 1) + k];
+                x[batch_stride * (i + 1) + k] = xk;
 
-                T lk_1                       = bk / ak_1;
-                l[batch_count * (i + 1) + j] = lk_1;
+                T lk_1             = bk / ak_1;
+                l[G * (i + 1) + k] = lk_1;
 
-                u0[batch_count * (i + 1) + j]
-                    = u0[batch_count * (i + 1) + j] - lk_1 * u1[batch_count * i + j];
-                u1[batch_count * (i + 1) + j]
-                    = u1[batch_count * (i + 1) + j] - lk_1 * u2[batch_count * i + j];
+                u0[G * (i + 1) + k] = u0[G * (i + 1) + k] - lk_1 * u1[G * i + k];
+                u1[G * (i + 1) + k] = u1[G * (i + 1) + k] - lk_1 * u2[G * i + k];
             }
             else
             {
-                p[batch_count * (i + 1) + j] = i + 1;
+                p[G * (i + 1) + k] = i + 1;
 
-                T lk_1                       = ak_1 / bk;
-                l[batch_count * (i + 1) + j] = lk_1;
+                T lk_1             = ak_1 / bk;
+                l[G * (i + 1) + k] = lk_1;
 
-                u0[batch_count * (i + 1) + j]
-                    = u0[batch_count * (i + 1) + j] - lk_1 * u1[batch_count * i + j];
-                u1[batch_count * (i + 1) + j]
-                    = u1[batch_count * (i + 1) + j] - lk_1 * u2[batch_count * i + j];
+                u0[G * (i + 1) + k] = u0[G * (i + 1) + k] - lk_1 * u1[G * i + k];
+                u1[G * (i + 1) + k] = u1[G * (i + 1) + k] - lk_1 * u2[G * i + k];
             }
         }
     }
 
     // Forward elimination (L * x_new = x_old)
-    std::vector<rocsparse_int> start(batch_count, 0);
+    rocsparse_int start[G] = {};
     for(rocsparse_int i = 1; i < m; i++)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            if(p[batch_count * i + j] <= i) // no pivoting occured, sum up result
+            if(p[G * i + k] <= i) // no pivoting occured, sum up result
             {
                 T temp = static_cast<T>(0);
-                for(rocsparse_int s = start[j]; s < i; s++)
+                for(rocsparse_int s = start[k]; s < i; s++)
                 {
-                    temp = temp - l[batch_count * (s + 1) + j] * x[batch_stride * s + j];
+                    temp = temp - l[G * (s + 1) + k] * x[batch_stride * s + k];
                 }
-                x[batch_stride * i + j] = x[batch_stride * i + j] + temp;
-                start[j] += i - start[j];
+                x[batch_stride * i + k] = x[batch_stride * i + k] + temp;
+                start[k] += i - start[k];
             }
         }
     }
 
     // backward substitution (U * x_newest = x_new)
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int k = 0; k < G; k++)
     {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / u0[batch_count * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - u1[batch_count * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / u0[batch_count * (m - 2) + j];
+        x[batch_stride * (m - 1) + k] = x[batch_stride * (m - 1) + k] / u0[G * (m - 1) + k];
+        x[batch_stride * (m - 2) + k]
+            = (x[batch_stride * (m - 2) + k] - u1[G * (m - 2) + k] * x[batch_stride * (m - 1) + k])
+              / u0[G * (m - 2) + k];
     }
 
     for(rocsparse_int i = m - 3; i >= 0; i--)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            x[batch_stride * i + j]
-                = (x[batch_stride * i + j] - u1[batch_count * i + j] * x[batch_stride * (i + 1) + j]
-                   - u2[batch_count * i + j] * x[batch_stride * (i + 2) + j])
-                  / u0[batch_count * i + j];
+            x[batch_stride * i + k]
+                = (x[batch_stride * i + k] - u1[G * i + k] * x[batch_stride * (i + 1) + k]
+                   - u2[G * i + k] * x[batch_stride * (i + 2) + k])
+                  / u0[G * i + k];
         }
     }
 }
 
 template <typename T>
-void host_gtsv_interleaved_batch_qr(rocsparse_int m,
+void host_gtsv_interleaved_batch_lu(rocsparse_int m,
                                     const T*      dl,
                                     const T*      d,
                                     const T*      du,
@@ -6517,19 +7516,81 @@ void host_gtsv_interleaved_batch_qr(rocsparse_int m,
                                     rocsparse_int batch_count,
                                     rocsparse_int batch_stride)
 {
-    std::vector<T> r0(m * batch_count, 0);
-    std::vector<T> r1(m * batch_count, 0);
-    std::vector<T> r2(m * batch_count, 0);
+    static constexpr rocsparse_int G = host_batch_group_size<T>::value;
 
-    for(rocsparse_int i = 0; i < m; i++)
+    rocsparse_int ngroups = batch_count / G;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
+        std::vector<T>             l(G * m);
+        std::vector<T>             u0(G * m);
+        std::vector<T>             u1(G * m);
+        std::vector<T>             u2(G * m);
+        std::vector<rocsparse_int> p(G * m);
+
+        // Groups of G systems
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int g = 0; g < ngroups; g++)
+        {
+            rocsparse_int j = G * g;
+
+            host_gtsv_interleaved_batch_lu_group<G>(m,
+                                                    dl + j,
+                                                    d + j,
+                                                    du + j,
+                                                    x + j,
+                                                    batch_stride,
+                                                    l.data(),
+                                                    u0.data(),
+                                                    u1.data(),
+                                                    u2.data(),
+                                                    p.data());
+        }
+
+        // Remaining systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = G * ngroups; j < batch_count; j++)
+        {
+            host_gtsv_interleaved_batch_lu_group<1>(m,
+                                                    dl + j,
+                                                    d + j,
+                                                    du + j,
+                                                    x + j,
+                                                    batch_stride,
+                                                    l.data(),
+                                                    u0.data(),
+                                                    u1.data(),
+                                                    u2.data(),
+                                                    p.data());
+        }
+    }
+}
+
+// QR decomposition with Givens rotations on a group of G interleaved systems. The pointers
+// are offset to the first system of the group and the work arrays are of size G * m each.
+template <rocsparse_int G, typename T>
+static void host_gtsv_interleaved_batch_qr_group(rocsparse_int m,
+                                                 const T*      dl,
+                                                 const T*      d,
+                                                 const T*      du,
+                                                 T*            x,
+                                                 rocsparse_int batch_stride,
+                                                 T*            r0,
+                                                 T*            r1,
+                                                 T*            r2)
+{
+    for(rocsparse_int i = 0; i < m; i++)
+    {
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            r0[batch_count * i + j] = d[batch_stride * i + j];
-            r1[batch_count * i + j] = du[batch_stride * i + j];
+            r0[G * i + k] = d[batch_stride * i + k];
+            r1[G * i + k] = du[batch_stride * i + k];
         }
     }
 
@@ -6547,16 +7608,13 @@ void host_gtsv_interleaved_batch_qr(rocsparse_int m,
     //     0  0  0  a4 b4
     for(rocsparse_int i = 0; i < m - 1; i++)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
-            T ak_1 = dl[batch_stride * (i + 1) + j];
-            T bk   = r0[batch_count * i + j];
-            T bk_1 = r0[batch_count * (i + 1) + j];
-            T ck   = r1[batch_count * i + j];
-            T ck_1 = r1[batch_count * (i + 1) + j];
+            T ak_1 = dl[batch_stride * (i + 1) + k];
+            T bk   = r0[G * i + k];
+            T bk_1 = r0[G * (i + 1) + k];
+            T ck   = r1[G * i + k];
+            T ck_1 = r1[G * (i + 1) + k];
 
             T radius = std::sqrt(std::abs(bk * rocsparse_conj(bk) + ak_1 * rocsparse_conj(ak_1)));
 
@@ -6566,49 +7624,86 @@ void host_gtsv_interleaved_batch_qr(rocsparse_int m,
             T cos_theta = rocsparse_conj(bk) / radius;
             T sin_theta = rocsparse_conj(ak_1) / radius;
 
-            r0[batch_count * i + j] = std::fma(bk, cos_theta, ak_1 * sin_theta);
-            r0[batch_count * (i + 1) + j]
+            r0[G * i + k] = std::fma(bk, cos_theta, ak_1 * sin_theta);
+            r0[G * (i + 1) + k]
                 = std::fma(-ck, rocsparse_conj(sin_theta), bk_1 * rocsparse_conj(cos_theta));
-            r1[batch_count * i + j]       = std::fma(ck, cos_theta, bk_1 * sin_theta);
-            r1[batch_count * (i + 1) + j] = ck_1 * rocsparse_conj(cos_theta);
-            r2[batch_count * i + j]       = ck_1 * sin_theta;
+            r1[G * i + k]       = std::fma(ck, cos_theta, bk_1 * sin_theta);
+            r1[G * (i + 1) + k] = ck_1 * rocsparse_conj(cos_theta);
+            r2[G * i + k]       = ck_1 * sin_theta;
 
             // Apply Givens rotation to rhs vector
             // | cos  sin | |xk  |
             // |-sin  cos | |xk_1|
-            T xk                    = x[batch_stride * i + j];
-            T xk_1                  = x[batch_stride * (i + 1) + j];
-            x[batch_stride * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-            x[batch_stride * (i + 1) + j]
+            T xk                    = x[batch_stride * i + k];
+            T xk_1                  = x[batch_stride * (i + 1) + k];
+            x[batch_stride * i + k] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+            x[batch_stride * (i + 1) + k]
                 = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
         }
     }
 
     // Backward substitution on upper triangular R * x = x
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int k = 0; k < G; k++)
     {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / r0[batch_count * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - r1[batch_count * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / r0[batch_count * (m - 2) + j];
+        x[batch_stride * (m - 1) + k] = x[batch_stride * (m - 1) + k] / r0[G * (m - 1) + k];
+        x[batch_stride * (m - 2) + k]
+            = (x[batch_stride * (m - 2) + k] - r1[G * (m - 2) + k] * x[batch_stride * (m - 1) + k])
+              / r0[G * (m - 2) + k];
     }
 
     for(rocsparse_int i = m - 3; i >= 0; i--)
     {
+        for(rocsparse_int k = 0; k < G; k++)
+        {
+            x[batch_stride * i + k]
+                = (x[batch_stride * i + k] - r1[G * i + k] * x[batch_stride * (i + 1) + k]
+                   - r2[G * i + k] * x[batch_stride * (i + 2) + k])
+                  / r0[G * i + k];
+        }
+    }
+}
+
+template <typename T>
+void host_gtsv_interleaved_batch_qr(rocsparse_int m,
+                                    const T*      dl,
+                                    const T*      d,
+                                    const T*      du,
+                                    T*            x,
+                                    rocsparse_int batch_count,
+                                    rocsparse_int batch_stride)
+{
+    static constexpr rocsparse_int G = host_batch_group_size<T>::value;
+
+    rocsparse_int ngroups = batch_count / G;
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
+#endif
+    {
+        std::vector<T> r0(G * m);
+        std::vector<T> r1(G * m);
+        std::vector<T> r2(G * m);
+
+        // Groups of G systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int g = 0; g < ngroups; g++)
+        {
+            rocsparse_int j = G * g;
+
+            host_gtsv_interleaved_batch_qr_group<G>(
+                m, dl + j, d + j, du + j, x + j, batch_stride, r0.data(), r1.data(), r2.data());
+        }
+
+        // Remaining systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = G * ngroups; j < batch_count; j++)
         {
-            x[batch_stride * i + j]
-                = (x[batch_stride * i + j] - r1[batch_count * i + j] * x[batch_stride * (i + 1) + j]
-                   - r2[batch_count * i + j] * x[batch_stride * (i + 2) + j])
-                  / r0[batch_count * i + j];
+            host_gtsv_interleaved_batch_qr_group<1>(
+                m, dl + j, d + j, du + j, x + j, batch_stride, r0.data(), r1.data(), r2.data());
         }
     }
 }
@@ -6644,19 +7739,23 @@ void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
     }
 }
 
-template <typename T>
-void host_gpsv_interleaved_batch_qr(rocsparse_int m,
-                                    T*            ds,
-                                    T*            dl,
-                                    T*            d,
-                                    T*            du,
-                                    T*            dw,
-                                    T*            x,
-                                    rocsparse_int batch_count,
-                                    rocsparse_int batch_stride)
+// QR decomposition with Givens rotations on a group of G interleaved pentadiagonal systems. The
+// pointers are offset to the first system of the group and the work arrays are of size G * m
+// each.
+template <rocsparse_int G, typename T>
+static void host_gpsv_interleaved_batch_qr_group(rocsparse_int m,
+                                                 T*            ds,
+                                                 T*            dl,
+                                                 T*            d,
+                                                 T*            du,
+                                                 T*            dw,
+                                                 T*            x,
+                                                 rocsparse_int batch_stride,
+                                                 T*            r3,
+                                                 T*            r4)
 {
-    std::vector<T> r3(m * batch_count, 0);
-    std::vector<T> r4(m * batch_count, 0);
+    std::fill(r3, r3 + G * m, static_cast<T>(0));
+    std::fill(r4, r4 + G * m, static_cast<T>(0));
 
     // Reduce A = Q*R where Q is orthonormal and R is upper triangular
     // This means when solving A * x          = b
@@ -6672,10 +7771,7 @@ void host_gpsv_interleaved_batch_qr(rocsparse_int m,
     //     0  0  s4  l4 d4
     for(rocsparse_int i = 0; i < m - 2; i++)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int k = 0; k < G; k++)
         {
             // For penta diagonal matrices, need to apply two givens rotations to remove lower and lower - 1 entries
             T radius    = static_cast<T>(0);
@@ -6685,15 +7781,15 @@ void host_gpsv_interleaved_batch_qr(rocsparse_int m,
             // Apply first Givens rotation
             // | cos  sin | |lk_1 dk_1 uk_1 wk_1 0   |
             // |-sin  cos | |sk_2 lk_2 dk_2 uk_2 wk_2|
-            T sk_2 = ds[batch_stride * (i + 2) + j];
-            T lk_1 = dl[batch_stride * (i + 1) + j];
-            T lk_2 = dl[batch_stride * (i + 2) + j];
-            T dk_1 = d[batch_stride * (i + 1) + j];
-            T dk_2 = d[batch_stride * (i + 2) + j];
-            T uk_1 = du[batch_stride * (i + 1) + j];
-            T uk_2 = du[batch_stride * (i + 2) + j];
-            T wk_1 = dw[batch_stride * (i + 1) + j];
-            T wk_2 = dw[batch_stride * (i + 2) + j];
+            T sk_2 = ds[batch_stride * (i + 2) + k];
+            T lk_1 = dl[batch_stride * (i + 1) + k];
+            T lk_2 = dl[batch_stride * (i + 2) + k];
+            T dk_1 = d[batch_stride * (i + 1) + k];
+            T dk_2 = d[batch_stride * (i + 2) + k];
+            T uk_1 = du[batch_stride * (i + 1) + k];
+            T uk_2 = du[batch_stride * (i + 2) + k];
+            T wk_1 = dw[batch_stride * (i + 1) + k];
+            T wk_2 = dw[batch_stride * (i + 2) + k];
 
             radius = std::sqrt(
                 std::abs(std::fma(lk_1, rocsparse_conj(lk_1), sk_2 * rocsparse_conj(sk_2))));
@@ -6705,157 +7801,210 @@ void host_gpsv_interleaved_batch_qr(rocsparse_int m,
             T duk_1_new = std::fma(uk_1, cos_theta, dk_2 * sin_theta);
             T dwk_1_new = std::fma(wk_1, cos_theta, uk_2 * sin_theta);
 
-            dl[batch_stride * (i + 1) + j] = dlk_1_new;
-            dl[batch_stride * (i + 2) + j]
+            dl[batch_stride * (i + 1) + k] = dlk_1_new;
+            dl[batch_stride * (i + 2) + k]
                 = std::fma(-dk_1, rocsparse_conj(sin_theta), lk_2 * rocsparse_conj(cos_theta));
-            d[batch_stride * (i + 1) + j] = dk_1_new;
-            d[batch_stride * (i + 2) + j]
+            d[batch_stride * (i + 1) + k] = dk_1_new;
+            d[batch_stride * (i + 2) + k]
                 = std::fma(-uk_1, rocsparse_conj(sin_theta), dk_2 * rocsparse_conj(cos_theta));
-            du[batch_stride * (i + 1) + j] = duk_1_new;
-            du[batch_stride * (i + 2) + j]
+            du[batch_stride * (i + 1) + k] = duk_1_new;
+            du[batch_stride * (i + 2) + k]
                 = std::fma(-wk_1, rocsparse_conj(sin_theta), uk_2 * rocsparse_conj(cos_theta));
-            dw[batch_stride * (i + 1) + j] = dwk_1_new;
-            dw[batch_stride * (i + 2) + j] = wk_2 * rocsparse_conj(cos_theta);
-            r3[batch_count * (i + 1) + j]  = wk_2 * sin_theta;
+            dw[batch_stride * (i + 1) + k] = dwk_1_new;
+            dw[batch_stride * (i + 2) + k] = wk_2 * rocsparse_conj(cos_theta);
+            r3[G * (i + 1) + k]            = wk_2 * sin_theta;
 
             // Apply first Givens rotation to rhs vector
             // | cos  sin | |xk_1|
             // |-sin  cos | |xk_2|
-            T xk_1                        = x[batch_stride * (i + 1) + j];
-            T xk_2                        = x[batch_stride * (i + 2) + j];
-            x[batch_stride * (i + 1) + j] = std::fma(xk_1, cos_theta, xk_2 * sin_theta);
-            x[batch_stride * (i + 2) + j]
+            T xk_1                        = x[batch_stride * (i + 1) + k];
+            T xk_2                        = x[batch_stride * (i + 2) + k];
+            x[batch_stride * (i + 1) + k] = std::fma(xk_1, cos_theta, xk_2 * sin_theta);
+            x[batch_stride * (i + 2) + k]
                 = std::fma(-xk_1, rocsparse_conj(sin_theta), xk_2 * rocsparse_conj(cos_theta));
 
             // Apply second Givens rotation
             // | cos  sin | |dk   uk   wk   rk   0   |
             // |-sin  cos | |lk_1 dk_1 uk_1 wk_1 rk_1|
             lk_1   = dlk_1_new;
-            T dk   = d[batch_stride * i + j];
+            T dk   = d[batch_stride * i + k];
             dk_1   = dk_1_new;
-            T uk   = du[batch_stride * i + j];
+            T uk   = du[batch_stride * i + k];
             uk_1   = duk_1_new;
-            T wk   = dw[batch_stride * i + j];
+            T wk   = dw[batch_stride * i + k];
             wk_1   = dwk_1_new;
-            T rk   = r3[batch_count * i + j];
-            T rk_1 = r3[batch_count * (i + 1) + j];
+            T rk   = r3[G * i + k];
+            T rk_1 = r3[G * (i + 1) + k];
 
             radius = std::sqrt(
                 std::abs(std::fma(dk, rocsparse_conj(dk), lk_1 * rocsparse_conj(lk_1))));
             cos_theta = rocsparse_conj(dk) / radius;
             sin_theta = rocsparse_conj(lk_1) / radius;
 
-            d[batch_stride * i + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
-            d[batch_stride * (i + 1) + j]
+            d[batch_stride * i + k] = std::fma(dk, cos_theta, lk_1 * sin_theta);
+            d[batch_stride * (i + 1) + k]
                 = std::fma(-uk, rocsparse_conj(sin_theta), dk_1 * rocsparse_conj(cos_theta));
-            du[batch_stride * i + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
-            du[batch_stride * (i + 1) + j]
+            du[batch_stride * i + k] = std::fma(uk, cos_theta, dk_1 * sin_theta);
+            du[batch_stride * (i + 1) + k]
                 = std::fma(-wk, rocsparse_conj(sin_theta), uk_1 * rocsparse_conj(cos_theta));
-            dw[batch_stride * i + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
-            dw[batch_stride * (i + 1) + j]
+            dw[batch_stride * i + k] = std::fma(wk, cos_theta, uk_1 * sin_theta);
+            dw[batch_stride * (i + 1) + k]
                 = std::fma(-rk, rocsparse_conj(sin_theta), wk_1 * rocsparse_conj(cos_theta));
-            r3[batch_count * i + j]       = std::fma(rk, cos_theta, wk_1 * sin_theta);
-            r3[batch_count * (i + 1) + j] = rk_1 * rocsparse_conj(cos_theta);
-            r4[batch_count * i + j]       = rk_1 * sin_theta;
+            r3[G * i + k]       = std::fma(rk, cos_theta, wk_1 * sin_theta);
+            r3[G * (i + 1) + k] = rk_1 * rocsparse_conj(cos_theta);
+            r4[G * i + k]       = rk_1 * sin_theta;
 
             // Apply second Givens rotation to rhs vector
             // | cos  sin | |xk  |
             // |-sin  cos | |xk_1|
-            T xk                    = x[batch_stride * i + j];
-            xk_1                    = x[batch_stride * (i + 1) + j];
-            x[batch_stride * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-            x[batch_stride * (i + 1) + j]
+            T xk                    = x[batch_stride * i + k];
+            xk_1                    = x[batch_stride * (i + 1) + k];
+            x[batch_stride * i + k] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+            x[batch_stride * (i + 1) + k]
                 = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
         }
     }
 
     // Apply last givens rotation
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int k = 0; k < G; k++)
     {
         // Apply last Givens rotation
         // | cos  sin | |dk   uk   wk   rk   0   |
         // |-sin  cos | |lk_1 dk_1 uk_1 wk_1 rk_1|
-        T lk_1 = dl[batch_stride * (m - 1) + j];
-        T dk   = d[batch_stride * (m - 2) + j];
-        T dk_1 = d[batch_stride * (m - 1) + j];
-        T uk   = du[batch_stride * (m - 2) + j];
-        T uk_1 = du[batch_stride * (m - 1) + j];
-        T wk   = dw[batch_stride * (m - 2) + j];
-        T wk_1 = dw[batch_stride * (m - 1) + j];
-        T rk   = r3[batch_count * (m - 2) + j];
-        T rk_1 = r3[batch_count * (m - 1) + j];
+        T lk_1 = dl[batch_stride * (m - 1) + k];
+        T dk   = d[batch_stride * (m - 2) + k];
+        T dk_1 = d[batch_stride * (m - 1) + k];
+        T uk   = du[batch_stride * (m - 2) + k];
+        T uk_1 = du[batch_stride * (m - 1) + k];
+        T wk   = dw[batch_stride * (m - 2) + k];
+        T wk_1 = dw[batch_stride * (m - 1) + k];
+        T rk   = r3[G * (m - 2) + k];
+        T rk_1 = r3[G * (m - 1) + k];
 
         T radius
             = std::sqrt(std::abs(std::fma(dk, rocsparse_conj(dk), lk_1 * rocsparse_conj(lk_1))));
         T cos_theta = rocsparse_conj(dk) / radius;
         T sin_theta = rocsparse_conj(lk_1) / radius;
 
-        d[batch_stride * (m - 2) + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
-        d[batch_stride * (m - 1) + j]
+        d[batch_stride * (m - 2) + k] = std::fma(dk, cos_theta, lk_1 * sin_theta);
+        d[batch_stride * (m - 1) + k]
             = std::fma(-uk, rocsparse_conj(sin_theta), dk_1 * rocsparse_conj(cos_theta));
-        du[batch_stride * (m - 2) + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
-        du[batch_stride * (m - 1) + j]
+        du[batch_stride * (m - 2) + k] = std::fma(uk, cos_theta, dk_1 * sin_theta);
+        du[batch_stride * (m - 1) + k]
             = std::fma(-wk, rocsparse_conj(sin_theta), uk_1 * rocsparse_conj(cos_theta));
-        dw[batch_stride * (m - 2) + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
-        dw[batch_stride * (m - 1) + j]
+        dw[batch_stride * (m - 2) + k] = std::fma(wk, cos_theta, uk_1 * sin_theta);
+        dw[batch_stride * (m - 1) + k]
             = std::fma(-rk, rocsparse_conj(sin_theta), wk_1 * rocsparse_conj(cos_theta));
-        r3[batch_count * (m - 2) + j] = std::fma(rk, cos_theta, wk_1 * sin_theta);
-        r3[batch_count * (m - 1) + j] = rk_1 * rocsparse_conj(cos_theta);
-        r4[batch_count * (m - 2) + j] = rk_1 * sin_theta;
+        r3[G * (m - 2) + k] = std::fma(rk, cos_theta, wk_1 * sin_theta);
+        r3[G * (m - 1) + k] = rk_1 * rocsparse_conj(cos_theta);
+        r4[G * (m - 2) + k] = rk_1 * sin_theta;
 
         // Apply last Givens rotation to rhs vector
         // | cos  sin | |xk  |
         // |-sin  cos | |xk_1|
-        T xk                          = x[batch_stride * (m - 2) + j];
-        T xk_1                        = x[batch_stride * (m - 1) + j];
-        x[batch_stride * (m - 2) + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-        x[batch_stride * (m - 1) + j]
+        T xk                          = x[batch_stride * (m - 2) + k];
+        T xk_1                        = x[batch_stride * (m - 1) + k];
+        x[batch_stride * (m - 2) + k] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+        x[batch_stride * (m - 1) + k]
             = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
     }
 
     // Backward substitution on upper triangular R * x = x
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int k = 0; k < G; k++)
     {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / d[batch_stride * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - du[batch_stride * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 2) + j];
+        x[batch_stride * (m - 1) + k]
+            = x[batch_stride * (m - 1) + k] / d[batch_stride * (m - 1) + k];
+        x[batch_stride * (m - 2) + k]
+            = (x[batch_stride * (m - 2) + k]
+               - du[batch_stride * (m - 2) + k] * x[batch_stride * (m - 1) + k])
+              / d[batch_stride * (m - 2) + k];
 
-        x[batch_stride * (m - 3) + j]
-            = (x[batch_stride * (m - 3) + j]
-               - du[batch_stride * (m - 3) + j] * x[batch_stride * (m - 2) + j]
-               - dw[batch_stride * (m - 3) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 3) + j];
+        x[batch_stride * (m - 3) + k]
+            = (x[batch_stride * (m - 3) + k]
+               - du[batch_stride * (m - 3) + k] * x[batch_stride * (m - 2) + k]
+               - dw[batch_stride * (m - 3) + k] * x[batch_stride * (m - 1) + k])
+              / d[batch_stride * (m - 3) + k];
 
-        x[batch_stride * (m - 4) + j]
-            = (x[batch_stride * (m - 4) + j]
-               - du[batch_stride * (m - 4) + j] * x[batch_stride * (m - 3) + j]
-               - dw[batch_stride * (m - 4) + j] * x[batch_stride * (m - 2) + j]
-               - r3[batch_count * (m - 4) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 4) + j];
+        x[batch_stride * (m - 4) + k]
+            = (x[batch_stride * (m - 4) + k]
+               - du[batch_stride * (m - 4) + k] * x[batch_stride * (m - 3) + k]
+               - dw[batch_stride * (m - 4) + k] * x[batch_stride * (m - 2) + k]
+               - r3[G * (m - 4) + k] * x[batch_stride * (m - 1) + k])
+              / d[batch_stride * (m - 4) + k];
     }
 
     for(rocsparse_int i = m - 5; i >= 0; i--)
     {
+        for(rocsparse_int k = 0; k < G; k++)
+        {
+            x[batch_stride * i + k] = (x[batch_stride * i + k]
+                                       - du[batch_stride * i + k] * x[batch_stride * (i + 1) + k]
+                                       - dw[batch_stride * i + k] * x[batch_stride * (i + 2) + k]
+                                       - r3[G * i + k] * x[batch_stride * (i + 3) + k]
+                                       - r4[G * i + k] * x[batch_stride * (i + 4) + k])
+                                      / d[batch_stride * i + k];
+        }
+    }
+}
+
+template <typename T>
+void host_gpsv_interleaved_batch_qr(rocsparse_int m,
+                                    T*            ds,
+                                    T*            dl,
+                                    T*            d,
+                                    T*            du,
+                                    T*            dw,
+                                    T*            x,
+                                    rocsparse_int batch_count,
+                                    rocsparse_int batch_stride)
+{
+    static constexpr rocsparse_int G = host_batch_group_size<T>::value;
+
+    rocsparse_int ngroups = batch_count / G;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<T> r3(G * m);
+        std::vector<T> r4(G * m);
+
+        // Groups of G systems
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int g = 0; g < ngroups; g++)
+        {
+            rocsparse_int j = G * g;
+
+            host_gpsv_interleaved_batch_qr_group<G>(m,
+                                                    ds + j,
+                                                    dl + j,
+                                                    d + j,
+                                                    du + j,
+                                                    dw + j,
+                                                    x + j,
+                                                    batch_stride,
+                                                    r3.data(),
+                                                    r4.data());
+        }
+
+        // Remaining systems
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = G * ngroups; j < batch_count; j++)
         {
-            x[batch_stride * i + j] = (x[batch_stride * i + j]
-                                       - du[batch_stride * i + j] * x[batch_stride * (i + 1) + j]
-                                       - dw[batch_stride * i + j] * x[batch_stride * (i + 2) + j]
-                                       - r3[batch_count * i + j] * x[batch_stride * (i + 3) + j]
-                                       - r4[batch_count * i + j] * x[batch_stride * (i + 4) + j])
-                                      / d[batch_stride * i + j];
+            host_gpsv_interleaved_batch_qr_group<1>(m,
+                                                    ds + j,
+                                                    dl + j,
+                                                    d + j,
+                                                    du + j,
+                                                    dw + j,
+                                                    x + j,
+                                                    batch_stride,
+                                                    r3.data(),
+                                                    r4.data());
         }
     }
 }
@@ -7032,74 +8181,34 @@ void host_dense2csx(J                    m,
 {
     static constexpr T s_zero = {};
     J                  len    = (rocsparse_direction_row == DIRA) ? m : n;
+    J                  width  = (rocsparse_direction_row == DIRA) ? n : m;
     *csx_row_col_ptr          = base;
     for(J i = 0; i < len; ++i)
     {
         csx_row_col_ptr[i + 1] = nnz_per_row_columns[i] + csx_row_col_ptr[i];
     }
 
-    switch(DIRA)
-    {
-    case rocsparse_direction_column:
+    // Each row (column) fills its own range of the compressed arrays
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < len; ++i)
     {
-        for(J j = 0; j < n; ++j)
-        {
-            for(J i = 0; i < m; ++i)
-            {
-                if(order == rocsparse_order_column)
-                {
-                    if(A[j * ld + i] != s_zero)
-                    {
-                        *csx_val++         = A[j * ld + i];
-                        *csx_col_row_ind++ = i + base;
-                    }
-                }
-                else
-                {
-                    if(A[i * ld + j] != s_zero)
-                    {
-                        *csx_val++         = A[i * ld + j];
-                        *csx_col_row_ind++ = i + base;
-                    }
-                }
-            }
-        }
-
-        break;
-    }
+        I at = csx_row_col_ptr[i] - base;
 
-    case rocsparse_direction_row:
-    {
-        //
-        // Does not matter having an orthogonal traversal ... testing only.
-        // Otherwise, we would use csx_row_ptr_A to store the shifts.
-        // and once the job is done a simple memory move would reinitialize the csx_row_ptr_A to its initial state)
-        //
-        for(J i = 0; i < m; ++i)
+        for(J j = 0; j < width; ++j)
         {
-            for(J j = 0; j < n; ++j)
+            int64_t row = (rocsparse_direction_row == DIRA) ? i : j;
+            int64_t col = (rocsparse_direction_row == DIRA) ? j : i;
+            const T val = (order == rocsparse_order_column) ? A[col * ld + row] : A[row * ld + col];
+
+            if(val != s_zero)
             {
-                if(order == rocsparse_order_column)
-                {
-                    if(A[j * ld + i] != s_zero)
-                    {
-                        *csx_val++         = A[j * ld + i];
-                        *csx_col_row_ind++ = j + base;
-                    }
-                }
-                else
-                {
-                    if(A[i * ld + j] != s_zero)
-                    {
-                        *csx_val++         = A[i * ld + j];
-                        *csx_col_row_ind++ = j + base;
-                    }
-                }
+                csx_val[at]         = val;
+                csx_col_row_ind[at] = j + base;
+                ++at;
             }
         }
-
-        break;
-    }
     }
 }
 
@@ -7114,72 +8223,31 @@ void host_csx2dense(J                    m,
                     T*                   A,
                     int64_t              ld)
 {
-    if(order == rocsparse_order_column)
-    {
-        for(J col = 0; col < n; ++col)
-        {
-            for(J row = 0; row < m; ++row)
-            {
-                A[row + ld * col] = static_cast<T>(0);
-            }
-        }
-    }
-    else
-    {
-        for(J row = 0; row < m; ++row)
-        {
-            for(J col = 0; col < n; ++col)
-            {
-                A[col + ld * row] = static_cast<T>(0);
-            }
-        }
-    }
+    J len   = (rocsparse_direction_row == DIRA) ? m : n;
+    J width = (rocsparse_direction_row == DIRA) ? n : m;
 
-    if(DIRA == rocsparse_direction_column)
+    // Row (column) i of the sparse matrix only touches row (column) i of the dense matrix
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < len; ++i)
     {
-        for(J col = 0; col < n; ++col)
-        {
-            I start = csx_row_col_ptr[col] - base;
-            I end   = csx_row_col_ptr[col + 1] - base;
+        // Distance between consecutive entries of row (column) i in the dense matrix
+        bool    contiguous = (order == rocsparse_order_row) == (rocsparse_direction_row == DIRA);
+        int64_t stride     = contiguous ? 1 : ld;
+        T*      Ai         = A + (contiguous ? ld * i : i);
 
-            if(order == rocsparse_order_column)
-            {
-                for(I at = start; at < end; ++at)
-                {
-                    A[(csx_col_row_ind[at] - base) + ld * col] = csx_val[at];
-                }
-            }
-            else
-            {
-                for(I at = start; at < end; ++at)
-                {
-                    A[col + ld * (csx_col_row_ind[at] - base)] = csx_val[at];
-                }
-            }
-        }
-    }
-    else
-    {
-        for(J row = 0; row < m; ++row)
+        for(J j = 0; j < width; ++j)
         {
-            I start = csx_row_col_ptr[row] - base;
-            I end   = csx_row_col_ptr[row + 1] - base;
+            Ai[stride * j] = static_cast<T>(0);
+        }
 
-            if(order == rocsparse_order_column)
-            {
-                for(I at = start; at < end; ++at)
-                {
-                    A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
-                }
-            }
-            else
-            {
-                for(I at = start; at < end; ++at)
-                {
+        I start = csx_row_col_ptr[i] - base;
+        I end   = csx_row_col_ptr[i + 1] - base;
 
-                    A[row * ld + (csx_col_row_ind[at] - base)] = csx_val[at];
-                }
-            }
+        for(I at = start; at < end; ++at)
+        {
+            Ai[stride * (csx_col_row_ind[at] - base)] = csx_val[at];
         }
     }
 }
@@ -7276,49 +8344,171 @@ void host_coo_to_dense(I                     m,
         }
     }
 
-    for(int64_t i = 0; i < nnz; i++)
+    for(int64_t i = 0; i < nnz; i++)
+    {
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
+        T val = coo_val[i];
+
+        if(order == rocsparse_order_column)
+        {
+            A[ld * col + row] = val;
+        }
+        else
+        {
+            A[ld * row + col] = val;
+        }
+    }
+}
+
+// Stable transpose of the sparsity pattern of a CSR matrix. The rows are split into chunks of
+// about the same number of entries and every chunk counts its entries per column. A prefix sum
+// over the chunks then yields a disjoint range of each column for every chunk, such that the
+// chunks can scatter their entries in parallel while the rows within each column remain sorted.
+// perm[k] is set to the (zero based) CSR position of the k-th CSC entry.
+template <typename I, typename J>
+static void host_csr_transpose_pattern(J                    M,
+                                       J                    N,
+                                       I                    nnz,
+                                       const I*             csr_row_ptr,
+                                       const J*             csr_col_ind,
+                                       J*                   csc_row_ind,
+                                       I*                   csc_col_ptr,
+                                       I*                   perm,
+                                       rocsparse_index_base csr_base,
+                                       rocsparse_index_base csc_base)
+{
+    // Limit the number of chunks, such that the per chunk column counts do not exceed the
+    // size of the matrix
+    int64_t nchunks = 1;
+#ifdef _OPENMP
+    nchunks = omp_get_max_threads();
+#endif
+    nchunks = std::max<int64_t>(1, std::min<int64_t>(nchunks, nnz / std::max<J>(N, 1)));
+
+    std::vector<J> chunk_ptr(nchunks + 1);
+    for(int64_t t = 0; t <= nchunks; ++t)
+    {
+        chunk_ptr[t] = std::lower_bound(csr_row_ptr, csr_row_ptr + M, csr_base + nnz * t / nchunks)
+                       - csr_row_ptr;
+    }
+    chunk_ptr[nchunks] = M;
+
+    // Number of entries per chunk and column, turned into the offset of each chunk within
+    // each column below
+    std::vector<I> offset(nchunks * N, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int64_t t = 0; t < nchunks; ++t)
+        {
+            I* count = offset.data() + t * N;
+
+            I chunk_begin = csr_row_ptr[chunk_ptr[t]] - csr_base;
+            I chunk_end   = csr_row_ptr[chunk_ptr[t + 1]] - csr_base;
+
+            for(I j = chunk_begin; j < chunk_end; ++j)
+            {
+                ++count[csr_col_ind[j] - csr_base];
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(J c = 0; c < N; ++c)
+        {
+            I sum = 0;
+            for(int64_t t = 0; t < nchunks; ++t)
+            {
+                I count           = offset[t * N + c];
+                offset[t * N + c] = sum;
+                sum += count;
+            }
+
+            csc_col_ptr[c + 1] = sum;
+        }
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+        {
+            csc_col_ptr[0] = 0;
+            for(J c = 0; c < N; ++c)
+            {
+                csc_col_ptr[c + 1] += csc_col_ptr[c];
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int64_t t = 0; t < nchunks; ++t)
+        {
+            I* pos = offset.data() + t * N;
+
+            for(J i = chunk_ptr[t]; i < chunk_ptr[t + 1]; ++i)
+            {
+                I row_begin = csr_row_ptr[i] - csr_base;
+                I row_end   = csr_row_ptr[i + 1] - csr_base;
+
+                for(I j = row_begin; j < row_end; ++j)
+                {
+                    J col = csr_col_ind[j] - csr_base;
+                    I idx = csc_col_ptr[col] + pos[col]++;
+
+                    csc_row_ind[idx] = i + csc_base;
+                    perm[idx]        = j;
+                }
+            }
+        }
+    }
+
+    for(J c = 0; c <= N; ++c)
     {
-        I row = coo_row_ind[i] - base;
-        I col = coo_col_ind[i] - base;
-        T val = coo_val[i];
-
-        if(order == rocsparse_order_column)
-        {
-            A[ld * col + row] = val;
-        }
-        else
-        {
-            A[ld * row + col] = val;
-        }
+        csc_col_ptr[c] += csc_base;
     }
 }
 
-template <typename I, typename J, typename T>
-void host_csr_to_csc(J                    M,
-                     J                    N,
-                     I                    nnz,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     std::vector<J>&      csc_row_ind,
-                     std::vector<I>&      csc_col_ptr,
-                     std::vector<T>&      csc_val,
-                     rocsparse_action     action,
-                     rocsparse_index_base base)
+template <typename I, typename J>
+void host_coo_to_csr(J M, I nnz, const J* coo_row_ind, I* csr_row_ptr, rocsparse_index_base base)
 {
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
+    // Resize and initialize csr_row_ptr with zeros
+    for(size_t i = 0; i < M + 1; ++i)
+    {
+        csr_row_ptr[i] = 0;
+    }
+
+    for(size_t i = 0; i < nnz; ++i)
     {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
     }
 
-    // Scan
-    for(J i = 0; i < N; ++i)
+    csr_row_ptr[0] = base;
+    for(J i = 0; i < M; ++i)
     {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
     }
+}
 
-    // Fill row indices and values
+template <typename I, typename J>
+void host_csr_to_coo(J                     M,
+                     I                     nnz,
+                     const std::vector<I>& csr_row_ptr,
+                     std::vector<J>&       coo_row_ind,
+                     rocsparse_index_base  base)
+{
+    // Resize coo_row_ind
+    coo_row_ind.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
     for(J i = 0; i < M; ++i)
     {
         I row_begin = csr_row_ptr[i] - base;
@@ -7326,28 +8516,106 @@ void host_csr_to_csc(J                    M,
 
         for(I j = row_begin; j < row_end; ++j)
         {
-            J col = csr_col_ind[j] - base;
-            I idx = csc_col_ptr[col];
-
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
-
-            ++csc_col_ptr[col];
+            coo_row_ind[j] = i + base;
         }
     }
+}
 
-    // Shift column pointer array
-    for(J i = N; i > 0; --i)
+template <typename I, typename J>
+void host_csr_to_coo_aos(J                     M,
+                         I                     nnz,
+                         const std::vector<I>& csr_row_ptr,
+                         const std::vector<J>& csr_col_ind,
+                         std::vector<I>&       coo_ind,
+                         rocsparse_index_base  base)
+{
+    // Resize coo_ind
+    coo_ind.resize(2 * nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
     {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            coo_ind[2 * j]     = i + base;
+            coo_ind[2 * j + 1] = static_cast<I>(csr_col_ind[j]);
+        }
     }
+}
+
+template <typename I, typename J>
+void host_csr_to_csc_pattern(J                    M,
+                             J                    N,
+                             I                    nnz,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             std::vector<J>&      csc_row_ind,
+                             std::vector<I>&      csc_col_ptr,
+                             std::vector<I>&      perm,
+                             rocsparse_index_base base)
+{
+    csc_row_ind.resize(nnz);
+    csc_col_ptr.resize(N + 1);
+    perm.resize(nnz);
+
+    host_csr_transpose_pattern(M,
+                               N,
+                               nnz,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csc_row_ind.data(),
+                               csc_col_ptr.data(),
+                               perm.data(),
+                               base,
+                               base);
+}
 
-    if(csc_col_ptr.size() > 0)
+template <typename I, typename T>
+void host_csr_to_csc_values(I nnz, const I* perm, const T* csr_val, T* csc_val)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I i = 0; i < nnz; ++i)
     {
-        csc_col_ptr[0] = base;
+        csc_val[i] = csr_val[perm[i]];
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csr_to_csc(J                    M,
+                     J                    N,
+                     I                    nnz,
+                     const I*             csr_row_ptr,
+                     const J*             csr_col_ind,
+                     const T*             csr_val,
+                     std::vector<J>&      csc_row_ind,
+                     std::vector<I>&      csc_col_ptr,
+                     std::vector<T>&      csc_val,
+                     rocsparse_action     action,
+                     rocsparse_index_base base)
+{
+    std::vector<I> perm(nnz);
+
+    host_csr_transpose_pattern(M,
+                               N,
+                               nnz,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csc_row_ind.data(),
+                               csc_col_ptr.data(),
+                               perm.data(),
+                               base,
+                               base);
+
+    host_csr_to_csc_values(nnz, perm.data(), csr_val, csc_val.data());
+}
+
 template <typename T>
 void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
@@ -7585,50 +8853,32 @@ void host_gebsr_to_gebsc(rocsparse_int                     Mb,
     bsc_col_ptr.resize(Nb + 1, 0);
     bsc_val.resize(nnzb * row_block_dim * col_block_dim);
 
-    const rocsparse_int block_shift = row_block_dim * col_block_dim;
+    const int64_t block_shift = row_block_dim * col_block_dim;
 
-    //
-    // Determine nnz per column
-    //
-    for(rocsparse_int i = 0; i < nnzb; ++i)
-    {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - base];
-    }
+    std::vector<rocsparse_int> perm(nnzb);
 
-    // Scan
-    for(rocsparse_int i = 0; i < Nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
+    host_csr_transpose_pattern(Mb,
+                               Nb,
+                               nnzb,
+                               bsr_row_ptr.data(),
+                               bsr_col_ind.data(),
+                               bsc_row_ind.data(),
+                               bsc_col_ptr.data(),
+                               perm.data(),
+                               base,
+                               base);
 
-    // Fill row indices and values
-    for(rocsparse_int i = 0; i < Mb; ++i)
+    // Gather the blocks
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int i = 0; i < nnzb; ++i)
     {
-        const rocsparse_int row_begin = bsr_row_ptr[i] - base;
-        const rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
-
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        for(int64_t k = 0; k < block_shift; ++k)
         {
-            const rocsparse_int col = bsr_col_ind[j] - base;
-            const rocsparse_int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + base;
-            for(rocsparse_int k = 0; k < block_shift; ++k)
-            {
-                bsc_val[idx * block_shift + k] = bsr_val[j * block_shift + k];
-            }
-
-            ++bsc_col_ptr[col];
+            bsc_val[block_shift * i + k] = bsr_val[block_shift * perm[i] + k];
         }
     }
-
-    // Shift column pointer array
-    for(rocsparse_int i = Nb; i > 0; --i)
-    {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + base;
-    }
-
-    bsc_col_ptr[0] = base;
 }
 
 template <typename T>
@@ -7790,51 +9040,36 @@ void host_bsr_to_bsc(rocsparse_int               mb,
     bsc_col_ptr.resize(nb + 1, 0);
     bsc_val.resize(nnzb * bsr_dim * bsr_dim);
 
-    // Determine nnz per column
-    for(rocsparse_int i = 0; i < nnzb; ++i)
-    {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
-    }
+    std::vector<rocsparse_int> perm(nnzb);
 
-    // Scan
-    for(rocsparse_int i = 0; i < nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
+    host_csr_transpose_pattern(mb,
+                               nb,
+                               nnzb,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsc_row_ind.data(),
+                               bsc_col_ptr.data(),
+                               perm.data(),
+                               bsr_base,
+                               bsc_base);
 
-    // Fill row indices and values
-    for(rocsparse_int i = 0; i < mb; ++i)
-    {
-        rocsparse_int row_begin = bsr_row_ptr[i] - bsr_base;
-        rocsparse_int row_end   = bsr_row_ptr[i + 1] - bsr_base;
+    // Gather the blocks, which are stored column-wise in the BSC matrix
+    const int64_t block_shift = bsr_dim * bsr_dim;
 
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int i = 0; i < nnzb; ++i)
+    {
+        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
         {
-            rocsparse_int col = bsr_col_ind[j] - bsr_base;
-            rocsparse_int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + bsc_base;
-
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
             {
-                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
-                {
-                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
-                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
-                }
+                bsc_val[block_shift * i + bi + bj * bsr_dim]
+                    = bsr_val[block_shift * perm[i] + bi * bsr_dim + bj];
             }
-
-            ++bsc_col_ptr[col];
         }
     }
-
-    // Shift column pointer array
-    for(rocsparse_int i = nb; i > 0; --i)
-    {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
-    }
-
-    bsc_col_ptr[0] = bsc_base;
 }
 
 template <typename T>
@@ -8206,45 +9441,322 @@ void host_ell_to_csr(rocsparse_int                     M,
     }
 }
 
-template <typename T>
-void host_coosort_by_column(rocsparse_int               M,
-                            rocsparse_int               nnz,
-                            std::vector<rocsparse_int>& coo_row_ind,
-                            std::vector<rocsparse_int>& coo_col_ind,
-                            std::vector<T>&             coo_val)
+// Number of bits that are required to represent v
+static inline int host_radix_bits(uint64_t v)
 {
-    // Permutation vector
-    std::vector<rocsparse_int> perm(nnz);
+    int bits = 0;
+    while(v != 0)
+    {
+        ++bits;
+        v >>= 1;
+    }
 
-    for(rocsparse_int i = 0; i < nnz; ++i)
+    return bits;
+}
+
+// Maximum number of bits that are sorted by a single pass of the host radix sort
+static constexpr int host_radix_max_digit_bits = 11;
+
+// Stable counting sort of keys and perm by the digit of width bits at position shift of the
+// keys, written to keys_out and perm_out. The keys are split into nchunks chunks that count
+// their digits independently, such that every chunk scatters into disjoint ranges of each
+// bucket. Returns false, without writing the output, if all keys share the same digit.
+template <typename K, typename I>
+static bool host_radix_sort_pass(I               n,
+                                 int             shift,
+                                 int             bits,
+                                 int64_t         nchunks,
+                                 const K*        keys,
+                                 const I*        perm,
+                                 K*              keys_out,
+                                 I*              perm_out,
+                                 std::vector<I>& offset)
+{
+    const int64_t radix = int64_t(1) << bits;
+    const K       mask  = static_cast<K>(radix - 1);
+
+    std::fill(offset.begin(), offset.end(), static_cast<I>(0));
+
+    bool uniform = false;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        perm[i] = i;
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int64_t t = 0; t < nchunks; ++t)
+        {
+            I* count = offset.data() + t * radix;
+
+            I chunk_begin = n * t / nchunks;
+            I chunk_end   = n * (t + 1) / nchunks;
+
+            for(I i = chunk_begin; i < chunk_end; ++i)
+            {
+                ++count[(keys[i] >> shift) & mask];
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+        {
+            // Nothing to do if the bucket of the first key holds all keys
+            int64_t first = (keys[0] >> shift) & mask;
+            I       size  = 0;
+
+            for(int64_t t = 0; t < nchunks; ++t)
+            {
+                size += offset[t * radix + first];
+            }
+
+            uniform = (size == n);
+
+            // Offset of each chunk within each bucket
+            I sum = 0;
+            for(int64_t b = 0; b < radix; ++b)
+            {
+                for(int64_t t = 0; t < nchunks; ++t)
+                {
+                    I count               = offset[t * radix + b];
+                    offset[t * radix + b] = sum;
+                    sum += count;
+                }
+            }
+        }
+
+        if(!uniform)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+            for(int64_t t = 0; t < nchunks; ++t)
+            {
+                I* pos = offset.data() + t * radix;
+
+                I chunk_begin = n * t / nchunks;
+                I chunk_end   = n * (t + 1) / nchunks;
+
+                for(I i = chunk_begin; i < chunk_end; ++i)
+                {
+                    I idx = pos[(keys[i] >> shift) & mask]++;
+
+                    keys_out[idx] = keys[i];
+                    perm_out[idx] = perm[i];
+                }
+            }
+        }
+    }
+
+    return !uniform;
+}
+
+// Stable LSD radix sort of perm by the keys (high[perm[i]] - high_min, low[perm[i]] - low_min),
+// which require high_bits and low_bits bits, respectively. The composite key has to fit into K.
+// high can be nullptr to sort by low only.
+template <typename K, typename I, typename J>
+static void host_radix_sort_permutation(I        n,
+                                        const J* high,
+                                        J        high_min,
+                                        int      high_bits,
+                                        const J* low,
+                                        J        low_min,
+                                        int      low_bits,
+                                        I*       perm)
+{
+    const int bits = high_bits + low_bits;
+
+    if(n <= 1 || bits == 0)
+    {
+        return;
     }
 
-    std::vector<rocsparse_int> tmp_row(nnz);
-    std::vector<rocsparse_int> tmp_col(nnz);
-    std::vector<T>             tmp_val(nnz);
+    // Balance the digit width over the number of passes that are required
+    const int npasses = (bits + host_radix_max_digit_bits - 1) / host_radix_max_digit_bits;
+    const int width   = (bits + npasses - 1) / npasses;
+
+    int64_t nchunks = 1;
+#ifdef _OPENMP
+    nchunks = omp_get_max_threads();
+#endif
+    nchunks = std::max<int64_t>(1, std::min<int64_t>(nchunks, n >> width));
+
+    std::vector<K> keys(n);
+    std::vector<K> keys_tmp(n);
+    std::vector<I> perm_tmp(n);
+    std::vector<I> offset(nchunks << width);
 
-    tmp_row = coo_row_ind;
-    tmp_col = coo_col_ind;
-    tmp_val = coo_val;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I i = 0; i < n; ++i)
+    {
+        K key = static_cast<K>(low[perm[i]] - low_min);
 
-    // Sort
-    std::sort(perm.begin(), perm.end(), [&](const rocsparse_int& a, const rocsparse_int& b) {
-        if(tmp_col[a] < tmp_col[b])
+        if(high != nullptr && high_bits > 0)
         {
-            return true;
+            key |= static_cast<K>(high[perm[i]] - high_min) << low_bits;
         }
-        else if(tmp_col[a] == tmp_col[b])
+
+        keys[i] = key;
+    }
+
+    K* keys_in  = keys.data();
+    K* keys_out = keys_tmp.data();
+    I* perm_in  = perm;
+    I* perm_out = perm_tmp.data();
+
+    for(int shift = 0; shift < bits; shift += width)
+    {
+        if(host_radix_sort_pass(n,
+                                shift,
+                                std::min(width, bits - shift),
+                                nchunks,
+                                keys_in,
+                                perm_in,
+                                keys_out,
+                                perm_out,
+                                offset))
         {
-            return (tmp_row[a] < tmp_row[b]);
+            std::swap(keys_in, keys_out);
+            std::swap(perm_in, perm_out);
         }
-        else
+    }
+
+    if(perm_in != perm)
+    {
+        std::copy(perm_in, perm_in + n, perm);
+    }
+}
+
+template <typename I, typename J>
+void host_coosort_permutation(I               nnz,
+                              const J*        primary_ind,
+                              const J*        secondary_ind,
+                              std::vector<I>& perm)
+{
+    perm.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I i = 0; i < nnz; ++i)
+    {
+        perm[i] = i;
+    }
+
+    if(nnz == 0)
+    {
+        return;
+    }
+
+    // Determine the index ranges, such that only the significant bits are sorted
+    J primary_min   = primary_ind[0];
+    J primary_max   = primary_ind[0];
+    J secondary_min = secondary_ind[0];
+    J secondary_max = secondary_ind[0];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        J local_primary_min   = primary_ind[0];
+        J local_primary_max   = primary_ind[0];
+        J local_secondary_min = secondary_ind[0];
+        J local_secondary_max = secondary_ind[0];
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(I i = 0; i < nnz; ++i)
+        {
+            local_primary_min   = std::min(local_primary_min, primary_ind[i]);
+            local_primary_max   = std::max(local_primary_max, primary_ind[i]);
+            local_secondary_min = std::min(local_secondary_min, secondary_ind[i]);
+            local_secondary_max = std::max(local_secondary_max, secondary_ind[i]);
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            return false;
+            primary_min   = std::min(primary_min, local_primary_min);
+            primary_max   = std::max(primary_max, local_primary_max);
+            secondary_min = std::min(secondary_min, local_secondary_min);
+            secondary_max = std::max(secondary_max, local_secondary_max);
         }
-    });
+    }
+
+    int primary_bits
+        = host_radix_bits(static_cast<uint64_t>(primary_max) - static_cast<uint64_t>(primary_min));
+    int secondary_bits = host_radix_bits(static_cast<uint64_t>(secondary_max)
+                                         - static_cast<uint64_t>(secondary_min));
+
+    if(primary_bits + secondary_bits <= 32)
+    {
+        host_radix_sort_permutation<uint32_t>(nnz,
+                                              primary_ind,
+                                              primary_min,
+                                              primary_bits,
+                                              secondary_ind,
+                                              secondary_min,
+                                              secondary_bits,
+                                              perm.data());
+    }
+    else if(primary_bits + secondary_bits <= 64)
+    {
+        host_radix_sort_permutation<uint64_t>(nnz,
+                                              primary_ind,
+                                              primary_min,
+                                              primary_bits,
+                                              secondary_ind,
+                                              secondary_min,
+                                              secondary_bits,
+                                              perm.data());
+    }
+    else
+    {
+        // The keys do not fit into 64 bits, sort by the secondary and then (stable) by the
+        // primary index
+        host_radix_sort_permutation<uint64_t>(nnz,
+                                              static_cast<const J*>(nullptr),
+                                              J(0),
+                                              0,
+                                              secondary_ind,
+                                              secondary_min,
+                                              secondary_bits,
+                                              perm.data());
+        host_radix_sort_permutation<uint64_t>(nnz,
+                                              static_cast<const J*>(nullptr),
+                                              J(0),
+                                              0,
+                                              primary_ind,
+                                              primary_min,
+                                              primary_bits,
+                                              perm.data());
+    }
+}
+
+template <typename T>
+void host_coosort_by_column(rocsparse_int               M,
+                            rocsparse_int               nnz,
+                            std::vector<rocsparse_int>& coo_row_ind,
+                            std::vector<rocsparse_int>& coo_col_ind,
+                            std::vector<T>&             coo_val)
+{
+    // Sort by column and row index
+    std::vector<rocsparse_int> perm;
+    host_coosort_permutation(nnz, coo_col_ind.data(), coo_row_ind.data(), perm);
 
+    std::vector<rocsparse_int> tmp_row(coo_row_ind);
+    std::vector<rocsparse_int> tmp_col(coo_col_ind);
+    std::vector<T>             tmp_val(coo_val);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for(rocsparse_int i = 0; i < nnz; ++i)
     {
         coo_row_ind[i] = tmp_row[perm[i]];
@@ -8545,6 +10057,15 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                     rocsparse_index_base              base,                       \
                                     rocsparse_int*                    struct_pivot,               \
                                     rocsparse_int*                    numeric_pivot);                                \
+    template void             host_bsric0<TYPE>(const host_trm_info<rocsparse_int, rocsparse_int>& info, \
+                                    rocsparse_direction                                direction,  \
+                                    rocsparse_int                                      block_dim,  \
+                                    const std::vector<rocsparse_int>&                  bsr_row_ptr, \
+                                    const std::vector<rocsparse_int>&                  bsr_col_ind, \
+                                    std::vector<TYPE>&                                 bsr_val,    \
+                                    rocsparse_index_base                               base,       \
+                                    rocsparse_int*                                     struct_pivot, \
+                                    rocsparse_int*                                     numeric_pivot); \
     template void             host_bsrilu0<TYPE>(rocsparse_direction               dir,                       \
                                      rocsparse_int                     mb,                        \
                                      const std::vector<rocsparse_int>& bsr_row_ptr,               \
@@ -8557,6 +10078,18 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      bool                              boost,                     \
                                      floating_data_t<TYPE>             boost_tol,                 \
                                      TYPE                              boost_val);                                             \
+    template void             host_bsrilu0<TYPE>(const host_trm_info<rocsparse_int, rocsparse_int>& info, \
+                                     rocsparse_direction                                dir,       \
+                                     const std::vector<rocsparse_int>&                  bsr_row_ptr, \
+                                     const std::vector<rocsparse_int>&                  bsr_col_ind, \
+                                     std::vector<TYPE>&                                 bsr_val,   \
+                                     rocsparse_int                                      bsr_dim,   \
+                                     rocsparse_index_base                               base,      \
+                                     rocsparse_int*                                     struct_pivot, \
+                                     rocsparse_int*                                     numeric_pivot, \
+                                     bool                                               boost,     \
+                                     floating_data_t<TYPE>                              boost_tol, \
+                                     TYPE                                               boost_val); \
     template void             host_csric0<TYPE>(rocsparse_int                     M,                          \
                                     const std::vector<rocsparse_int>& csr_row_ptr,                \
                                     const std::vector<rocsparse_int>& csr_col_ind,                \
@@ -8566,6 +10099,15 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                     rocsparse_int*                    numeric_pivot,              \
                                     rocsparse_int*                    singular_pivot,             \
                                     double                            tol);                                                  \
+    template void             host_csric0<TYPE>(const host_trm_info<rocsparse_int, rocsparse_int>& info, \
+                                    const std::vector<rocsparse_int>&                  csr_row_ptr, \
+                                    const std::vector<rocsparse_int>&                  csr_col_ind, \
+                                    std::vector<TYPE>&                                 csr_val,    \
+                                    rocsparse_index_base                               base,       \
+                                    rocsparse_int*                                     struct_pivot, \
+                                    rocsparse_int*                                     numeric_pivot, \
+                                    rocsparse_int*                                     singular_pivot, \
+                                    double                                             tol);       \
     template void             host_csrilu0<TYPE>(rocsparse_int                     M,                         \
                                      const std::vector<rocsparse_int>& csr_row_ptr,               \
                                      const std::vector<rocsparse_int>& csr_col_ind,               \
@@ -8578,6 +10120,18 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      bool                              boost,                     \
                                      floating_data_t<TYPE>             boost_tol,                 \
                                      TYPE                              boost_val);                                             \
+    template void             host_csrilu0<TYPE>(const host_trm_info<rocsparse_int, rocsparse_int>& info, \
+                                     const std::vector<rocsparse_int>&                  csr_row_ptr, \
+                                     const std::vector<rocsparse_int>&                  csr_col_ind, \
+                                     std::vector<TYPE>&                                 csr_val,   \
+                                     rocsparse_index_base                               base,      \
+                                     rocsparse_int*                                     struct_pivot, \
+                                     rocsparse_int*                                     numeric_pivot, \
+                                     rocsparse_int*                                     singular_pivot, \
+                                     double                                             tol,       \
+                                     bool                                               boost,     \
+                                     floating_data_t<TYPE>                              boost_tol, \
+                                     TYPE                                               boost_val); \
     template void             host_gtsv_no_pivot<TYPE>(rocsparse_int            m,                            \
                                            rocsparse_int            n,                            \
                                            const std::vector<TYPE>& dl,                           \
@@ -8924,7 +10478,50 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                           TTYPE*               y,                        \
                                           const TTYPE*         c,                        \
                                           const TTYPE*         s,                        \
-                                          rocsparse_index_base base);
+                                          rocsparse_index_base base);                    \
+    template void host_csr_to_csc_values<ITYPE, TTYPE>(ITYPE        nnz,                 \
+                                                       const ITYPE* perm,                \
+                                                       const TTYPE* csr_val,             \
+                                                       TTYPE*       csc_val);
+
+#define INSTANTIATE_IJ(ITYPE, JTYPE)                                                        \
+    template void host_trm_analysis<ITYPE, JTYPE>(rocsparse_operation          trans,       \
+                                                  JTYPE                        M,           \
+                                                  ITYPE                        nnz,         \
+                                                  const ITYPE*                 csr_row_ptr, \
+                                                  const JTYPE*                 csr_col_ind, \
+                                                  rocsparse_fill_mode          fill_mode,   \
+                                                  rocsparse_index_base         base,        \
+                                                  host_trm_info<ITYPE, JTYPE>& info);       \
+    template void host_csr_to_csc_pattern<ITYPE, JTYPE>(JTYPE                M,             \
+                                                        JTYPE                N,             \
+                                                        ITYPE                nnz,           \
+                                                        const ITYPE*         csr_row_ptr,   \
+                                                        const JTYPE*         csr_col_ind,   \
+                                                        std::vector<JTYPE>&  csc_row_ind,   \
+                                                        std::vector<ITYPE>&  csc_col_ptr,   \
+                                                        std::vector<ITYPE>&  perm,          \
+                                                        rocsparse_index_base base);         \
+    template void host_coosort_permutation<ITYPE, JTYPE>(ITYPE               nnz,           \
+                                                         const JTYPE*        primary_ind,   \
+                                                         const JTYPE*        secondary_ind, \
+                                                         std::vector<ITYPE>& perm);         \
+    template void host_coo_to_csr<ITYPE, JTYPE>(JTYPE                M,                     \
+                                                ITYPE                nnz,                   \
+                                                const JTYPE*         coo_row_ind,           \
+                                                ITYPE*               csr_row_ptr,           \
+                                                rocsparse_index_base base);                 \
+    template void host_csr_to_coo<ITYPE, JTYPE>(JTYPE                     M,                \
+                                                ITYPE                     nnz,              \
+                                                const std::vector<ITYPE>& csr_row_ptr,      \
+                                                std::vector<JTYPE>&       coo_row_ind,      \
+                                                rocsparse_index_base      base);            \
+    template void host_csr_to_coo_aos<ITYPE, JTYPE>(JTYPE                     M,            \
+                                                    ITYPE                     nnz,          \
+                                                    const std::vector<ITYPE>& csr_row_ptr,  \
+                                                    const std::vector<JTYPE>& csr_col_ind,  \
+                                                    std::vector<ITYPE>&       coo_ind,      \
+                                                    rocsparse_index_base      base);
 
 #define INSTANTIATE_IJT(ITYPE, JTYPE, TTYPE)                                                     \
     template void host_csr_to_csc<ITYPE, JTYPE, TTYPE>(JTYPE                M,                   \
@@ -8953,6 +10550,18 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   rocsparse_index_base base,                     \
                                                   JTYPE*               struct_pivot,             \
                                                   JTYPE*               numeric_pivot);                         \
+    template void host_csrsv<ITYPE, JTYPE, TTYPE>(const host_trm_info<ITYPE, JTYPE>& info,       \
+                                                  TTYPE                              alpha,      \
+                                                  const ITYPE*                       csr_row_ptr,\
+                                                  const JTYPE*                       csr_col_ind,\
+                                                  const TTYPE*                       csr_val,    \
+                                                  const TTYPE*                       x,          \
+                                                  int64_t                            x_inc,      \
+                                                  TTYPE*                             y,          \
+                                                  rocsparse_diag_type                diag_type,  \
+                                                  rocsparse_index_base               base,       \
+                                                  JTYPE*                             struct_pivot,\
+                                                  JTYPE*                             numeric_pivot); \
     template void host_csrmm<TTYPE, ITYPE, JTYPE>(JTYPE                M,                        \
                                                   JTYPE                N,                        \
                                                   JTYPE                K,                        \
@@ -9054,6 +10663,20 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   rocsparse_index_base base,                     \
                                                   JTYPE*               struct_pivot,             \
                                                   JTYPE*               numeric_pivot);                         \
+    template void host_csrsm<ITYPE, JTYPE, TTYPE>(const host_trm_info<ITYPE, JTYPE>& info,       \
+                                                  JTYPE                              nrhs,       \
+                                                  rocsparse_operation                transB,     \
+                                                  TTYPE                              alpha,      \
+                                                  const ITYPE*                       csr_row_ptr,\
+                                                  const JTYPE*                       csr_col_ind,\
+                                                  const TTYPE*                       csr_val,    \
+                                                  TTYPE*                             B,          \
+                                                  int64_t                            ldb,        \
+                                                  rocsparse_order                    order_B,    \
+                                                  rocsparse_diag_type                diag_type,  \
+                                                  rocsparse_index_base               base,       \
+                                                  JTYPE*                             struct_pivot,\
+                                                  JTYPE*                             numeric_pivot); \
     template void host_bsrgemm_nnzb<TTYPE, ITYPE, JTYPE>(JTYPE                Mb,                \
                                                          JTYPE                Nb,                \
                                                          JTYPE                Kb,                \
@@ -9293,6 +10916,10 @@ INSTANTIATE_IT(int64_t, double);
 INSTANTIATE_IT(int64_t, rocsparse_float_complex);
 INSTANTIATE_IT(int64_t, rocsparse_double_complex);
 
+INSTANTIATE_IJ(int32_t, int32_t);
+INSTANTIATE_IJ(int64_t, int32_t);
+INSTANTIATE_IJ(int64_t, int64_t);
+
 INSTANTIATE_IJT(int32_t, int32_t, float);
 INSTANTIATE_IJT(int32_t, int32_t, double);
 INSTANTIATE_IJT(int32_t, int32_t, rocsparse_float_complex);
@@ -0,0 +1,1489 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_host_generic.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+struct _rocsparse_host_spmat_descr
+{
+    rocsparse_format format{};
+
+    int64_t rows{};
+    int64_t cols{};
+    int64_t nnz{};
+
+    // Same layout as the device descriptor, i.e. row_data holds the row offsets of a CSR matrix
+    // and the row indices of a COO or CSC matrix, col_data the respective column arrays
+    void* row_data{};
+    void* col_data{};
+    void* val_data{};
+
+    rocsparse_indextype  row_type{};
+    rocsparse_indextype  col_type{};
+    rocsparse_index_base base{};
+    rocsparse_datatype   data_type{};
+
+    rocsparse_fill_mode    fill_mode{rocsparse_fill_mode_lower};
+    rocsparse_diag_type    diag_type{rocsparse_diag_type_non_unit};
+    rocsparse_matrix_type  matrix_type{rocsparse_matrix_type_general};
+    rocsparse_storage_mode storage_mode{rocsparse_storage_mode_sorted};
+
+    // Triangular analysis of the SpSV preprocess stage, holds a host_trm_info<I, J>
+    std::shared_ptr<void> trm_info;
+};
+
+struct _rocsparse_host_dnvec_descr
+{
+    int64_t            size{};
+    void*              values{};
+    rocsparse_datatype data_type{};
+};
+
+struct _rocsparse_host_dnmat_descr
+{
+    int64_t            rows{};
+    int64_t            cols{};
+    int64_t            ld{};
+    void*              values{};
+    rocsparse_datatype data_type{};
+    rocsparse_order    order{};
+};
+
+// The host kernels do not require temporary storage, the buffer size stages report 0 bytes.
+static constexpr size_t host_generic_buffer_size = 0;
+
+// The dense conversions tell the buffer size query apart from the computation by a nullptr
+// temp_buffer, as their device counterparts. They report a single byte, such that the buffer
+// allocated by the application is not nullptr; this byte is never accessed.
+static constexpr size_t host_generic_conversion_buffer_size = 1;
+
+// Offset (I) and index (J) types of a sparse matrix, COO matrices use a single index type
+static rocsparse_indextype host_offset_type(const _rocsparse_host_spmat_descr* descr)
+{
+    return (descr->format == rocsparse_format_csc) ? descr->col_type : descr->row_type;
+}
+
+static rocsparse_indextype host_index_type(const _rocsparse_host_spmat_descr* descr)
+{
+    return (descr->format == rocsparse_format_csc) ? descr->row_type : descr->col_type;
+}
+
+// Calls f(I{}, J{}) with the (offset, index) type combinations the reference engine supports
+template <typename F>
+static rocsparse_status
+    host_dispatch_index(rocsparse_indextype itype, rocsparse_indextype jtype, F&& f)
+{
+    if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)
+    {
+        return f(int32_t{}, int32_t{});
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32)
+    {
+        return f(int64_t{}, int32_t{});
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64)
+    {
+        return f(int64_t{}, int64_t{});
+    }
+
+    return rocsparse_status_not_implemented;
+}
+
+// Calls f(T{}) with the data type
+template <typename F>
+static rocsparse_status host_dispatch_data(rocsparse_datatype type, F&& f)
+{
+    switch(type)
+    {
+    case rocsparse_datatype_f32_r:
+        return f(float{});
+    case rocsparse_datatype_f64_r:
+        return f(double{});
+    case rocsparse_datatype_f32_c:
+        return f(rocsparse_float_complex{});
+    case rocsparse_datatype_f64_c:
+        return f(rocsparse_double_complex{});
+    default:
+        return rocsparse_status_not_implemented;
+    }
+}
+
+static rocsparse_status host_create_spmat_descr(rocsparse_host_spmat_descr* descr,
+                                                rocsparse_format            format,
+                                                int64_t                     rows,
+                                                int64_t                     cols,
+                                                int64_t                     nnz,
+                                                void*                       row_data,
+                                                void*                       col_data,
+                                                void*                       val_data,
+                                                rocsparse_indextype         row_type,
+                                                rocsparse_indextype         col_type,
+                                                rocsparse_index_base        idx_base,
+                                                rocsparse_datatype          data_type)
+{
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // nnz > rows * cols, without forming the product that overflows for large dimensions
+    if(rows < 0 || cols < 0 || nnz < 0 || (nnz > 0 && (cols == 0 || (nnz - 1) / cols >= rows)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    *descr = new _rocsparse_host_spmat_descr;
+
+    (*descr)->format    = format;
+    (*descr)->rows      = rows;
+    (*descr)->cols      = cols;
+    (*descr)->nnz       = nnz;
+    (*descr)->row_data  = row_data;
+    (*descr)->col_data  = col_data;
+    (*descr)->val_data  = val_data;
+    (*descr)->row_type  = row_type;
+    (*descr)->col_type  = col_type;
+    (*descr)->base      = idx_base;
+    (*descr)->data_type = data_type;
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    descriptors
+ * ===========================================================================
+ */
+rocsparse_status rocsparse_host_create_coo_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       coo_row_ind,
+                                                 void*                       coo_col_ind,
+                                                 void*                       coo_val,
+                                                 rocsparse_indextype         idx_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type)
+{
+    return host_create_spmat_descr(descr,
+                                   rocsparse_format_coo,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   coo_row_ind,
+                                   coo_col_ind,
+                                   coo_val,
+                                   idx_type,
+                                   idx_type,
+                                   idx_base,
+                                   data_type);
+}
+
+rocsparse_status rocsparse_host_create_csr_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       csr_row_ptr,
+                                                 void*                       csr_col_ind,
+                                                 void*                       csr_val,
+                                                 rocsparse_indextype         row_ptr_type,
+                                                 rocsparse_indextype         col_ind_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type)
+{
+    return host_create_spmat_descr(descr,
+                                   rocsparse_format_csr,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   row_ptr_type,
+                                   col_ind_type,
+                                   idx_base,
+                                   data_type);
+}
+
+rocsparse_status rocsparse_host_create_csc_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       csc_col_ptr,
+                                                 void*                       csc_row_ind,
+                                                 void*                       csc_val,
+                                                 rocsparse_indextype         col_ptr_type,
+                                                 rocsparse_indextype         row_ind_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type)
+{
+    return host_create_spmat_descr(descr,
+                                   rocsparse_format_csc,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   csc_row_ind,
+                                   csc_col_ptr,
+                                   csc_val,
+                                   row_ind_type,
+                                   col_ptr_type,
+                                   idx_base,
+                                   data_type);
+}
+
+rocsparse_status rocsparse_host_destroy_spmat_descr(rocsparse_host_spmat_descr descr)
+{
+    delete descr;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_host_spmat_get_size(rocsparse_host_spmat_descr descr,
+                                               int64_t*                   rows,
+                                               int64_t*                   cols,
+                                               int64_t*                   nnz)
+{
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *rows = descr->rows;
+    *cols = descr->cols;
+    *nnz  = descr->nnz;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status host_spmat_set_pointers(rocsparse_host_spmat_descr descr,
+                                                rocsparse_format           format,
+                                                void*                      row_data,
+                                                void*                      col_data,
+                                                void*                      val_data)
+{
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(descr->format != format)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->row_data = row_data;
+    descr->col_data = col_data;
+    descr->val_data = val_data;
+
+    // The triangular analysis depends on the sparsity pattern
+    descr->trm_info.reset();
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_host_coo_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      coo_row_ind,
+                                                 void*                      coo_col_ind,
+                                                 void*                      coo_val)
+{
+    return host_spmat_set_pointers(descr, rocsparse_format_coo, coo_row_ind, coo_col_ind, coo_val);
+}
+
+rocsparse_status rocsparse_host_csr_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      csr_row_ptr,
+                                                 void*                      csr_col_ind,
+                                                 void*                      csr_val)
+{
+    return host_spmat_set_pointers(descr, rocsparse_format_csr, csr_row_ptr, csr_col_ind, csr_val);
+}
+
+rocsparse_status rocsparse_host_csc_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      csc_col_ptr,
+                                                 void*                      csc_row_ind,
+                                                 void*                      csc_val)
+{
+    return host_spmat_set_pointers(descr, rocsparse_format_csc, csc_row_ind, csc_col_ptr, csc_val);
+}
+
+rocsparse_status rocsparse_host_spmat_set_attribute(rocsparse_host_spmat_descr descr,
+                                                    rocsparse_spmat_attribute  attribute,
+                                                    const void*                data,
+                                                    size_t                     data_size)
+{
+    if(descr == nullptr || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    switch(attribute)
+    {
+    case rocsparse_spmat_fill_mode:
+    {
+        if(data_size != sizeof(rocsparse_fill_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        descr->fill_mode = *static_cast<const rocsparse_fill_mode*>(data);
+
+        // The triangular analysis depends on the fill mode
+        descr->trm_info.reset();
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_diag_type:
+    {
+        if(data_size != sizeof(rocsparse_diag_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        descr->diag_type = *static_cast<const rocsparse_diag_type*>(data);
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_matrix_type:
+    {
+        if(data_size != sizeof(rocsparse_matrix_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        descr->matrix_type = *static_cast<const rocsparse_matrix_type*>(data);
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_storage_mode:
+    {
+        if(data_size != sizeof(rocsparse_storage_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        descr->storage_mode = *static_cast<const rocsparse_storage_mode*>(data);
+        return rocsparse_status_success;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+rocsparse_status rocsparse_host_create_dnvec_descr(rocsparse_host_dnvec_descr* descr,
+                                                   int64_t                     size,
+                                                   void*                       values,
+                                                   rocsparse_datatype          data_type)
+{
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(size < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    *descr = new _rocsparse_host_dnvec_descr;
+
+    (*descr)->size      = size;
+    (*descr)->values    = values;
+    (*descr)->data_type = data_type;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_host_destroy_dnvec_descr(rocsparse_host_dnvec_descr descr)
+{
+    delete descr;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_host_create_dnmat_descr(rocsparse_host_dnmat_descr* descr,
+                                                   int64_t                     rows,
+                                                   int64_t                     cols,
+                                                   int64_t                     ld,
+                                                   void*                       values,
+                                                   rocsparse_datatype          data_type,
+                                                   rocsparse_order             order)
+{
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rows < 0 || cols < 0 || ld < ((order == rocsparse_order_column) ? rows : cols))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    *descr = new _rocsparse_host_dnmat_descr;
+
+    (*descr)->rows      = rows;
+    (*descr)->cols      = cols;
+    (*descr)->ld        = ld;
+    (*descr)->values    = values;
+    (*descr)->data_type = data_type;
+    (*descr)->order     = order;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_host_destroy_dnmat_descr(rocsparse_host_dnmat_descr descr)
+{
+    delete descr;
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    generic SPARSE
+ * ===========================================================================
+ */
+rocsparse_status rocsparse_host_spmv(rocsparse_operation        trans,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat,
+                                     rocsparse_host_dnvec_descr x,
+                                     const void*                beta,
+                                     rocsparse_host_dnvec_descr y,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spmv_alg         alg,
+                                     rocsparse_spmv_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer)
+{
+    if(mat == nullptr || x == nullptr || y == nullptr || alpha == nullptr || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat->data_type != compute_type || x->data_type != compute_type
+       || y->data_type != compute_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    bool    none   = (trans == rocsparse_operation_none);
+    int64_t x_size = none ? mat->cols : mat->rows;
+    int64_t y_size = none ? mat->rows : mat->cols;
+
+    if(x->size != x_size || y->size != y_size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    switch(stage)
+    {
+    case rocsparse_spmv_stage_buffer_size:
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_buffer_size;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmv_stage_preprocess:
+    {
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmv_stage_compute:
+    {
+        break;
+    }
+    default:
+    {
+        return rocsparse_status_invalid_value;
+    }
+    }
+
+    return host_dispatch_index(
+        host_offset_type(mat), host_index_type(mat), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            return host_dispatch_data(compute_type, [&](auto t) {
+                using T = decltype(t);
+
+                const T  h_alpha = *static_cast<const T*>(alpha);
+                const T  h_beta  = *static_cast<const T*>(beta);
+                const T* val     = static_cast<const T*>(mat->val_data);
+                const T* x_val   = static_cast<const T*>(x->values);
+                T*       y_val   = static_cast<T*>(y->values);
+
+                switch(mat->format)
+                {
+                case rocsparse_format_coo:
+                {
+                    host_coomv<T, I, T, T, T>(trans,
+                                              static_cast<I>(mat->rows),
+                                              static_cast<I>(mat->cols),
+                                              mat->nnz,
+                                              h_alpha,
+                                              static_cast<const I*>(mat->row_data),
+                                              static_cast<const I*>(mat->col_data),
+                                              val,
+                                              x_val,
+                                              h_beta,
+                                              y_val,
+                                              mat->base);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_csr:
+                {
+                    host_csrmv<T, I, J, T, T, T>(trans,
+                                                 static_cast<J>(mat->rows),
+                                                 static_cast<J>(mat->cols),
+                                                 static_cast<I>(mat->nnz),
+                                                 h_alpha,
+                                                 static_cast<const I*>(mat->row_data),
+                                                 static_cast<const J*>(mat->col_data),
+                                                 val,
+                                                 x_val,
+                                                 h_beta,
+                                                 y_val,
+                                                 mat->base,
+                                                 mat->matrix_type,
+                                                 alg,
+                                                 false);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_csc:
+                {
+                    host_cscmv<T, I, J, T, T, T>(trans,
+                                                 static_cast<J>(mat->rows),
+                                                 static_cast<J>(mat->cols),
+                                                 static_cast<I>(mat->nnz),
+                                                 h_alpha,
+                                                 static_cast<const I*>(mat->col_data),
+                                                 static_cast<const J*>(mat->row_data),
+                                                 val,
+                                                 x_val,
+                                                 h_beta,
+                                                 y_val,
+                                                 mat->base,
+                                                 mat->matrix_type,
+                                                 alg);
+                    return rocsparse_status_success;
+                }
+                default:
+                {
+                    return rocsparse_status_not_implemented;
+                }
+                }
+            });
+        });
+}
+
+rocsparse_status rocsparse_host_spmm(rocsparse_operation        trans_A,
+                                     rocsparse_operation        trans_B,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat_A,
+                                     rocsparse_host_dnmat_descr mat_B,
+                                     const void*                beta,
+                                     rocsparse_host_dnmat_descr mat_C,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spmm_alg         alg,
+                                     rocsparse_spmm_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer)
+{
+    if(mat_A == nullptr || mat_B == nullptr || mat_C == nullptr || alpha == nullptr
+       || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat_A->data_type != compute_type || mat_B->data_type != compute_type
+       || mat_C->data_type != compute_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    bool    none_A = (trans_A == rocsparse_operation_none);
+    bool    none_B = (trans_B == rocsparse_operation_none);
+    int64_t M      = none_A ? mat_A->rows : mat_A->cols;
+    int64_t K      = none_A ? mat_A->cols : mat_A->rows;
+    int64_t N      = mat_C->cols;
+
+    if(mat_C->rows != M || (none_B ? mat_B->rows : mat_B->cols) != K
+       || (none_B ? mat_B->cols : mat_B->rows) != N)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    switch(stage)
+    {
+    case rocsparse_spmm_stage_buffer_size:
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_buffer_size;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmm_stage_preprocess:
+    {
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmm_stage_compute:
+    {
+        break;
+    }
+    default:
+    {
+        return rocsparse_status_invalid_value;
+    }
+    }
+
+    return host_dispatch_index(
+        host_offset_type(mat_A), host_index_type(mat_A), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            return host_dispatch_data(compute_type, [&](auto t) {
+                using T = decltype(t);
+
+                const T  h_alpha = *static_cast<const T*>(alpha);
+                const T  h_beta  = *static_cast<const T*>(beta);
+                const T* val     = static_cast<const T*>(mat_A->val_data);
+                const T* B       = static_cast<const T*>(mat_B->values);
+                T*       C       = static_cast<T*>(mat_C->values);
+
+                switch(mat_A->format)
+                {
+                case rocsparse_format_coo:
+                {
+                    host_coomm<T, I>(static_cast<I>(mat_A->rows),
+                                     static_cast<I>(N),
+                                     static_cast<I>(mat_A->cols),
+                                     mat_A->nnz,
+                                     trans_A,
+                                     trans_B,
+                                     h_alpha,
+                                     static_cast<const I*>(mat_A->row_data),
+                                     static_cast<const I*>(mat_A->col_data),
+                                     val,
+                                     B,
+                                     mat_B->ld,
+                                     mat_B->order,
+                                     h_beta,
+                                     C,
+                                     mat_C->ld,
+                                     mat_C->order,
+                                     mat_A->base);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_csr:
+                {
+                    host_csrmm<T, I, J>(static_cast<J>(mat_A->rows),
+                                        static_cast<J>(N),
+                                        static_cast<J>(mat_A->cols),
+                                        trans_A,
+                                        trans_B,
+                                        h_alpha,
+                                        static_cast<const I*>(mat_A->row_data),
+                                        static_cast<const J*>(mat_A->col_data),
+                                        val,
+                                        B,
+                                        mat_B->ld,
+                                        mat_B->order,
+                                        h_beta,
+                                        C,
+                                        mat_C->ld,
+                                        mat_C->order,
+                                        mat_A->base,
+                                        false);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_csc:
+                {
+                    host_cscmm<T, I, J>(static_cast<J>(mat_A->rows),
+                                        static_cast<J>(N),
+                                        static_cast<J>(mat_A->cols),
+                                        trans_A,
+                                        trans_B,
+                                        h_alpha,
+                                        static_cast<const I*>(mat_A->col_data),
+                                        static_cast<const J*>(mat_A->row_data),
+                                        val,
+                                        B,
+                                        mat_B->ld,
+                                        mat_B->order,
+                                        h_beta,
+                                        C,
+                                        mat_C->ld,
+                                        mat_C->order,
+                                        mat_A->base);
+                    return rocsparse_status_success;
+                }
+                default:
+                {
+                    return rocsparse_status_not_implemented;
+                }
+                }
+            });
+        });
+}
+
+rocsparse_status rocsparse_host_spsv(rocsparse_operation        trans,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat,
+                                     rocsparse_host_dnvec_descr x,
+                                     rocsparse_host_dnvec_descr y,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spsv_alg         alg,
+                                     rocsparse_spsv_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer)
+{
+    if(mat == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat->data_type != compute_type || x->data_type != compute_type
+       || y->data_type != compute_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mat->rows != mat->cols || x->size != mat->rows || y->size != mat->rows)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(mat->format != rocsparse_format_coo && mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(stage == rocsparse_spsv_stage_buffer_size)
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_buffer_size;
+        return rocsparse_status_success;
+    }
+
+    if(stage != rocsparse_spsv_stage_preprocess && stage != rocsparse_spsv_stage_compute)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(stage == rocsparse_spsv_stage_compute && alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return host_dispatch_index(
+        host_offset_type(mat), host_index_type(mat), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            if(mat->format == rocsparse_format_csr)
+            {
+                // The analysis is kept for all subsequent solves with the same operation. It is
+                // always redone by the preprocess stage, and performed here if the preprocess
+                // stage has been skipped.
+                auto info = std::static_pointer_cast<host_trm_info<I, J>>(mat->trm_info);
+
+                if(stage == rocsparse_spsv_stage_preprocess || info == nullptr
+                   || info->trans != trans)
+                {
+                    info = std::make_shared<host_trm_info<I, J>>();
+
+                    host_trm_analysis<I, J>(trans,
+                                            static_cast<J>(mat->rows),
+                                            static_cast<I>(mat->nnz),
+                                            static_cast<const I*>(mat->row_data),
+                                            static_cast<const J*>(mat->col_data),
+                                            mat->fill_mode,
+                                            mat->base,
+                                            *info);
+
+                    mat->trm_info = info;
+                }
+
+                if(stage == rocsparse_spsv_stage_preprocess)
+                {
+                    return rocsparse_status_success;
+                }
+
+                return host_dispatch_data(compute_type, [&](auto t) {
+                    using T = decltype(t);
+
+                    J struct_pivot;
+                    J numeric_pivot;
+
+                    host_csrsv<I, J, T>(*info,
+                                        *static_cast<const T*>(alpha),
+                                        static_cast<const I*>(mat->row_data),
+                                        static_cast<const J*>(mat->col_data),
+                                        static_cast<const T*>(mat->val_data),
+                                        static_cast<const T*>(x->values),
+                                        1,
+                                        static_cast<T*>(y->values),
+                                        mat->diag_type,
+                                        mat->base,
+                                        &struct_pivot,
+                                        &numeric_pivot);
+
+                    return rocsparse_status_success;
+                });
+            }
+
+            if(stage == rocsparse_spsv_stage_preprocess)
+            {
+                return rocsparse_status_success;
+            }
+
+            return host_dispatch_data(compute_type, [&](auto t) {
+                using T = decltype(t);
+
+                I struct_pivot;
+                I numeric_pivot;
+
+                host_coosv<I, T>(trans,
+                                 static_cast<I>(mat->rows),
+                                 mat->nnz,
+                                 *static_cast<const T*>(alpha),
+                                 static_cast<const I*>(mat->row_data),
+                                 static_cast<const I*>(mat->col_data),
+                                 static_cast<const T*>(mat->val_data),
+                                 static_cast<const T*>(x->values),
+                                 static_cast<T*>(y->values),
+                                 mat->diag_type,
+                                 mat->fill_mode,
+                                 mat->base,
+                                 &struct_pivot,
+                                 &numeric_pivot);
+
+                return rocsparse_status_success;
+            });
+        });
+}
+
+rocsparse_status rocsparse_host_spgemm(rocsparse_operation        trans_A,
+                                       rocsparse_operation        trans_B,
+                                       const void*                alpha,
+                                       rocsparse_host_spmat_descr A,
+                                       rocsparse_host_spmat_descr B,
+                                       const void*                beta,
+                                       rocsparse_host_spmat_descr D,
+                                       rocsparse_host_spmat_descr C,
+                                       rocsparse_datatype         compute_type,
+                                       rocsparse_spgemm_alg       alg,
+                                       rocsparse_spgemm_stage     stage,
+                                       size_t*                    buffer_size,
+                                       void*                      temp_buffer)
+{
+    if(A == nullptr || B == nullptr || C == nullptr || (beta != nullptr && D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // D only contributes with a valid beta
+    if(beta == nullptr)
+    {
+        D = nullptr;
+    }
+
+    for(rocsparse_host_spmat_descr mat : {A, B, D, C})
+    {
+        if(mat != nullptr
+           && (mat->format != rocsparse_format_csr || mat->data_type != compute_type
+               || mat->row_type != C->row_type || mat->col_type != C->col_type))
+        {
+            return rocsparse_status_not_implemented;
+        }
+    }
+
+    if(A->cols != B->rows || C->rows != A->rows || C->cols != B->cols
+       || (D != nullptr && (D->rows != C->rows || D->cols != C->cols)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(stage == rocsparse_spgemm_stage_buffer_size)
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_buffer_size;
+        return rocsparse_status_success;
+    }
+
+    if(stage != rocsparse_spgemm_stage_nnz && stage != rocsparse_spgemm_stage_compute
+       && stage != rocsparse_spgemm_stage_symbolic && stage != rocsparse_spgemm_stage_numeric)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    return host_dispatch_index(C->row_type, C->col_type, [&](auto i, auto j) {
+        using I = decltype(i);
+        using J = decltype(j);
+
+        return host_dispatch_data(compute_type, [&](auto t) {
+            using T = decltype(t);
+
+            const J M = static_cast<J>(A->rows);
+            const J N = static_cast<J>(B->cols);
+            const J K = static_cast<J>(A->cols);
+
+            const I* D_ptr = (D != nullptr) ? static_cast<const I*>(D->row_data) : nullptr;
+            const J* D_ind = (D != nullptr) ? static_cast<const J*>(D->col_data) : nullptr;
+            const T* D_val = (D != nullptr) ? static_cast<const T*>(D->val_data) : nullptr;
+
+            const rocsparse_index_base D_base
+                = (D != nullptr) ? D->base : rocsparse_index_base_zero;
+
+            if(stage == rocsparse_spgemm_stage_nnz)
+            {
+                I nnz_C;
+
+                host_csrgemm_nnz<T, I, J>(M,
+                                          N,
+                                          K,
+                                          static_cast<const T*>(alpha),
+                                          static_cast<const I*>(A->row_data),
+                                          static_cast<const J*>(A->col_data),
+                                          static_cast<const I*>(B->row_data),
+                                          static_cast<const J*>(B->col_data),
+                                          static_cast<const T*>(beta),
+                                          D_ptr,
+                                          D_ind,
+                                          static_cast<I*>(C->row_data),
+                                          &nnz_C,
+                                          A->base,
+                                          B->base,
+                                          C->base,
+                                          D_base);
+
+                C->nnz = nnz_C;
+                return rocsparse_status_success;
+            }
+
+            // The symbolic stage only requires the column indices, values are computed into a
+            // scratch array
+            std::vector<T> scratch;
+            T*             C_val = static_cast<T*>(C->val_data);
+
+            if(stage == rocsparse_spgemm_stage_symbolic)
+            {
+                scratch.resize(C->nnz);
+                C_val = scratch.data();
+            }
+
+            host_csrgemm<T, I, J>(M,
+                                  N,
+                                  K,
+                                  static_cast<const T*>(alpha),
+                                  static_cast<const I*>(A->row_data),
+                                  static_cast<const J*>(A->col_data),
+                                  static_cast<const T*>(A->val_data),
+                                  static_cast<const I*>(B->row_data),
+                                  static_cast<const J*>(B->col_data),
+                                  static_cast<const T*>(B->val_data),
+                                  static_cast<const T*>(beta),
+                                  D_ptr,
+                                  D_ind,
+                                  D_val,
+                                  static_cast<const I*>(C->row_data),
+                                  static_cast<J*>(C->col_data),
+                                  C_val,
+                                  A->base,
+                                  B->base,
+                                  C->base,
+                                  D_base);
+
+            return rocsparse_status_success;
+        });
+    });
+}
+
+rocsparse_status rocsparse_host_sparse_to_dense(rocsparse_host_spmat_descr    mat_A,
+                                                rocsparse_host_dnmat_descr    mat_B,
+                                                rocsparse_sparse_to_dense_alg alg,
+                                                size_t*                       buffer_size,
+                                                void*                         temp_buffer)
+{
+    if(mat_A == nullptr || mat_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat_A->data_type != mat_B->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mat_A->rows != mat_B->rows || mat_A->cols != mat_B->cols)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(temp_buffer == nullptr)
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_conversion_buffer_size;
+        return rocsparse_status_success;
+    }
+
+    return host_dispatch_index(
+        host_offset_type(mat_A), host_index_type(mat_A), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            return host_dispatch_data(mat_A->data_type, [&](auto t) {
+                using T = decltype(t);
+
+                const J  m     = static_cast<J>(mat_A->rows);
+                const J  n     = static_cast<J>(mat_A->cols);
+                const T* val   = static_cast<const T*>(mat_A->val_data);
+                T*       dense = static_cast<T*>(mat_B->values);
+
+                switch(mat_A->format)
+                {
+                case rocsparse_format_csr:
+                {
+                    host_csx2dense<rocsparse_direction_row, T, I, J>(
+                        m,
+                        n,
+                        mat_A->base,
+                        mat_B->order,
+                        val,
+                        static_cast<const I*>(mat_A->row_data),
+                        static_cast<const J*>(mat_A->col_data),
+                        dense,
+                        mat_B->ld);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_csc:
+                {
+                    host_csx2dense<rocsparse_direction_column, T, I, J>(
+                        m,
+                        n,
+                        mat_A->base,
+                        mat_B->order,
+                        val,
+                        static_cast<const I*>(mat_A->col_data),
+                        static_cast<const J*>(mat_A->row_data),
+                        dense,
+                        mat_B->ld);
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_coo:
+                {
+                    const I*      row_ind = static_cast<const I*>(mat_A->row_data);
+                    const I*      col_ind = static_cast<const I*>(mat_A->col_data);
+                    const int64_t ld      = mat_B->ld;
+                    const bool    column  = (mat_B->order == rocsparse_order_column);
+                    const int64_t len     = column ? n : m;
+                    const int64_t width   = column ? m : n;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                    for(int64_t k = 0; k < len; ++k)
+                    {
+                        for(int64_t l = 0; l < width; ++l)
+                        {
+                            dense[ld * k + l] = static_cast<T>(0);
+                        }
+                    }
+
+                    for(int64_t k = 0; k < mat_A->nnz; ++k)
+                    {
+                        int64_t row = row_ind[k] - mat_A->base;
+                        int64_t col = col_ind[k] - mat_A->base;
+
+                        dense[column ? (ld * col + row) : (ld * row + col)] = val[k];
+                    }
+
+                    return rocsparse_status_success;
+                }
+                default:
+                {
+                    return rocsparse_status_not_implemented;
+                }
+                }
+            });
+        });
+}
+
+rocsparse_status rocsparse_host_dense_to_sparse(rocsparse_host_dnmat_descr    mat_A,
+                                                rocsparse_host_spmat_descr    mat_B,
+                                                rocsparse_dense_to_sparse_alg alg,
+                                                size_t*                       buffer_size,
+                                                void*                         temp_buffer)
+{
+    if(mat_A == nullptr || mat_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat_A->data_type != mat_B->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mat_A->rows != mat_B->rows || mat_A->cols != mat_B->cols)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(temp_buffer == nullptr)
+    {
+        if(buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        *buffer_size = host_generic_conversion_buffer_size;
+        return rocsparse_status_success;
+    }
+
+    // With a valid buffer size, only the sparsity pattern is analysed
+    const bool analysis = (buffer_size != nullptr);
+
+    return host_dispatch_index(
+        host_offset_type(mat_B), host_index_type(mat_B), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            return host_dispatch_data(mat_B->data_type, [&](auto t) {
+                using T = decltype(t);
+
+                static constexpr T s_zero = {};
+
+                const J       m      = static_cast<J>(mat_A->rows);
+                const J       n      = static_cast<J>(mat_A->cols);
+                const T*      dense  = static_cast<const T*>(mat_A->values);
+                const int64_t ld     = mat_A->ld;
+                const bool    column = (mat_A->order == rocsparse_order_column);
+
+                // COO matrices are filled row by row as CSR matrices
+                const bool by_row = (mat_B->format != rocsparse_format_csc);
+                const J    len    = by_row ? m : n;
+                const J    width  = by_row ? n : m;
+
+                std::vector<I> nnz_per(len);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+                for(J k = 0; k < len; ++k)
+                {
+                    I count = 0;
+                    for(J l = 0; l < width; ++l)
+                    {
+                        int64_t row = by_row ? k : l;
+                        int64_t col = by_row ? l : k;
+
+                        count += (dense[column ? (ld * col + row) : (ld * row + col)] != s_zero);
+                    }
+
+                    nnz_per[k] = count;
+                }
+
+                switch(mat_B->format)
+                {
+                case rocsparse_format_csr:
+                case rocsparse_format_csc:
+                {
+                    const bool csr = (mat_B->format == rocsparse_format_csr);
+                    I*         ptr = static_cast<I*>(csr ? mat_B->row_data : mat_B->col_data);
+
+                    if(analysis)
+                    {
+                        ptr[0] = mat_B->base;
+                        for(J k = 0; k < len; ++k)
+                        {
+                            ptr[k + 1] = ptr[k] + nnz_per[k];
+                        }
+
+                        mat_B->nnz = ptr[len] - mat_B->base;
+                        return rocsparse_status_success;
+                    }
+
+                    J* ind = static_cast<J*>(csr ? mat_B->col_data : mat_B->row_data);
+                    T* val = static_cast<T*>(mat_B->val_data);
+
+                    if(csr)
+                    {
+                        host_dense2csx<rocsparse_direction_row, T, I, J>(m,
+                                                                         n,
+                                                                         mat_B->base,
+                                                                         dense,
+                                                                         ld,
+                                                                         mat_A->order,
+                                                                         nnz_per.data(),
+                                                                         val,
+                                                                         ptr,
+                                                                         ind);
+                    }
+                    else
+                    {
+                        host_dense2csx<rocsparse_direction_column, T, I, J>(m,
+                                                                            n,
+                                                                            mat_B->base,
+                                                                            dense,
+                                                                            ld,
+                                                                            mat_A->order,
+                                                                            nnz_per.data(),
+                                                                            val,
+                                                                            ptr,
+                                                                            ind);
+                    }
+
+                    return rocsparse_status_success;
+                }
+                case rocsparse_format_coo:
+                {
+                    std::vector<I> row_ptr(len + 1, 0);
+                    for(J k = 0; k < len; ++k)
+                    {
+                        row_ptr[k + 1] = row_ptr[k] + nnz_per[k];
+                    }
+
+                    if(analysis)
+                    {
+                        mat_B->nnz = row_ptr[len];
+                        return rocsparse_status_success;
+                    }
+
+                    I* row_ind = static_cast<I*>(mat_B->row_data);
+                    I* col_ind = static_cast<I*>(mat_B->col_data);
+                    T* val     = static_cast<T*>(mat_B->val_data);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+                    for(J k = 0; k < len; ++k)
+                    {
+                        I at = row_ptr[k];
+                        for(J l = 0; l < n; ++l)
+                        {
+                            const T v = dense[column ? (ld * l + k) : (ld * k + l)];
+                            if(v != s_zero)
+                            {
+                                row_ind[at] = k + mat_B->base;
+                                col_ind[at] = l + mat_B->base;
+                                val[at]     = v;
+                                ++at;
+                            }
+                        }
+                    }
+
+                    return rocsparse_status_success;
+                }
+                default:
+                {
+                    return rocsparse_status_not_implemented;
+                }
+                }
+            });
+        });
+}
+
+rocsparse_status rocsparse_host_sparse_to_sparse(rocsparse_host_spmat_descr       source,
+                                                 rocsparse_host_spmat_descr       target,
+                                                 rocsparse_sparse_to_sparse_stage stage,
+                                                 size_t*                          buffer_size,
+                                                 void*                            temp_buffer)
+{
+    if(source == nullptr || target == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(source->data_type != target->data_type
+       || host_offset_type(source) != host_offset_type(target)
+       || host_index_type(source) != host_index_type(target))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(source->rows != target->rows || source->cols != target->cols)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // All supported conversions keep the number of non-zeros
+    if(stage == rocsparse_sparse_to_sparse_stage_analysis)
+    {
+        if(buffer_size != nullptr)
+        {
+            *buffer_size = host_generic_buffer_size;
+        }
+
+        target->nnz = source->nnz;
+        return rocsparse_status_success;
+    }
+
+    if(stage != rocsparse_sparse_to_sparse_stage_compute)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const rocsparse_format from = source->format;
+    const rocsparse_format to   = target->format;
+
+    return host_dispatch_index(
+        host_offset_type(source), host_index_type(source), [&](auto i, auto j) {
+            using I = decltype(i);
+            using J = decltype(j);
+
+            return host_dispatch_data(source->data_type, [&](auto t) {
+                using T = decltype(t);
+
+                const I  nnz     = static_cast<I>(source->nnz);
+                const T* src_val = static_cast<const T*>(source->val_data);
+                T*       dst_val = static_cast<T*>(target->val_data);
+
+                const rocsparse_index_base src_base = source->base;
+                const rocsparse_index_base dst_base = target->base;
+
+                if((from == rocsparse_format_csr && to == rocsparse_format_csc)
+                   || (from == rocsparse_format_csc && to == rocsparse_format_csr))
+                {
+                    // A CSC matrix is the CSR representation of its transpose
+                    const bool csr = (from == rocsparse_format_csr);
+                    const J    M   = static_cast<J>(csr ? source->rows : source->cols);
+                    const J    N   = static_cast<J>(csr ? source->cols : source->rows);
+
+                    const void* src_ptr = csr ? source->row_data : source->col_data;
+                    const void* src_ind = csr ? source->col_data : source->row_data;
+                    void*       dst_ptr = csr ? target->col_data : target->row_data;
+                    void*       dst_ind = csr ? target->row_data : target->col_data;
+
+                    std::vector<J> ind;
+                    std::vector<I> ptr;
+                    std::vector<I> perm;
+
+                    host_csr_to_csc_pattern(M,
+                                            N,
+                                            nnz,
+                                            static_cast<const I*>(src_ptr),
+                                            static_cast<const J*>(src_ind),
+                                            ind,
+                                            ptr,
+                                            perm,
+                                            src_base);
+                    host_csr_to_csc_values(nnz, perm.data(), src_val, dst_val);
+
+                    for(J k = 0; k <= N; ++k)
+                    {
+                        static_cast<I*>(dst_ptr)[k] = ptr[k] - src_base + dst_base;
+                    }
+
+                    for(I k = 0; k < nnz; ++k)
+                    {
+                        static_cast<J*>(dst_ind)[k] = ind[k] - src_base + dst_base;
+                    }
+
+                    return rocsparse_status_success;
+                }
+                else if(from == rocsparse_format_csr && to == rocsparse_format_coo)
+                {
+                    const J  M       = static_cast<J>(source->rows);
+                    const I* src_ptr = static_cast<const I*>(source->row_data);
+                    const J* src_ind = static_cast<const J*>(source->col_data);
+                    I*       row_ind = static_cast<I*>(target->row_data);
+                    I*       col_ind = static_cast<I*>(target->col_data);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+                    for(J r = 0; r < M; ++r)
+                    {
+                        for(I k = src_ptr[r] - src_base; k < src_ptr[r + 1] - src_base; ++k)
+                        {
+                            row_ind[k] = r + dst_base;
+                            col_ind[k] = src_ind[k] - src_base + dst_base;
+                            dst_val[k] = src_val[k];
+                        }
+                    }
+
+                    return rocsparse_status_success;
+                }
+                else if(from == rocsparse_format_coo && to == rocsparse_format_csr)
+                {
+                    // Requires the COO entries to be sorted by row
+                    const J  M       = static_cast<J>(source->rows);
+                    const I* row_ind = static_cast<const I*>(source->row_data);
+                    const I* col_ind = static_cast<const I*>(source->col_data);
+                    I*       dst_ptr = static_cast<I*>(target->row_data);
+                    J*       dst_ind = static_cast<J*>(target->col_data);
+
+                    std::fill(dst_ptr, dst_ptr + M + 1, static_cast<I>(0));
+
+                    for(I k = 0; k < nnz; ++k)
+                    {
+                        ++dst_ptr[row_ind[k] - src_base + 1];
+                    }
+
+                    dst_ptr[0] = dst_base;
+                    for(J r = 0; r < M; ++r)
+                    {
+                        dst_ptr[r + 1] += dst_ptr[r];
+                    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                    for(I k = 0; k < nnz; ++k)
+                    {
+                        dst_ind[k] = static_cast<J>(col_ind[k] - src_base + dst_base);
+                        dst_val[k] = src_val[k];
+                    }
+
+                    return rocsparse_status_success;
+                }
+
+                return rocsparse_status_not_implemented;
+            });
+        });
+}
@@ -22,51 +22,262 @@
  *
  * ************************************************************************ */
 #include "rocsparse_importer_matrixmarket.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_math.hpp"
+#include <inttypes.h>
 #include <stdio.h>
+#include <stdlib.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 rocsparse_importer_matrixmarket::rocsparse_importer_matrixmarket(const std::string& filename_)
     : m_filename(filename_)
 {
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, int8_t& val)
+/*! \brief  Read-only mapping of the entries of a mtx file, split at line boundaries into one
+ *          part per thread. Without mmap, the entries are read into a buffer. */
+struct rocsparse_mtx_map_t
 {
-    is >> row >> col >> val;
+    const char*         data{};
+    size_t              size{};
+    std::vector<size_t> parts;
+#ifdef WIN32
+    std::vector<char> buffer;
+#endif
+
+    rocsparse_mtx_map_t(const char* filename, size_t offset)
+    {
+#ifdef WIN32
+        FILE* f = fopen(filename, "rb");
+        if(f == nullptr)
+        {
+            throw rocsparse_status_internal_error;
+        }
+
+        if(0 != _fseeki64(f, 0, SEEK_END))
+        {
+            fclose(f);
+            throw rocsparse_status_internal_error;
+        }
+
+        const int64_t file_size = _ftelli64(f);
+        if(file_size < 0)
+        {
+            fclose(f);
+            throw rocsparse_status_internal_error;
+        }
+
+        offset = std::min(offset, static_cast<size_t>(file_size));
+        if(0 != _fseeki64(f, offset, SEEK_SET))
+        {
+            fclose(f);
+            throw rocsparse_status_internal_error;
+        }
+
+        // The entry section only, terminated such that strto* stops at the end of the buffer.
+        this->size = static_cast<size_t>(file_size) - offset;
+        this->buffer.resize(this->size + 1, '\0');
+        if(this->size > 0 && fread(this->buffer.data(), 1, this->size, f) != this->size)
+        {
+            fclose(f);
+            throw rocsparse_status_internal_error;
+        }
+        fclose(f);
+
+        this->data = this->buffer.data();
+        offset     = 0;
+#else
+        const int fd = open(filename, O_RDONLY);
+        if(fd < 0)
+        {
+            throw rocsparse_status_internal_error;
+        }
+
+        struct stat st;
+        if(0 != fstat(fd, &st))
+        {
+            close(fd);
+            throw rocsparse_status_internal_error;
+        }
+
+        this->size = st.st_size;
+        if(this->size > 0)
+        {
+            void* map = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(map == MAP_FAILED)
+            {
+                close(fd);
+                throw rocsparse_status_internal_error;
+            }
+            madvise(map, this->size, MADV_SEQUENTIAL);
+            this->data = (const char*)map;
+        }
+        close(fd);
+#endif
+
+#ifdef _OPENMP
+        const size_t nparts = omp_get_max_threads();
+#else
+        const size_t nparts = 1;
+#endif
+        offset = std::min(offset, this->size);
+        this->parts.resize(nparts + 1);
+        this->parts[0]      = offset;
+        this->parts[nparts] = this->size;
+        for(size_t i = 1; i < nparts; ++i)
+        {
+            const size_t pos
+                = std::max(offset + (this->size - offset) / nparts * i, this->parts[i - 1]);
+            const char* eol = (const char*)memchr(this->data + pos, '\n', this->size - pos);
+            this->parts[i] = (eol != nullptr) ? (eol - this->data + 1) : this->size;
+        }
+    }
+
+    ~rocsparse_mtx_map_t()
+    {
+#ifndef WIN32
+        if(this->data != nullptr)
+        {
+            munmap((void*)this->data, this->size);
+        }
+#endif
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  Read entries of a mtx file from a mapped buffer, without copy, the values being
+ *          parsed with strto*. A line must end with '\n', such that strto* does not read past
+ *          the buffer. */
+static inline bool read_mtx_index(const char*& p, const char* end, int64_t& ind)
+{
+    while(p < end && (*p == ' ' || *p == '\t'))
+    {
+        ++p;
+    }
+    const char* begin = p;
+    int64_t     v     = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        v = v * 10 + (*p - '0');
+        ++p;
+    }
+    ind = v;
+    return p != begin;
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, float& val)
+static inline bool read_mtx_value(const char*& p, const char* end, int8_t& val)
 {
-    is >> row >> col >> val;
+    char*      q = nullptr;
+    const long v = strtol(p, &q, 10);
+    val          = static_cast<int8_t>(v);
+    const bool s = (q != p && q <= end);
+    p            = q;
+    return s;
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, double& val)
+static inline bool read_mtx_value(const char*& p, const char* end, float& val)
 {
-    is >> row >> col >> val;
+    char* q      = nullptr;
+    val          = strtof(p, &q);
+    const bool s = (q != p && q <= end);
+    p            = q;
+    return s;
 }
 
-static inline void
-    read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, rocsparse_float_complex& val)
+static inline bool read_mtx_value(const char*& p, const char* end, double& val)
 {
-    float real{};
-    float imag{};
+    char* q      = nullptr;
+    val          = strtod(p, &q);
+    const bool s = (q != p && q <= end);
+    p            = q;
+    return s;
+}
 
-    is >> row >> col >> real >> imag;
+template <typename T>
+static inline bool read_mtx_complex_value(const char*& p, const char* end, T& val)
+{
+    using real_t = decltype(std::real(val));
+    real_t real{};
+    real_t imag{};
+    if(!read_mtx_value(p, end, real))
+    {
+        return false;
+    }
 
+    // A missing imaginary part is zero.
+    const char* q = p;
+    if(!read_mtx_value(q, end, imag))
+    {
+        imag = static_cast<real_t>(0);
+    }
     val = {real, imag};
+    return true;
 }
 
-static inline void read_mtx_value(std::istringstream&       is,
-                                  int64_t&                  row,
-                                  int64_t&                  col,
-                                  rocsparse_double_complex& val)
+static inline bool read_mtx_value(const char*& p, const char* end, rocsparse_float_complex& val)
 {
-    double real{};
-    double imag{};
+    return read_mtx_complex_value(p, end, val);
+}
 
-    is >> row >> col >> real >> imag;
+static inline bool read_mtx_value(const char*& p, const char* end, rocsparse_double_complex& val)
+{
+    return read_mtx_complex_value(p, end, val);
+}
 
-    val = {real, imag};
+/*! \brief  Read the entry of the line starting at \p p and move \p p to the next line.
+ *  \return 1 if an entry is read, 0 for a blank or comment line and -1 for an invalid line. */
+template <typename T>
+static inline int read_mtx_entry(
+    const char*& p, const char* end, bool pattern, int64_t& row, int64_t& col, T& val)
+{
+    const char* eol      = (const char*)memchr(p, '\n', end - p);
+    const char* line     = p;
+    const char* line_end = (eol != nullptr) ? eol : end;
+    p                    = (eol != nullptr) ? eol + 1 : end;
+
+    while(line < line_end && (*line == ' ' || *line == '\t' || *line == '\r'))
+    {
+        ++line;
+    }
+    if(line == line_end || *line == '%')
+    {
+        return 0;
+    }
+
+    if(!read_mtx_index(line, line_end, row) || !read_mtx_index(line, line_end, col))
+    {
+        return -1;
+    }
+
+    if(pattern)
+    {
+        val = static_cast<T>(1);
+        return 1;
+    }
+
+    if(eol == nullptr)
+    {
+        // The last line is not terminated, it is copied.
+        const std::string tail(line, line_end);
+        const char*       q = tail.c_str();
+        return read_mtx_value(q, q + tail.size(), val) ? 1 : -1;
+    }
+    return read_mtx_value(line, line_end, val) ? 1 : -1;
+}
+
+/*! \brief  Value of the mirrored entry of a symmetric, skew-symmetric or hermitian matrix. */
+template <typename T>
+static inline T mirror_mtx_value(const T& val, bool skew, bool herm)
+{
+    return skew ? static_cast<T>(-val) : (herm ? rocsparse_conj(val) : val);
 }
 
 template <typename I, typename J>
@@ -169,13 +380,16 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
     }
 
     // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
+    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0
+       && strcmp(type, "skew-symmetric") != 0 && strcmp(type, "hermitian") != 0)
     {
         throw rocsparse_status_internal_error;
     }
 
-    // Symmetric flag
-    this->m_symm = !strcmp(type, "symmetric");
+    // Symmetric flags, the entries of the upper part are deduced from the lower part
+    this->m_skew = !strcmp(type, "skew-symmetric");
+    this->m_herm = !strcmp(type, "hermitian");
+    this->m_symm = strcmp(type, "general") != 0;
 
     // Skip comments
     while(fgets(line, 1024, f))
@@ -189,11 +403,19 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
     // Read dimensions
     I snnz;
 
-    int inrow;
-    int incol;
-    int innz;
+    int64_t inrow;
+    int64_t incol;
+    int64_t innz;
+
+    sscanf(line, "%" SCNd64 " %" SCNd64 " %" SCNd64, &inrow, &incol, &innz);
 
-    sscanf(line, "%d %d %d", &inrow, &incol, &innz);
+    // Position of the entries
+    this->m_offset = ftell(f);
+    fclose(f);
+    if(this->m_offset < 0)
+    {
+        throw rocsparse_status_internal_error;
+    }
 
     rocsparse_status status;
     status = rocsparse_type_conversion(inrow, m[0]);
@@ -217,33 +439,35 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
         //
 
         //
-        // Record position.
+        // Count diagonal coefficients, in parallel over the mapped file.
         //
-        fpos_t pos;
-        if(0 != fgetpos(this->f, &pos))
+        const rocsparse_mtx_map_t map(this->m_filename.c_str(), this->m_offset);
+        const int64_t             nparts = map.parts.size() - 1;
+        I                         num_diagonal_coefficients = 0;
+        bool                      valid                     = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) reduction(+ : num_diagonal_coefficients) \
+    reduction(&& : valid)
+#endif
+        for(int64_t part = 0; part < nparts; ++part)
         {
-            throw rocsparse_status_internal_error;
-        }
-
-        //
-        // Count diagonal coefficients.
-        //
-        I num_diagonal_coefficients = 0;
-        while(fgets(line, 1024, f))
-        {
-            int32_t irow{};
-            int32_t icol{};
-            sscanf(line, "%d %d", &irow, &icol);
-            if(irow == icol)
+            const char* p   = map.data + map.parts[part];
+            const char* end = map.data + map.parts[part + 1];
+            while(p < end)
             {
-                ++num_diagonal_coefficients;
+                int64_t   irow{};
+                int64_t   icol{};
+                int8_t    ival{};
+                const int entry = read_mtx_entry(p, end, true, irow, icol, ival);
+                valid           = valid && (entry >= 0);
+                if(entry > 0 && irow == icol)
+                {
+                    ++num_diagonal_coefficients;
+                }
             }
         }
 
-        //
-        // Set position.
-        //
-        if(0 != fsetpos(this->f, &pos))
+        if(!valid)
         {
             throw rocsparse_status_internal_error;
         }
@@ -266,90 +490,107 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
 template <typename T, typename I>
 rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind, I* col_ind, T* val)
 {
-    char           line[1024];
-    const size_t   nnz = this->m_nnz;
-    std::vector<I> unsorted_row(nnz);
-    std::vector<I> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
-
-    // Read entries
-    I idx = 0;
-    while(fgets(line, 1024, f))
+    const size_t nnz     = this->m_nnz;
+    const bool   pattern = !strcmp(this->m_data, "pattern");
+    const bool   symm    = this->m_symm;
+    const bool   skew    = this->m_skew;
+    const bool   herm    = this->m_herm;
+
+    //
+    // Each thread parses its own part of the mapped file into its own buffers, the symmetric
+    // entries being expanded.
+    //
+    const rocsparse_mtx_map_t map(this->m_filename.c_str(), this->m_offset);
+    const int64_t             nparts = map.parts.size() - 1;
+    std::vector<std::vector<I>> part_row(nparts);
+    std::vector<std::vector<I>> part_col(nparts);
+    std::vector<std::vector<T>> part_val(nparts);
+    std::vector<size_t>         part_nnz(nparts + 1, 0);
+    bool                        valid = true;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) reduction(&& : valid)
+#endif
+    for(int64_t part = 0; part < nparts; ++part)
     {
-        if(idx >= nnz)
-        {
-            throw rocsparse_status_internal_error;
-        }
-
-        int64_t irow{};
-        int64_t icol{};
-        T       ival;
-
-        std::istringstream ss(line);
-
-        if(!strcmp(this->m_data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = static_cast<T>(1);
-        }
-        else
+        const char* p   = map.data + map.parts[part];
+        const char* end = map.data + map.parts[part + 1];
+
+        // Estimate the number of entries from the length of the part.
+        const size_t capacity = std::min(nnz, size_t(end - p) / (pattern ? 4 : 6) + 1);
+        part_row[part].reserve(capacity);
+        part_col[part].reserve(capacity);
+        part_val[part].reserve(capacity);
+        while(p < end)
         {
-            read_mtx_value(ss, irow, icol, ival);
-        }
-
-        unsorted_row[idx] = (I)irow;
-        unsorted_col[idx] = (I)icol;
-        unsorted_val[idx] = ival;
-
-        ++idx;
-        if(this->m_symm && irow != icol)
-        {
-            if(idx >= nnz)
+            int64_t   irow{};
+            int64_t   icol{};
+            T         ival{};
+            const int entry = read_mtx_entry(p, end, pattern, irow, icol, ival);
+            if(entry < 0)
             {
-                throw rocsparse_status_internal_error;
+                valid = false;
+                break;
+            }
+            if(entry == 0)
+            {
+                continue;
             }
 
-            unsorted_row[idx] = (I)icol;
-            unsorted_col[idx] = (I)irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            part_row[part].push_back(static_cast<I>(irow));
+            part_col[part].push_back(static_cast<I>(icol));
+            part_val[part].push_back(ival);
+            if(symm && irow != icol)
+            {
+                part_row[part].push_back(static_cast<I>(icol));
+                part_col[part].push_back(static_cast<I>(irow));
+                part_val[part].push_back(mirror_mtx_value(ival, skew, herm));
+            }
         }
+        part_nnz[part + 1] = part_row[part].size();
     }
-    fclose(f);
 
-    // Sort by row and column index
-    std::vector<I> perm(nnz);
-    for(I i = 0; i < nnz; ++i)
+    for(int64_t part = 0; part < nparts; ++part)
     {
-        perm[i] = i;
+        part_nnz[part + 1] += part_nnz[part];
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
-
-    for(I i = 0; i < nnz; ++i)
+    if(!valid || part_nnz[nparts] != nnz)
     {
-        row_ind[i] = unsorted_row[perm[i]];
+        throw rocsparse_status_internal_error;
     }
-    for(I i = 0; i < nnz; ++i)
+
+    //
+    // Merge the buffers, in the order of the file.
+    //
+    std::vector<I> unsorted_row(nnz);
+    std::vector<I> unsorted_col(nnz);
+    std::vector<T> unsorted_val(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int64_t part = 0; part < nparts; ++part)
     {
-        col_ind[i] = unsorted_col[perm[i]];
+        std::copy(part_row[part].begin(), part_row[part].end(), &unsorted_row[part_nnz[part]]);
+        std::copy(part_col[part].begin(), part_col[part].end(), &unsorted_col[part_nnz[part]]);
+        std::copy(part_val[part].begin(), part_val[part].end(), &unsorted_val[part_nnz[part]]);
+        std::vector<I>().swap(part_row[part]);
+        std::vector<I>().swap(part_col[part]);
+        std::vector<T>().swap(part_val[part]);
     }
-    for(I i = 0; i < nnz; ++i)
+
+    // Sort by row and column index
+    std::vector<I> perm;
+    host_coosort_permutation(static_cast<I>(nnz), unsorted_row.data(), unsorted_col.data(), perm);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I i = 0; i < static_cast<I>(nnz); ++i)
     {
-        val[i] = unsorted_val[perm[i]];
+        row_ind[i] = unsorted_row[perm[i]];
+        col_ind[i] = unsorted_col[perm[i]];
+        val[i]     = unsorted_val[perm[i]];
     }
 
     return rocsparse_status_success;
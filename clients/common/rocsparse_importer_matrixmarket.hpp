@@ -36,10 +36,13 @@ public:
     rocsparse_importer_matrixmarket(const std::string& filename_);
 
 private:
-    FILE*  f;
-    size_t m_nnz;
-    char   m_data[16];
-    int    m_symm;
+    FILE*   f;
+    size_t  m_nnz;
+    char    m_data[16];
+    int     m_symm;
+    int     m_skew;
+    int     m_herm;
+    int64_t m_offset;
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
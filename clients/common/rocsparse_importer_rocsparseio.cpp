@@ -166,6 +166,16 @@ rocsparse_importer_rocsparseio::rocsparse_importer_rocsparseio(const std::string
         missing_file_error_message(this->m_filename.c_str());
         throw rocsparse_status_internal_error;
     }
+
+    //
+    // Large arrays are read by chunks in parallel.
+    //
+    istatus = rocsparseiox_set_io_engine(
+        this->m_handle, ROCSPARSEIO_IO_CHUNK_SIZE, ROCSPARSEIO_IO_QUEUE_DEPTH);
+    if(istatus != rocsparseio_status_success)
+    {
+        throw rocsparse_status_internal_error;
+    }
 }
 
 template <typename I>
@@ -356,6 +366,9 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx(rocsparse_d
     rocsparseio_index_base ibase;
     istatus = rocsparseio_open(&this->m_handle, rocsparseio_rwmode_read, this->m_filename.c_str());
     ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+    istatus = rocsparseiox_set_io_engine(
+        this->m_handle, ROCSPARSEIO_IO_CHUNK_SIZE, ROCSPARSEIO_IO_QUEUE_DEPTH);
+    ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
 
     uint64_t iMb;
     uint64_t iNb;
@@ -583,6 +596,9 @@ rocsparse_status
     rocsparseio_index_base ibase;
     istatus = rocsparseio_open(&this->m_handle, rocsparseio_rwmode_read, this->m_filename.c_str());
     ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+    istatus = rocsparseiox_set_io_engine(
+        this->m_handle, ROCSPARSEIO_IO_CHUNK_SIZE, ROCSPARSEIO_IO_QUEUE_DEPTH);
+    ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
     uint64_t iM;
     uint64_t iN;
     uint64_t innz;
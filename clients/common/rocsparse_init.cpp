@@ -22,83 +22,11 @@
  *
  * ************************************************************************ */
 #include "rocsparse_init.hpp"
+#include "rocsparse_clients_matrices_cache.hpp"
 #include "rocsparse_import.hpp"
 #include "rocsparse_importer_impls.hpp"
 #include "rocsparse_matrix.hpp"
 
-template <typename I, typename J>
-void host_coo_to_csr(J M, I nnz, const J* coo_row_ind, I* csr_row_ptr, rocsparse_index_base base)
-{
-    // Resize and initialize csr_row_ptr with zeros
-    for(size_t i = 0; i < M + 1; ++i)
-    {
-        csr_row_ptr[i] = 0;
-    }
-
-    for(size_t i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(J i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
-}
-
-template <typename I, typename J>
-void host_csr_to_coo(J                     M,
-                     I                     nnz,
-                     const std::vector<I>& csr_row_ptr,
-                     std::vector<J>&       coo_row_ind,
-                     rocsparse_index_base  base)
-{
-    // Resize coo_row_ind
-    coo_row_ind.resize(nnz);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(J i = 0; i < M; ++i)
-    {
-        I row_begin = csr_row_ptr[i] - base;
-        I row_end   = csr_row_ptr[i + 1] - base;
-
-        for(I j = row_begin; j < row_end; ++j)
-        {
-            coo_row_ind[j] = i + base;
-        }
-    }
-}
-
-template <typename I, typename J>
-void host_csr_to_coo_aos(J                     M,
-                         I                     nnz,
-                         const std::vector<I>& csr_row_ptr,
-                         const std::vector<J>& csr_col_ind,
-                         std::vector<I>&       coo_ind,
-                         rocsparse_index_base  base)
-{
-    // Resize coo_ind
-    coo_ind.resize(2 * nnz);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(I i = 0; i < M; ++i)
-    {
-        I row_begin = csr_row_ptr[i] - base;
-        I row_end   = csr_row_ptr[i + 1] - base;
-
-        for(I j = row_begin; j < row_end; ++j)
-        {
-            coo_ind[2 * j]     = i + base;
-            coo_ind[2 * j + 1] = static_cast<I>(csr_col_ind[j]);
-        }
-    }
-}
-
 template <typename I, typename J, typename T>
 void host_csr_to_ell(J                     M,
                      const std::vector<I>& csr_row_ptr,
@@ -307,6 +235,14 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
                                bool                 full_rank,
                                bool                 to_int)
 {
+    // The counts, the columns and the values are drawn from counter-based generators keyed
+    // by the row and the slot within the row, such that the rows are generated
+    // independently and the matrix does not depend on the number of threads.
+    const uint64_t              seed = rocsparse_counter_rng_seed();
+    const rocsparse_counter_rng lengths(seed);
+    const rocsparse_counter_rng columns(seed + 1);
+    const rocsparse_counter_rng values(~seed);
+
     if(nnz == 0)
     {
         row_ind.resize(nnz);
@@ -357,7 +293,8 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
 
     for(I k = 0; k < M; k++)
     {
-        I nnz_in_row = std::min(random_cached_generator_exact<I>(0, 2 * avg_nnz_per_row), N);
+        I nnz_in_row = (I)lengths.uniform_int(0, k, 0, 2 * int64_t(avg_nnz_per_row));
+        nnz_in_row   = std::min(nnz_in_row, (I)(N - count[k]));
         nnz_in_row   = (I)std::min(remaining_nnz, (int64_t)nnz_in_row);
 
         count[k] += nnz_in_row;
@@ -366,13 +303,14 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
     }
 
     // Sprinkle any remaining non-zeros amoung the rows
+    uint64_t draw = 0;
     for(int64_t k = 0; k < remaining_nnz; ++k)
     {
-        I   i       = random_generator_exact<I>(0, M - 1);
+        I   i       = (I)lengths.uniform_int(1, draw++, 0, M - 1);
         int maxiter = 0;
         while(count[i] >= N && maxiter++ < 10)
         {
-            i = random_generator_exact<I>(0, M - 1);
+            i = (I)lengths.uniform_int(1, draw++, 0, M - 1);
         }
         if(maxiter >= 10)
         {
@@ -392,119 +330,106 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
         count[i] += 1;
     }
 
-    // Compute row index array from non-zeros per row count histogram
-    int64_t offset          = 0;
-    I       max_nnz_per_row = count[0];
+    // Compute the offsets of the rows from the non-zeros per row count histogram
+    std::vector<int64_t> offset(M + 1);
+    I                    max_nnz_per_row = count[0];
+    offset[0]                            = 0;
     for(I k = 0; k < M; k++)
     {
-        I nnz_in_row = count[k];
-        if(max_nnz_per_row < nnz_in_row)
-            max_nnz_per_row = nnz_in_row;
-
-        for(I i = 0; i < nnz_in_row; i++)
-        {
-            row_ind[offset + i] = k;
-        }
-
-        offset += nnz_in_row;
+        max_nnz_per_row = std::max(max_nnz_per_row, count[k]);
+        offset[k + 1]   = offset[k] + count[k];
     }
 
     // Generate column index array with values clustered around the diagonal
-    I              sec = std::min(2 * max_nnz_per_row, N);
-    std::vector<I> random(2 * sec + 1);
-    int64_t        at = 0;
-    for(I i = 0; i < M; ++i)
+    I sec = std::min(2 * max_nnz_per_row, N);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        int64_t begin      = at;
-        I       nnz_in_row = count[i];
-        I       bmax       = std::min(i + sec, N - 1);
-        I       bmin       = std::max(bmax - 2 * sec, ((I)0));
-
-        // Initial permutation of column indices
-        for(I k = 0; k <= (bmax - bmin); ++k)
+        std::vector<I> random(2 * sec + 1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(I i = 0; i < M; ++i)
         {
-            random[k] = k;
-        }
+            int64_t begin      = offset[i];
+            int64_t at         = begin;
+            I       nnz_in_row = count[i];
+            I       bmax       = std::min(i + sec, N - 1);
+            I       bmin       = std::max(bmax - 2 * sec, ((I)0));
+
+            // Initial permutation of column indices
+            for(I k = 0; k <= (bmax - bmin); ++k)
+            {
+                random[k] = k;
+            }
 
-        // shuffle permutation
-        for(I k = 0; k < nnz_in_row; ++k)
-        {
-            std::swap(random[k], random[random_generator_exact<I>(0, bmax - bmin)]);
-        }
+            // shuffle permutation
+            for(I k = 0; k < nnz_in_row; ++k)
+            {
+                std::swap(random[k], random[columns.uniform_int(i, k, 0, bmax - bmin)]);
+            }
 
-        if(full_rank)
-        {
-            col_ind[at++] = i;
-            for(I k = 1; k < nnz_in_row; ++k)
+            if(full_rank)
             {
-                if(bmin + random[k] == i)
+                col_ind[at++] = i;
+                for(I k = 1; k < nnz_in_row; ++k)
                 {
-                    col_ind[at++] = bmin + random[bmax - bmin];
+                    if(bmin + random[k] == i)
+                    {
+                        col_ind[at++] = bmin + random[bmax - bmin];
+                    }
+                    else
+                    {
+                        col_ind[at++] = bmin + random[k];
+                    }
                 }
-                else
+            }
+            else
+            {
+                for(I k = 0; k < nnz_in_row; ++k)
                 {
                     col_ind[at++] = bmin + random[k];
                 }
             }
-        }
-        else
-        {
-            for(I k = 0; k < nnz_in_row; ++k)
+
+            if(nnz_in_row > 0)
             {
-                col_ind[at++] = bmin + random[k];
+                std::sort(col_ind.data() + begin, col_ind.data() + begin + nnz_in_row);
             }
-        }
-
-        if(nnz_in_row > 0)
-        {
-            std::sort(col_ind.data() + begin, col_ind.data() + begin + nnz_in_row);
-        }
-    }
-
-    // Correct index base accordingly
-    if(base == rocsparse_index_base_one)
-    {
-        for(int64_t i = 0; i < nnz; ++i)
-        {
-            ++row_ind[i];
-            ++col_ind[i];
-        }
-    }
 
-    if(to_int)
-    {
-        // Sample random values
-        for(int64_t i = 0; i < nnz; ++i)
-        {
-            val[i] = random_cached_generator_exact<T>();
-        }
-    }
-    else
-    {
-        if(full_rank)
-        {
-            for(int64_t i = 0; i < nnz; ++i)
+            // Sample random values
+            for(I k = 0; k < nnz_in_row; ++k)
             {
-                if(row_ind[i] == col_ind[i])
+                T& v = val[begin + k];
+                if(to_int)
+                {
+                    v = values.value_exact<T>(i, k);
+                }
+                else if(full_rank && col_ind[begin + k] == i)
                 {
                     // Sample diagonal values
-                    val[i] = random_cached_generator<T>(static_cast<T>(4.0), static_cast<T>(8.0));
-                    val[i] += val[i]
-                              * random_cached_generator<T>(static_cast<T>(-1.0e-2),
-                                                           static_cast<T>(1.0e-2));
+                    v = values.value(i, k, static_cast<T>(4.0), static_cast<T>(8.0));
+                    v += v
+                         * values.value(
+                             i, int64_t(N) + k, static_cast<T>(-1.0e-2), static_cast<T>(1.0e-2));
                 }
-                else
+                else if(full_rank)
                 {
                     // Samples off-diagonal values
-                    val[i] = random_cached_generator<T>(static_cast<T>(-0.5), static_cast<T>(0.5));
+                    v = values.value(i, k, static_cast<T>(-0.5), static_cast<T>(0.5));
+                }
+                else
+                {
+                    v = values.value(i, k, static_cast<T>(-1.0), static_cast<T>(1.0));
                 }
             }
-        }
-        else
-        {
-            for(int64_t i = 0; i < nnz; ++i)
+
+            // Correct index base accordingly
+            for(I k = 0; k < nnz_in_row; ++k)
             {
-                val[i] = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+                row_ind[begin + k] = i + base;
+                col_ind[begin + k] += base;
             }
         }
     }
@@ -802,6 +727,12 @@ void rocsparse_init_csr_mtx(const char*          filename,
                             I&                   nnz,
                             rocsparse_index_base base)
 {
+    if(rocsparse_clients_matrices_cache_load(
+           "mtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base))
+    {
+        return;
+    }
+
     I       coo_M, coo_N;
     int64_t coo_nnz;
 
@@ -826,6 +757,9 @@ void rocsparse_init_csr_mtx(const char*          filename,
     {
         csr_col_ind[i] = (J)coo_col_ind[i];
     }
+
+    rocsparse_clients_matrices_cache_store(
+        "mtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
 }
 
 /* ============================================================================================ */
@@ -883,17 +817,23 @@ void rocsparse_init_csr_smtx(const char*          filename,
                              I&                   nnz,
                              rocsparse_index_base base)
 {
+    // The values are random, the cache only saves the parsing of the pattern.
+    if(!rocsparse_clients_matrices_cache_load(
+           "smtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base))
+    {
+        rocsparse_importer_mlcsr importer(filename);
+        const rocsparse_status   status = rocsparse_import_sparse_csr(
+            importer, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+        CHECK_ROCSPARSE_THROW_ERROR(status);
 
-    rocsparse_importer_mlcsr importer(filename);
-    const rocsparse_status   status
-        = rocsparse_import_sparse_csr(importer, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+        rocsparse_clients_matrices_cache_store(
+            "smtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    }
 
     for(size_t i = 0; i < nnz; ++i)
     {
         csr_val[i] = random_cached_generator<T>();
     }
-
-    CHECK_ROCSPARSE_THROW_ERROR(status);
 }
 
 /* ============================================================================================ */
@@ -957,6 +897,18 @@ void rocsparse_init_csr_bsmtx(const char*          filename,
                               I&                   nnz,
                               rocsparse_index_base base)
 {
+    // The values are random, the cache only saves the parsing and the expansion of the
+    // pattern.
+    if(rocsparse_clients_matrices_cache_load(
+           "bsmtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base))
+    {
+        for(size_t i = 0; i < nnz; ++i)
+        {
+            csr_val[i] = random_cached_generator<T>();
+        }
+        return;
+    }
+
     std::vector<I> bsr_row_ptr;
     std::vector<J> bsr_col_ind;
     std::vector<T> bsr_val;
@@ -1022,6 +974,9 @@ void rocsparse_init_csr_bsmtx(const char*          filename,
         }
     }
 
+    rocsparse_clients_matrices_cache_store(
+        "bsmtx", filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+
     for(size_t i = 0; i < nnz; ++i)
     {
         csr_val[i] = random_cached_generator<T>();
@@ -1095,10 +1050,19 @@ void rocsparse_init_csr_rocalution(const char*          filename,
                                    I&                   nnz,
                                    rocsparse_index_base base)
 {
+    if(rocsparse_clients_matrices_cache_load(
+           "rocalution", filename, row_ptr, col_ind, val, M, N, nnz, base))
+    {
+        return;
+    }
+
     rocsparse_importer_rocalution importer(filename);
     rocsparse_status              status
         = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
     CHECK_ROCSPARSE_THROW_ERROR(status);
+
+    rocsparse_clients_matrices_cache_store(
+        "rocalution", filename, row_ptr, col_ind, val, M, N, nnz, base);
 }
 
 /* ==================================================================================== */
@@ -1395,20 +1359,19 @@ void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
     rocsparse_init_csr_random(
         row_ptr, col_ind, val, Mb, Nb, nnzb, base, init_kind, full_rank, to_int);
 
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
-    val.resize(nvalues);
-    if(to_int)
-    {
-        for(size_t i = 0; i < nvalues; ++i)
-        {
-            val[i] = random_cached_generator_exact<T>();
-        }
-    }
-    else
+    // The values of a block are keyed by the block and the slot within the block
+    const rocsparse_counter_rng values(rocsparse_counter_rng_seed());
+    const int64_t               block_nvalues = int64_t(row_block_dim) * col_block_dim;
+    val.resize(nnzb * block_nvalues);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t k = 0; k < int64_t(nnzb); ++k)
     {
-        for(size_t i = 0; i < nvalues; ++i)
+        for(int64_t l = 0; l < block_nvalues; ++l)
         {
-            val[i] = random_cached_generator<T>();
+            val[k * block_nvalues + l]
+                = to_int ? values.value_exact<T>(k, l) : values.value<T>(k, l);
         }
     }
 }
@@ -1691,122 +1654,1219 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
     }
 }
 
-#define INSTANTIATEI(TYPE)                    \
-    template void rocsparse_init_index<TYPE>( \
-        std::vector<TYPE> & x, size_t nnz, size_t start, size_t end);
+/* ==================================================================================== */
+/*! \brief  Draw the edge e of a R-MAT graph.
+ *  \details At each level, a quadrant of the current sub-matrix is chosen with the probabilities
+ *  (a, b, c, d) of the 2x2 Kronecker seed. The first levels only split the larger dimension,
+ *  with the marginal probabilities, until the sub-matrices are square; the remaining levels
+ *  split both dimensions.
+ *  Edges out of a dimension that is not a power of two are drawn again, up to a limited number
+ *  of attempts. */
+template <typename J>
+static bool rocsparse_rmat_edge(const rocsparse_counter_rng& rng,
+                                int64_t                      e,
+                                J                            M,
+                                J                            N,
+                                int                          mbits,
+                                int                          nbits,
+                                double                       a,
+                                double                       ab,
+                                double                       abc,
+                                double                       ac,
+                                J&                           i,
+                                J&                           j)
+{
+    static constexpr int max_attempts = 16;
+    const int            nlevels      = std::max(mbits, nbits);
+    for(int attempt = 0; attempt < max_attempts; ++attempt)
+    {
+        uint64_t row = 0;
+        uint64_t col = 0;
+        for(int level = 0; level < nlevels; ++level)
+        {
+            const double p          = rng.uniform(e, uint64_t(attempt) * nlevels + level);
+            const bool   split_rows = (level >= nlevels - mbits);
+            const bool   split_cols = (level >= nlevels - nbits);
+            if(split_rows && split_cols)
+            {
+                row = (row << 1) | uint64_t(p >= ab);
+                col = (col << 1) | uint64_t((p >= a && p < ab) || p >= abc);
+            }
+            else if(split_rows)
+            {
+                row = (row << 1) | uint64_t(p >= ab);
+            }
+            else
+            {
+                col = (col << 1) | uint64_t(p >= ac);
+            }
+        }
 
-#define INSTANTIATE(TYPE)                                                                          \
-    template void rocsparse_init<TYPE>(TYPE * A,                                                   \
-                                       size_t M,                                                   \
-                                       size_t N,                                                   \
-                                       size_t lda,                                                 \
-                                       size_t stride,                                              \
-                                       size_t batch_count = 1,                                     \
-                                       TYPE   a           = static_cast<TYPE>(0),                  \
-                                       TYPE   b           = static_cast<TYPE>(1));                             \
-    template void rocsparse_init_exact<TYPE>(TYPE * A,                                             \
-                                             size_t M,                                             \
-                                             size_t N,                                             \
-                                             size_t lda,                                           \
-                                             size_t stride,                                        \
-                                             size_t batch_count,                                   \
-                                             int    a = 1,                                         \
-                                             int    b = 10);                                          \
-    template void rocsparse_init<TYPE>(std::vector<TYPE> & A,                                      \
-                                       size_t M,                                                   \
-                                       size_t N,                                                   \
-                                       size_t lda,                                                 \
-                                       size_t stride,                                              \
-                                       size_t batch_count = 1,                                     \
-                                       TYPE   a           = static_cast<TYPE>(0),                  \
-                                       TYPE   b           = static_cast<TYPE>(1));                             \
-    template void rocsparse_init_exact<TYPE>(std::vector<TYPE> & A,                                \
-                                             size_t M,                                             \
-                                             size_t N,                                             \
-                                             size_t lda,                                           \
-                                             size_t stride,                                        \
-                                             size_t batch_count,                                   \
-                                             int    a = 1,                                         \
-                                             int    b = 10);                                          \
-    template void rocsparse_init_alternating_sign<TYPE>(                                           \
-        std::vector<TYPE> & A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count); \
-    template void rocsparse_init_nan<TYPE>(TYPE * A, size_t N);                                    \
-    template void rocsparse_init_nan<TYPE>(std::vector<TYPE> & A,                                  \
-                                           size_t M,                                               \
-                                           size_t N,                                               \
-                                           size_t lda,                                             \
-                                           size_t stride = 0,                                      \
-                                           size_t batch_count);
+        if(row < uint64_t(M) && col < uint64_t(N))
+        {
+            i = J(row);
+            j = J(col);
+            return true;
+        }
+    }
+    return false;
+}
 
-#define INSTANTIATE1(ITYPE, JTYPE)                                                         \
-    template void host_csr_to_coo<ITYPE, JTYPE>(JTYPE                     M,               \
-                                                ITYPE                     nnz,             \
-                                                const std::vector<ITYPE>& csr_row_ptr,     \
-                                                std::vector<JTYPE>&       coo_row_ind,     \
-                                                rocsparse_index_base      base);                \
-    template void host_coo_to_csr<ITYPE, JTYPE>(JTYPE                M,                    \
-                                                ITYPE                NNZ,                  \
-                                                const JTYPE*         coo_row_ind,          \
-                                                ITYPE*               csr_row_ptr,          \
-                                                rocsparse_index_base base);                \
-    template void host_csr_to_coo_aos<ITYPE, JTYPE>(JTYPE                     M,           \
-                                                    ITYPE                     nnz,         \
-                                                    const std::vector<ITYPE>& csr_row_ptr, \
-                                                    const std::vector<JTYPE>& csr_col_ind, \
-                                                    std::vector<ITYPE>&       coo_ind,     \
-                                                    rocsparse_index_base      base);
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rmat(std::vector<I>&      row_ptr,
+                             std::vector<J>&      col_ind,
+                             std::vector<T>&      val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             J                    edge_factor,
+                             double               a,
+                             double               b,
+                             double               c,
+                             double               d,
+                             uint64_t             seed,
+                             bool                 full_rank,
+                             bool                 to_int)
+{
+    const double sum = a + b + c + d;
+    if(a < 0 || b < 0 || c < 0 || d < 0 || !(sum > 0))
+    {
+        std::cerr << "Error: invalid R-MAT probabilities (" << a << ", " << b << ", " << c << ", "
+                  << d << ")." << std::endl;
+        exit(1);
+    }
 
-#define INSTANTIATE2(ITYPE, TTYPE)                                                              \
-    template void rocsparse_init_coo_tridiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,    \
-                                                               std::vector<ITYPE> & col_ind,    \
-                                                               std::vector<TTYPE> & val,        \
-                                                               ITYPE M,                         \
-                                                               ITYPE N,                         \
-                                                               int64_t & nnz,                   \
-                                                               rocsparse_index_base base,       \
-                                                               ITYPE                l,          \
-                                                               ITYPE                u);                        \
-    template void rocsparse_init_coo_pentadiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,  \
-                                                                 std::vector<ITYPE> & col_ind,  \
-                                                                 std::vector<TTYPE> & val,      \
-                                                                 ITYPE M,                       \
-                                                                 ITYPE N,                       \
-                                                                 int64_t & nnz,                 \
-                                                                 rocsparse_index_base base,     \
-                                                                 ITYPE                ll,       \
-                                                                 ITYPE                l,        \
-                                                                 ITYPE                u,        \
-                                                                 ITYPE                uu);                     \
-    template void rocsparse_init_coo_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
-                                                             std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
-                                                             int32_t dim_x,                     \
-                                                             int32_t dim_y,                     \
-                                                             ITYPE & M,                         \
-                                                             ITYPE & N,                         \
-                                                             int64_t & nnz,                     \
-                                                             rocsparse_index_base base);        \
-    template void rocsparse_init_ell_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
-                                                             int32_t dim_x,                     \
-                                                             int32_t dim_y,                     \
-                                                             ITYPE & M,                         \
-                                                             ITYPE & N,                         \
-                                                             ITYPE & width,                     \
-                                                             rocsparse_index_base base);        \
-    template void rocsparse_init_coo_matrix<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,         \
-                                                          std::vector<ITYPE> & col_ind,         \
-                                                          std::vector<TTYPE> & val,             \
-                                                          ITYPE                M,               \
-                                                          ITYPE                N,               \
-                                                          int64_t              nnz,             \
-                                                          rocsparse_index_base base,            \
-                                                          bool                 full_rank,       \
-                                                          bool                 to_int);                         \
-    template void rocsparse_init_coo_laplace3d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
-                                                             std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
-                                                             int32_t dim_x,                     \
+    // If M > N, full rank is not possible
+    if(full_rank && M > N)
+    {
+        std::cerr << "ERROR: M > N, cannot generate matrix with full rank" << std::endl;
+        full_rank = false;
+    }
+
+    row_ptr.resize(M + 1);
+    row_ptr[0] = base;
+    if(M == 0 || N == 0)
+    {
+        std::fill(row_ptr.begin(), row_ptr.end(), static_cast<I>(base));
+        nnz = 0;
+        col_ind.resize(0);
+        val.resize(0);
+        return;
+    }
+
+    int mbits = 0;
+    int nbits = 0;
+    while((uint64_t(1) << mbits) < uint64_t(M))
+    {
+        ++mbits;
+    }
+    while((uint64_t(1) << nbits) < uint64_t(N))
+    {
+        ++nbits;
+    }
+
+    const rocsparse_counter_rng edges(seed);
+    const rocsparse_counter_rng values(~seed);
+
+    // Draw the edges, dropped edges are marked with the row index M.
+    const int64_t  nedges = int64_t(std::max(edge_factor, J(0))) * M;
+    std::vector<J> edge_row(nedges);
+    std::vector<J> edge_col(nedges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        if(!rocsparse_rmat_edge(edges,
+                                e,
+                                M,
+                                N,
+                                mbits,
+                                nbits,
+                                a / sum,
+                                (a + b) / sum,
+                                (a + b + c) / sum,
+                                (a + c) / sum,
+                                edge_row[e],
+                                edge_col[e]))
+        {
+            edge_row[e] = M;
+        }
+    }
+
+    // Bucket the column indices by row, the diagonal is added for full rank matrices.
+    std::vector<int64_t> bucket_ptr(M + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        if(edge_row[e] < M)
+        {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++bucket_ptr[edge_row[e] + 1];
+        }
+    }
+
+    if(full_rank)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            ++bucket_ptr[i + 1];
+        }
+    }
+
+    for(J i = 0; i < M; ++i)
+    {
+        bucket_ptr[i + 1] += bucket_ptr[i];
+    }
+
+    std::vector<J>       bucket(bucket_ptr[M]);
+    std::vector<int64_t> bucket_pos(bucket_ptr.begin(), bucket_ptr.end() - 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        const J i = edge_row[e];
+        if(i < M)
+        {
+            int64_t at;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            at = bucket_pos[i]++;
+            bucket[at] = edge_col[e];
+        }
+    }
+
+    std::vector<J>().swap(edge_row);
+    std::vector<J>().swap(edge_col);
+
+    if(full_rank)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            bucket[bucket_pos[i]] = i;
+        }
+    }
+
+    // Sort the rows and merge the duplicated edges, the bucket order does not matter.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        J* begin = bucket.data() + bucket_ptr[i];
+        J* end   = bucket.data() + bucket_ptr[i + 1];
+        std::sort(begin, end);
+        row_ptr[i + 1] = static_cast<I>(std::unique(begin, end) - begin);
+    }
+
+    int64_t count = 0;
+    for(J i = 0; i < M; ++i)
+    {
+        count += row_ptr[i + 1];
+        row_ptr[i + 1] = static_cast<I>(count + base);
+    }
+
+    if(std::is_same<I, int32_t>() && count > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR R-MAT matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    nnz = static_cast<I>(count);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    // The values only depend on the position of the entries.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        const J* bucket_row = bucket.data() + bucket_ptr[i];
+        for(I k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            const J j = bucket_row[k - (row_ptr[i] - base)];
+            col_ind[k] = j + base;
+            if(to_int)
+            {
+                val[k] = values.value_exact<T>(i, j);
+            }
+            else if(full_rank && i == j)
+            {
+                val[k] = values.value(i, j, static_cast<T>(4.0), static_cast<T>(8.0));
+                val[k] += val[k]
+                          * values.value(
+                              i, int64_t(N) + j, static_cast<T>(-1.0e-2), static_cast<T>(1.0e-2));
+            }
+            else if(full_rank)
+            {
+                val[k] = values.value(i, j, static_cast<T>(-0.5), static_cast<T>(0.5));
+            }
+            else
+            {
+                val[k] = values.value(i, j, static_cast<T>(-1.0), static_cast<T>(1.0));
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_rmat(std::vector<I>&      row_ind,
+                             std::vector<I>&      col_ind,
+                             std::vector<T>&      val,
+                             I                    M,
+                             I                    N,
+                             int64_t&             nnz,
+                             rocsparse_index_base base,
+                             I                    edge_factor,
+                             double               a,
+                             double               b,
+                             double               c,
+                             double               d,
+                             uint64_t             seed,
+                             bool                 full_rank,
+                             bool                 to_int)
+{
+    std::vector<int64_t> row_ptr;
+    rocsparse_init_csr_rmat(
+        row_ptr, col_ind, val, M, N, nnz, base, edge_factor, a, b, c, d, seed, full_rank, to_int);
+
+    row_ind.resize(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        for(int64_t k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rmat(std::vector<I>&      row_ptr,
+                               std::vector<J>&      col_ind,
+                               std::vector<T>&      val,
+                               J                    Mb,
+                               J                    Nb,
+                               I&                   nnzb,
+                               J                    row_block_dim,
+                               J                    col_block_dim,
+                               rocsparse_index_base base,
+                               J                    edge_factor,
+                               double               a,
+                               double               b,
+                               double               c,
+                               double               d,
+                               uint64_t             seed,
+                               bool                 to_int)
+{
+    rocsparse_init_csr_rmat(
+        row_ptr, col_ind, val, Mb, Nb, nnzb, base, edge_factor, a, b, c, d, seed, false, to_int);
+
+    const rocsparse_counter_rng values(~seed);
+    const int64_t               block_nvalues = int64_t(row_block_dim) * col_block_dim;
+    val.resize(nnzb * block_nvalues);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t k = 0; k < int64_t(nnzb); ++k)
+    {
+        for(int64_t l = 0; l < block_nvalues; ++l)
+        {
+            val[k * block_nvalues + l]
+                = to_int ? values.value_exact<T>(k, l) : values.value<T>(k, l);
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Draw the length of the row i, rounded stochastically such that the mean of the
+ *  lengths is preserved. */
+static int64_t rocsparse_rowdist_length(const rocsparse_counter_rng&  rng,
+                                        int64_t                       i,
+                                        rocsparse_matrix_rowdist_kind family,
+                                        double                        mean,
+                                        double                        cv)
+{
+    const double pi    = acos(-1.0);
+    const double sigma = cv * mean;
+
+    // Standard normal number (Box-Muller).
+    auto normal = [&]() {
+        return std::sqrt(-2.0 * std::log(1.0 - rng.uniform(i, 0)))
+               * std::cos(2.0 * pi * rng.uniform(i, 1));
+    };
+
+    double length = mean;
+    switch(family)
+    {
+    case rocsparse_matrix_rowdist_kind_uniform:
+    {
+        length = mean + std::sqrt(3.0) * sigma * (2.0 * rng.uniform(i, 0) - 1.0);
+        break;
+    }
+    case rocsparse_matrix_rowdist_kind_normal:
+    {
+        length = mean + sigma * normal();
+        break;
+    }
+    case rocsparse_matrix_rowdist_kind_lognormal:
+    {
+        // Logarithm of the lengths of mean log(mean) - s2 / 2 and of variance s2.
+        const double s2 = std::log1p(cv * cv);
+        if(mean > 0)
+        {
+            length = std::exp(std::log(mean) - 0.5 * s2 + std::sqrt(s2) * normal());
+        }
+        break;
+    }
+    case rocsparse_matrix_rowdist_kind_zipf:
+    {
+        // Pareto distribution of shape alpha > 2, the coefficient of variation of which is
+        // 1 / sqrt(alpha * (alpha - 2)).
+        if(cv > 0)
+        {
+            const double alpha = 1.0 + std::sqrt(1.0 + 1.0 / (cv * cv));
+            length = mean * (alpha - 1.0) / alpha * std::pow(1.0 - rng.uniform(i, 0), -1.0 / alpha);
+        }
+        break;
+    }
+    }
+
+    return (length > 0) ? int64_t(std::floor(std::min(length, 9.0e18) + rng.uniform(i, 2))) : 0;
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the row lengths in CSR
+ *  format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rowdist(std::vector<I>&               row_ptr,
+                                std::vector<J>&               col_ind,
+                                std::vector<T>&               val,
+                                J                             M,
+                                J                             N,
+                                I&                            nnz,
+                                rocsparse_index_base          base,
+                                rocsparse_matrix_rowdist_kind family,
+                                double                        mean,
+                                double                        cv,
+                                J                             max_length,
+                                J                             bandwidth,
+                                double                        clustering,
+                                uint64_t                      seed,
+                                bool                          full_rank,
+                                bool                          to_int)
+{
+    if(!(mean >= 0) || !(cv >= 0) || max_length < 0 || bandwidth < 0 || !(clustering >= 0)
+       || !(clustering <= 1))
+    {
+        std::cerr << "Error: invalid row length distribution (mean " << mean << ", cv " << cv
+                  << ", max length " << max_length << ", bandwidth " << bandwidth
+                  << ", clustering " << clustering << ")." << std::endl;
+        exit(1);
+    }
+
+    // If M > N, full rank is not possible
+    if(full_rank && M > N)
+    {
+        std::cerr << "ERROR: M > N, cannot generate matrix with full rank" << std::endl;
+        full_rank = false;
+    }
+
+    row_ptr.resize(M + 1);
+    row_ptr[0] = base;
+    if(M == 0 || N == 0)
+    {
+        std::fill(row_ptr.begin(), row_ptr.end(), static_cast<I>(base));
+        nnz = 0;
+        col_ind.resize(0);
+        val.resize(0);
+        return;
+    }
+
+    const rocsparse_counter_rng lengths(seed);
+    const rocsparse_counter_rng columns(seed + 1);
+    const rocsparse_counter_rng values(~seed);
+
+    // The columns of the row i are drawn from the window [lo, hi], the diagonal entry is
+    // excluded from the window with full rank, such that it is not drawn twice.
+    auto window = [&](J i, int64_t& lo, int64_t& hi, bool& diag) {
+        lo = 0;
+        hi = int64_t(N) - 1;
+        if(bandwidth > 0)
+        {
+            const int64_t center = int64_t((double(i) + 0.5) * double(N) / double(M));
+            lo                   = std::max(center - int64_t(bandwidth), int64_t(0));
+            hi                   = std::min(center + int64_t(bandwidth), int64_t(N) - 1);
+        }
+        diag = full_rank && (lo <= i) && (i <= hi);
+    };
+
+    // Draw the lengths of the rows, the number of drawn columns is stored in row_ptr[i + 1].
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        int64_t lo, hi;
+        bool    diag;
+        window(i, lo, hi, diag);
+
+        int64_t length = rocsparse_rowdist_length(lengths, i, family, mean, cv);
+        if(max_length > 0)
+        {
+            length = std::min(length, int64_t(max_length));
+        }
+        if(full_rank)
+        {
+            length = std::max(length, int64_t(1)) - 1;
+        }
+        row_ptr[i + 1] = static_cast<I>(std::min(length, hi - lo + 1 - int64_t(diag)));
+    }
+
+    int64_t count = 0;
+    for(J i = 0; i < M; ++i)
+    {
+        count += row_ptr[i + 1] + (full_rank ? 1 : 0);
+        row_ptr[i + 1] = static_cast<I>(count + base);
+    }
+
+    if(std::is_same<I, int32_t>() && count > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    nnz = static_cast<I>(count);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    // The length drawn columns of a row form nruns runs of consecutive columns, nruns
+    // decreasing from length (no clustering) to 1 (a single dense run). The sorted offsets
+    // of the runs are drawn in [0, width - length], the run r starts at its offset plus the
+    // length of the runs preceding it, such that the columns are sorted and distinct.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int64_t> offsets;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            int64_t lo, hi;
+            bool    diag;
+            window(i, lo, hi, diag);
+
+            const I       begin  = row_ptr[i] - base;
+            const I       end    = row_ptr[i + 1] - base;
+            const int64_t length = int64_t(end - begin) - (full_rank ? 1 : 0);
+            const int64_t width  = hi - lo + 1 - int64_t(diag);
+
+            if(length > 0)
+            {
+                const int64_t nruns = std::min(
+                    std::max(int64_t(std::llround(double(length) * (1.0 - clustering))),
+                             int64_t(1)),
+                    length);
+
+                offsets.resize(nruns);
+                for(int64_t r = 0; r < nruns; ++r)
+                {
+                    offsets[r] = columns.uniform_int(i, r, 0, width - length);
+                }
+                std::sort(offsets.begin(), offsets.end());
+
+                I at = begin;
+                for(int64_t r = 0; r < nruns; ++r)
+                {
+                    const int64_t run_begin = offsets[r] + (at - begin);
+                    const int64_t run_size  = length / nruns + ((r < length % nruns) ? 1 : 0);
+                    for(int64_t k = 0; k < run_size; ++k)
+                    {
+                        const int64_t j = lo + run_begin + k;
+                        col_ind[at++]   = static_cast<J>((diag && j >= i) ? j + 1 : j);
+                    }
+                }
+            }
+
+            if(full_rank)
+            {
+                // Insert the diagonal entry.
+                col_ind[end - 1] = i;
+                std::rotate(std::lower_bound(&col_ind[begin], &col_ind[end - 1], i),
+                            &col_ind[end - 1],
+                            &col_ind[end - 1] + 1);
+            }
+
+            // The values only depend on the position of the entries.
+            for(I k = begin; k < end; ++k)
+            {
+                const J j = col_ind[k];
+                if(to_int)
+                {
+                    val[k] = values.value_exact<T>(i, j);
+                }
+                else if(full_rank && i == j)
+                {
+                    val[k] = values.value(i, j, static_cast<T>(4.0), static_cast<T>(8.0));
+                    val[k] += val[k]
+                              * values.value(i,
+                                             int64_t(N) + j,
+                                             static_cast<T>(-1.0e-2),
+                                             static_cast<T>(1.0e-2));
+                }
+                else if(full_rank)
+                {
+                    val[k] = values.value(i, j, static_cast<T>(-0.5), static_cast<T>(0.5));
+                }
+                else
+                {
+                    val[k] = values.value(i, j, static_cast<T>(-1.0), static_cast<T>(1.0));
+                }
+                col_ind[k] = j + base;
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the row lengths in COO
+ *  format */
+template <typename I, typename T>
+void rocsparse_init_coo_rowdist(std::vector<I>&               row_ind,
+                                std::vector<I>&               col_ind,
+                                std::vector<T>&               val,
+                                I                             M,
+                                I                             N,
+                                int64_t&                      nnz,
+                                rocsparse_index_base          base,
+                                rocsparse_matrix_rowdist_kind family,
+                                double                        mean,
+                                double                        cv,
+                                I                             max_length,
+                                I                             bandwidth,
+                                double                        clustering,
+                                uint64_t                      seed,
+                                bool                          full_rank,
+                                bool                          to_int)
+{
+    std::vector<int64_t> row_ptr;
+    rocsparse_init_csr_rowdist(row_ptr,
+                               col_ind,
+                               val,
+                               M,
+                               N,
+                               nnz,
+                               base,
+                               family,
+                               mean,
+                               cv,
+                               max_length,
+                               bandwidth,
+                               clustering,
+                               seed,
+                               full_rank,
+                               to_int);
+
+    row_ind.resize(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        for(int64_t k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the row lengths in GEBSR
+ *  format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rowdist(std::vector<I>&               row_ptr,
+                                  std::vector<J>&               col_ind,
+                                  std::vector<T>&               val,
+                                  J                             Mb,
+                                  J                             Nb,
+                                  I&                            nnzb,
+                                  J                             row_block_dim,
+                                  J                             col_block_dim,
+                                  rocsparse_index_base          base,
+                                  rocsparse_matrix_rowdist_kind family,
+                                  double                        mean,
+                                  double                        cv,
+                                  J                             max_length,
+                                  J                             bandwidth,
+                                  double                        clustering,
+                                  uint64_t                      seed,
+                                  bool                          to_int)
+{
+    rocsparse_init_csr_rowdist(row_ptr,
+                               col_ind,
+                               val,
+                               Mb,
+                               Nb,
+                               nnzb,
+                               base,
+                               family,
+                               mean,
+                               cv,
+                               max_length,
+                               bandwidth,
+                               clustering,
+                               seed,
+                               false,
+                               to_int);
+
+    const rocsparse_counter_rng values(~seed);
+    const int64_t               block_nvalues = int64_t(row_block_dim) * col_block_dim;
+    val.resize(nnzb * block_nvalues);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t k = 0; k < int64_t(nnzb); ++k)
+    {
+        for(int64_t l = 0; l < block_nvalues; ++l)
+        {
+            val[k * block_nvalues + l]
+                = to_int ? values.value_exact<T>(k, l) : values.value<T>(k, l);
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Entry of a stencil, offset of the neighbor node and weight of the coupling. */
+struct rocsparse_stencil_entry
+{
+    int32_t sx;
+    int32_t sy;
+    int32_t sz;
+    double  w;
+};
+
+/* ==================================================================================== */
+/*! \brief  Entries of the 5 or 9-point (2D) and 7, 19 or 27-point (3D) stencils, in the
+ *  lexicographic order of the offsets. The weight of a coupling is the opposite of the mean
+ *  of the anisotropy coefficients of the axes it moves along, the weight of the center is
+ *  the opposite of the sum of the weights of the couplings. */
+static std::vector<rocsparse_stencil_entry>
+    rocsparse_stencil_entries(int32_t points, double ax, double ay, double az)
+{
+    const bool    planar       = (points == 5 || points == 9);
+    const int32_t max_distance = (points == 5 || points == 7)    ? 1
+                                 : (points == 9 || points == 19) ? 2
+                                                                 : 3;
+
+    std::vector<rocsparse_stencil_entry> entries;
+    size_t                               center   = 0;
+    double                               diagonal = 0.0;
+    for(int32_t sz = -1; sz <= 1; ++sz)
+    {
+        for(int32_t sy = -1; sy <= 1; ++sy)
+        {
+            for(int32_t sx = -1; sx <= 1; ++sx)
+            {
+                const int32_t distance = std::abs(sx) + std::abs(sy) + std::abs(sz);
+                if((planar && sz != 0) || distance > max_distance)
+                {
+                    continue;
+                }
+
+                if(distance == 0)
+                {
+                    center = entries.size();
+                    entries.push_back({0, 0, 0, 0.0});
+                }
+                else
+                {
+                    const double w
+                        = -(ax * std::abs(sx) + ay * std::abs(sy) + az * std::abs(sz)) / distance;
+                    entries.push_back({sx, sy, sz, w});
+                    diagonal -= w;
+                }
+            }
+        }
+    }
+
+    entries[center].w = diagonal;
+    return entries;
+}
+
+/* ==================================================================================== */
+/*! \brief  Columns and weights of the couplings of the node (ix, iy, iz), sorted by
+ *  columns. The couplings leaving the grid are dropped with Dirichlet boundaries and wrapped
+ *  around with periodic boundaries, where the couplings reaching the same node are merged.
+ *  Return the number of columns. */
+static int32_t rocsparse_stencil_row(const std::vector<rocsparse_stencil_entry>& entries,
+                                     int64_t                                     ix,
+                                     int64_t                                     iy,
+                                     int64_t                                     iz,
+                                     int64_t                                     dim_x,
+                                     int64_t                                     dim_y,
+                                     int64_t                                     dim_z,
+                                     bool                                        periodic,
+                                     int64_t*                                    cols,
+                                     double*                                     weights)
+{
+    const int64_t dims[3] = {dim_x, dim_y, dim_z};
+
+    int32_t n = 0;
+    for(const rocsparse_stencil_entry& e : entries)
+    {
+        int64_t j[3]   = {ix + e.sx, iy + e.sy, iz + e.sz};
+        bool    inside = true;
+        for(int d = 0; d < 3; ++d)
+        {
+            if(j[d] < 0 || j[d] >= dims[d])
+            {
+                j[d]   = (j[d] + dims[d]) % dims[d];
+                inside = inside && periodic;
+            }
+        }
+
+        if(!inside)
+        {
+            continue;
+        }
+
+        // Insertion into the sorted columns.
+        const int64_t col = (j[2] * dim_y + j[1]) * dim_x + j[0];
+        int32_t       k   = n;
+        while(k > 0 && cols[k - 1] > col)
+        {
+            --k;
+        }
+
+        if(k > 0 && cols[k - 1] == col)
+        {
+            weights[k - 1] += e.w;
+            continue;
+        }
+
+        for(int32_t l = n; l > k; --l)
+        {
+            cols[l]    = cols[l - 1];
+            weights[l] = weights[l - 1];
+        }
+        cols[k]    = col;
+        weights[k] = e.w;
+        ++n;
+    }
+
+    return n;
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix, either as a block matrix of dense dof x dof
+ *  blocks, one block row per node, or as a scalar matrix of dof rows per node. */
+template <typename I, typename J, typename T>
+static void rocsparse_init_stencil(std::vector<I>&                   ptr,
+                                   std::vector<J>&                   ind,
+                                   std::vector<T>&                   val,
+                                   bool                              blocks,
+                                   rocsparse_direction               dirb,
+                                   J&                                M,
+                                   I&                                nnz,
+                                   rocsparse_index_base              base,
+                                   int32_t                           dim_x,
+                                   int32_t                           dim_y,
+                                   int32_t                           dim_z,
+                                   int32_t                           points,
+                                   J                                 dof,
+                                   rocsparse_matrix_stencil_boundary boundary,
+                                   double                            ax,
+                                   double                            ay,
+                                   double                            az)
+{
+    if((points != 5 && points != 7 && points != 9 && points != 19 && points != 27) || dof < 1
+       || dim_x < 0 || dim_y < 0 || dim_z < 0
+       || (boundary != rocsparse_matrix_stencil_boundary_dirichlet
+           && boundary != rocsparse_matrix_stencil_boundary_periodic))
+    {
+        std::cerr << "Error: invalid stencil (" << points << " points, dof " << dof
+                  << ", dimensions " << dim_x << " " << dim_y << " " << dim_z << ", boundary "
+                  << rocsparse_matrix_stencil_boundary2string(boundary) << ")." << std::endl;
+        exit(1);
+    }
+
+    // 2D grids may omit dim_z.
+    dim_z = std::max(dim_z, 1);
+
+    const int64_t nnodes        = int64_t(dim_x) * dim_y * dim_z;
+    const int64_t node_nrows    = blocks ? 1 : dof;
+    const int64_t entry_ncols   = blocks ? 1 : dof;
+    const int64_t block_nvalues = blocks ? int64_t(dof) * dof : 1;
+    if(nnodes * node_nrows > std::numeric_limits<J>::max())
+    {
+        std::cerr << "Error: Attempting to create a stencil matrix with more than "
+                  << std::numeric_limits<J>::max() << " rows." << std::endl;
+        exit(1);
+    }
+
+    M = static_cast<J>(nnodes * node_nrows);
+    ptr.resize(M + 1);
+    ptr[0] = base;
+
+    const std::vector<rocsparse_stencil_entry> entries
+        = rocsparse_stencil_entries(points, ax, ay, az);
+    const bool periodic = (boundary == rocsparse_matrix_stencil_boundary_periodic);
+
+    // The nodes are processed by lines of the z-slabs, such that 2D grids are also
+    // processed in parallel, the number of columns of the rows is stored in ptr[i + 1].
+    const int64_t nlines = int64_t(dim_y) * dim_z;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(int64_t line = 0; line < nlines; ++line)
+    {
+        const int64_t iy = line % dim_y;
+        const int64_t iz = line / dim_y;
+        int64_t       cols[27];
+        double        weights[27];
+        for(int64_t ix = 0; ix < dim_x; ++ix)
+        {
+            const int64_t node = line * dim_x + ix;
+            const int32_t n    = rocsparse_stencil_row(
+                entries, ix, iy, iz, dim_x, dim_y, dim_z, periodic, cols, weights);
+            for(int64_t r = 0; r < node_nrows; ++r)
+            {
+                ptr[node * node_nrows + r + 1] = static_cast<I>(n * entry_ncols);
+            }
+        }
+    }
+
+    int64_t count = 0;
+    for(J i = 0; i < M; ++i)
+    {
+        count += ptr[i + 1];
+        ptr[i + 1] = static_cast<I>(count + base);
+    }
+
+    if(std::is_same<I, int32_t>() && count > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    nnz = static_cast<I>(count);
+    ind.resize(nnz);
+    val.resize(size_t(nnz) * block_nvalues);
+
+    // The couplings between the degrees of freedom of two nodes are the couplings of the
+    // stencil scaled by the dense dof x dof matrix of unit diagonal and of off-diagonal
+    // -1 / (2 dof), such that the matrix is symmetric positive definite with Dirichlet
+    // boundaries.
+    const double off_diagonal = -0.5 / dof;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(int64_t line = 0; line < nlines; ++line)
+    {
+        const int64_t iy = line % dim_y;
+        const int64_t iz = line / dim_y;
+        int64_t       cols[27];
+        double        weights[27];
+        for(int64_t ix = 0; ix < dim_x; ++ix)
+        {
+            const int64_t node = line * dim_x + ix;
+            const int32_t n    = rocsparse_stencil_row(
+                entries, ix, iy, iz, dim_x, dim_y, dim_z, periodic, cols, weights);
+            for(int64_t r = 0; r < node_nrows; ++r)
+            {
+                I at = ptr[node * node_nrows + r] - base;
+                for(int32_t k = 0; k < n; ++k)
+                {
+                    if(blocks)
+                    {
+                        ind[at] = static_cast<J>(cols[k] + base);
+                        for(J br = 0; br < dof; ++br)
+                        {
+                            for(J bc = 0; bc < dof; ++bc)
+                            {
+                                const int64_t l = (dirb == rocsparse_direction_row)
+                                                      ? int64_t(br) * dof + bc
+                                                      : int64_t(bc) * dof + br;
+                                val[at * block_nvalues + l] = static_cast<T>(
+                                    weights[k] * ((br == bc) ? 1.0 : off_diagonal));
+                            }
+                        }
+                        ++at;
+                    }
+                    else
+                    {
+                        for(J c = 0; c < dof; ++c)
+                        {
+                            ind[at] = static_cast<J>(cols[k] * dof + c + base);
+                            val[at] = static_cast<T>(weights[k] * ((r == c) ? 1.0 : off_diagonal));
+                            ++at;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_stencil(std::vector<I>&                   row_ptr,
+                                std::vector<J>&                   col_ind,
+                                std::vector<T>&                   val,
+                                J&                                M,
+                                J&                                N,
+                                I&                                nnz,
+                                rocsparse_index_base              base,
+                                int32_t                           dim_x,
+                                int32_t                           dim_y,
+                                int32_t                           dim_z,
+                                int32_t                           points,
+                                J                                 dof,
+                                rocsparse_matrix_stencil_boundary boundary,
+                                double                            ax,
+                                double                            ay,
+                                double                            az)
+{
+    rocsparse_init_stencil(row_ptr,
+                           col_ind,
+                           val,
+                           false,
+                           rocsparse_direction_row,
+                           M,
+                           nnz,
+                           base,
+                           dim_x,
+                           dim_y,
+                           dim_z,
+                           points,
+                           dof,
+                           boundary,
+                           ax,
+                           ay,
+                           az);
+    N = M;
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_stencil(std::vector<I>&                   row_ind,
+                                std::vector<I>&                   col_ind,
+                                std::vector<T>&                   val,
+                                I&                                M,
+                                I&                                N,
+                                int64_t&                          nnz,
+                                rocsparse_index_base              base,
+                                int32_t                           dim_x,
+                                int32_t                           dim_y,
+                                int32_t                           dim_z,
+                                int32_t                           points,
+                                I                                 dof,
+                                rocsparse_matrix_stencil_boundary boundary,
+                                double                            ax,
+                                double                            ay,
+                                double                            az)
+{
+    std::vector<int64_t> row_ptr;
+    rocsparse_init_csr_stencil(row_ptr,
+                               col_ind,
+                               val,
+                               M,
+                               N,
+                               nnz,
+                               base,
+                               dim_x,
+                               dim_y,
+                               dim_z,
+                               points,
+                               dof,
+                               boundary,
+                               ax,
+                               ay,
+                               az);
+
+    row_ind.resize(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        for(int64_t k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in GEBSR format, the blocks are the dense
+ *  dof x dof blocks of the nodes */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_stencil(std::vector<I>&                   row_ptr,
+                                  std::vector<J>&                   col_ind,
+                                  std::vector<T>&                   val,
+                                  rocsparse_direction               dirb,
+                                  J&                                Mb,
+                                  J&                                Nb,
+                                  I&                                nnzb,
+                                  J&                                row_block_dim,
+                                  J&                                col_block_dim,
+                                  rocsparse_index_base              base,
+                                  int32_t                           dim_x,
+                                  int32_t                           dim_y,
+                                  int32_t                           dim_z,
+                                  int32_t                           points,
+                                  J                                 dof,
+                                  rocsparse_matrix_stencil_boundary boundary,
+                                  double                            ax,
+                                  double                            ay,
+                                  double                            az)
+{
+    rocsparse_init_stencil(row_ptr,
+                           col_ind,
+                           val,
+                           true,
+                           dirb,
+                           Mb,
+                           nnzb,
+                           base,
+                           dim_x,
+                           dim_y,
+                           dim_z,
+                           points,
+                           dof,
+                           boundary,
+                           ax,
+                           ay,
+                           az);
+    Nb            = Mb;
+    row_block_dim = dof;
+    col_block_dim = dof;
+}
+
+#define INSTANTIATEI(TYPE)                    \
+    template void rocsparse_init_index<TYPE>( \
+        std::vector<TYPE> & x, size_t nnz, size_t start, size_t end);
+
+#define INSTANTIATE(TYPE)                                                                          \
+    template void rocsparse_init<TYPE>(TYPE * A,                                                   \
+                                       size_t M,                                                   \
+                                       size_t N,                                                   \
+                                       size_t lda,                                                 \
+                                       size_t stride,                                              \
+                                       size_t batch_count = 1,                                     \
+                                       TYPE   a           = static_cast<TYPE>(0),                  \
+                                       TYPE   b           = static_cast<TYPE>(1));                             \
+    template void rocsparse_init_exact<TYPE>(TYPE * A,                                             \
+                                             size_t M,                                             \
+                                             size_t N,                                             \
+                                             size_t lda,                                           \
+                                             size_t stride,                                        \
+                                             size_t batch_count,                                   \
+                                             int    a = 1,                                         \
+                                             int    b = 10);                                          \
+    template void rocsparse_init<TYPE>(std::vector<TYPE> & A,                                      \
+                                       size_t M,                                                   \
+                                       size_t N,                                                   \
+                                       size_t lda,                                                 \
+                                       size_t stride,                                              \
+                                       size_t batch_count = 1,                                     \
+                                       TYPE   a           = static_cast<TYPE>(0),                  \
+                                       TYPE   b           = static_cast<TYPE>(1));                             \
+    template void rocsparse_init_exact<TYPE>(std::vector<TYPE> & A,                                \
+                                             size_t M,                                             \
+                                             size_t N,                                             \
+                                             size_t lda,                                           \
+                                             size_t stride,                                        \
+                                             size_t batch_count,                                   \
+                                             int    a = 1,                                         \
+                                             int    b = 10);                                          \
+    template void rocsparse_init_alternating_sign<TYPE>(                                           \
+        std::vector<TYPE> & A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count); \
+    template void rocsparse_init_nan<TYPE>(TYPE * A, size_t N);                                    \
+    template void rocsparse_init_nan<TYPE>(std::vector<TYPE> & A,                                  \
+                                           size_t M,                                               \
+                                           size_t N,                                               \
+                                           size_t lda,                                             \
+                                           size_t stride = 0,                                      \
+                                           size_t batch_count);
+
+#define INSTANTIATE2(ITYPE, TTYPE)                                                              \
+    template void rocsparse_init_coo_tridiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,    \
+                                                               std::vector<ITYPE> & col_ind,    \
+                                                               std::vector<TTYPE> & val,        \
+                                                               ITYPE M,                         \
+                                                               ITYPE N,                         \
+                                                               int64_t & nnz,                   \
+                                                               rocsparse_index_base base,       \
+                                                               ITYPE                l,          \
+                                                               ITYPE                u);                        \
+    template void rocsparse_init_coo_pentadiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,  \
+                                                                 std::vector<ITYPE> & col_ind,  \
+                                                                 std::vector<TTYPE> & val,      \
+                                                                 ITYPE M,                       \
+                                                                 ITYPE N,                       \
+                                                                 int64_t & nnz,                 \
+                                                                 rocsparse_index_base base,     \
+                                                                 ITYPE                ll,       \
+                                                                 ITYPE                l,        \
+                                                                 ITYPE                u,        \
+                                                                 ITYPE                uu);                     \
+    template void rocsparse_init_coo_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
+                                                             std::vector<ITYPE> & col_ind,      \
+                                                             std::vector<TTYPE> & val,          \
+                                                             int32_t dim_x,                     \
+                                                             int32_t dim_y,                     \
+                                                             ITYPE & M,                         \
+                                                             ITYPE & N,                         \
+                                                             int64_t & nnz,                     \
+                                                             rocsparse_index_base base);        \
+    template void rocsparse_init_ell_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & col_ind,      \
+                                                             std::vector<TTYPE> & val,          \
+                                                             int32_t dim_x,                     \
+                                                             int32_t dim_y,                     \
+                                                             ITYPE & M,                         \
+                                                             ITYPE & N,                         \
+                                                             ITYPE & width,                     \
+                                                             rocsparse_index_base base);        \
+    template void rocsparse_init_coo_matrix<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,         \
+                                                          std::vector<ITYPE> & col_ind,         \
+                                                          std::vector<TTYPE> & val,             \
+                                                          ITYPE                M,               \
+                                                          ITYPE                N,               \
+                                                          int64_t              nnz,             \
+                                                          rocsparse_index_base base,            \
+                                                          bool                 full_rank,       \
+                                                          bool                 to_int);                         \
+    template void rocsparse_init_coo_laplace3d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
+                                                             std::vector<ITYPE> & col_ind,      \
+                                                             std::vector<TTYPE> & val,          \
+                                                             int32_t dim_x,                     \
                                                              int32_t dim_y,                     \
                                                              int32_t dim_z,                     \
                                                              ITYPE & M,                         \
@@ -1862,7 +2922,56 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                           rocsparse_index_base       base,      \
                                                           rocsparse_matrix_init_kind init_kind, \
                                                           bool                       full_rank, \
-                                                          bool                       to_int);
+                                                          bool                       to_int);   \
+    template void rocsparse_init_coo_rmat<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,           \
+                                                        std::vector<ITYPE> & col_ind,           \
+                                                        std::vector<TTYPE> & val,               \
+                                                        ITYPE M,                                \
+                                                        ITYPE N,                                \
+                                                        int64_t & nnz,                          \
+                                                        rocsparse_index_base base,              \
+                                                        ITYPE                     edge_factor,  \
+                                                        double                    a,            \
+                                                        double                    b,            \
+                                                        double                    c,            \
+                                                        double                    d,            \
+                                                        uint64_t                  seed,         \
+                                                        bool                      full_rank,    \
+                                                        bool                      to_int);      \
+    template void rocsparse_init_coo_rowdist<ITYPE, TTYPE>(                                     \
+        std::vector<ITYPE> & row_ind,                                                           \
+        std::vector<ITYPE> & col_ind,                                                           \
+        std::vector<TTYPE> & val,                                                               \
+        ITYPE M,                                                                                \
+        ITYPE N,                                                                                \
+        int64_t & nnz,                                                                          \
+        rocsparse_index_base          base,                                                     \
+        rocsparse_matrix_rowdist_kind family,                                                   \
+        double                        mean,                                                     \
+        double                        cv,                                                       \
+        ITYPE                         max_length,                                               \
+        ITYPE                         bandwidth,                                                \
+        double                        clustering,                                               \
+        uint64_t                      seed,                                                     \
+        bool                          full_rank,                                                \
+        bool                          to_int);                                                  \
+    template void rocsparse_init_coo_stencil<ITYPE, TTYPE>(                                     \
+        std::vector<ITYPE> & row_ind,                                                           \
+        std::vector<ITYPE> & col_ind,                                                           \
+        std::vector<TTYPE> & val,                                                               \
+        ITYPE & M,                                                                              \
+        ITYPE & N,                                                                              \
+        int64_t & nnz,                                                                          \
+        rocsparse_index_base              base,                                                 \
+        int32_t                           dim_x,                                                \
+        int32_t                           dim_y,                                                \
+        int32_t                           dim_z,                                                \
+        int32_t                           points,                                               \
+        ITYPE                             dof,                                                  \
+        rocsparse_matrix_stencil_boundary boundary,                                             \
+        double                            ax,                                                   \
+        double                            ay,                                                   \
+        double                            az);
 
 #define INSTANTIATE3(ITYPE, JTYPE, TTYPE)                                                            \
     template void rocsparse_init_csr_tridiagonal<ITYPE, JTYPE, TTYPE>(                               \
@@ -1957,6 +3066,109 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         rocsparse_matrix_init_kind init_kind,                                                        \
         bool                       full_rank,                                                        \
         bool                       to_int);                                                                                \
+    template void rocsparse_init_csr_rmat<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,         \
+                                                               std::vector<JTYPE> & col_ind,         \
+                                                               std::vector<TTYPE> & val,             \
+                                                               JTYPE M,                              \
+                                                               JTYPE N,                              \
+                                                               ITYPE & nnz,                          \
+                                                               rocsparse_index_base base,            \
+                                                               JTYPE                edge_factor,     \
+                                                               double               a,               \
+                                                               double               b,               \
+                                                               double               c,               \
+                                                               double               d,               \
+                                                               uint64_t             seed,            \
+                                                               bool                 full_rank,       \
+                                                               bool                 to_int);         \
+    template void rocsparse_init_gebsr_rmat<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,       \
+                                                                 std::vector<JTYPE> & col_ind,       \
+                                                                 std::vector<TTYPE> & val,           \
+                                                                 JTYPE Mb,                           \
+                                                                 JTYPE Nb,                           \
+                                                                 ITYPE & nnzb,                       \
+                                                                 JTYPE                          row_block_dim, \
+                                                                 JTYPE                          col_block_dim, \
+                                                                 rocsparse_index_base base,          \
+                                                                 JTYPE                          edge_factor, \
+                                                                 double                         a,   \
+                                                                 double                         b,   \
+                                                                 double                         c,   \
+                                                                 double                         d,   \
+                                                                 uint64_t                       seed, \
+                                                                 bool                           to_int); \
+    template void rocsparse_init_csr_rowdist<ITYPE, JTYPE, TTYPE>(                                   \
+        std::vector<ITYPE> & row_ptr,                                                                \
+        std::vector<JTYPE> & col_ind,                                                                \
+        std::vector<TTYPE> & val,                                                                    \
+        JTYPE M,                                                                                     \
+        JTYPE N,                                                                                     \
+        ITYPE & nnz,                                                                                 \
+        rocsparse_index_base               base,                                                     \
+        rocsparse_matrix_rowdist_kind family,                                                        \
+        double                             mean,                                                     \
+        double                             cv,                                                       \
+        JTYPE                              max_length,                                               \
+        JTYPE                              bandwidth,                                                \
+        double                             clustering,                                               \
+        uint64_t                           seed,                                                     \
+        bool                               full_rank,                                                \
+        bool                               to_int);                                                  \
+    template void rocsparse_init_gebsr_rowdist<ITYPE, JTYPE, TTYPE>(                                 \
+        std::vector<ITYPE> & row_ptr,                                                                \
+        std::vector<JTYPE> & col_ind,                                                                \
+        std::vector<TTYPE> & val,                                                                    \
+        JTYPE Mb,                                                                                    \
+        JTYPE Nb,                                                                                    \
+        ITYPE & nnzb,                                                                                \
+        JTYPE                         row_block_dim,                                                 \
+        JTYPE                         col_block_dim,                                                 \
+        rocsparse_index_base          base,                                                          \
+        rocsparse_matrix_rowdist_kind family,                                                        \
+        double                        mean,                                                          \
+        double                        cv,                                                            \
+        JTYPE                         max_length,                                                    \
+        JTYPE                         bandwidth,                                                     \
+        double                        clustering,                                                    \
+        uint64_t                      seed,                                                          \
+        bool                          to_int);                                                       \
+    template void rocsparse_init_csr_stencil<ITYPE, JTYPE, TTYPE>(                                   \
+        std::vector<ITYPE> & row_ptr,                                                                \
+        std::vector<JTYPE> & col_ind,                                                                \
+        std::vector<TTYPE> & val,                                                                    \
+        JTYPE & M,                                                                                   \
+        JTYPE & N,                                                                                   \
+        ITYPE & nnz,                                                                                 \
+        rocsparse_index_base              base,                                                      \
+        int32_t                           dim_x,                                                     \
+        int32_t                           dim_y,                                                     \
+        int32_t                           dim_z,                                                     \
+        int32_t                           points,                                                    \
+        JTYPE                             dof,                                                       \
+        rocsparse_matrix_stencil_boundary boundary,                                                  \
+        double                            ax,                                                        \
+        double                            ay,                                                        \
+        double                            az);                                                       \
+    template void rocsparse_init_gebsr_stencil<ITYPE, JTYPE, TTYPE>(                                 \
+        std::vector<ITYPE> & row_ptr,                                                                \
+        std::vector<JTYPE> & col_ind,                                                                \
+        std::vector<TTYPE> & val,                                                                    \
+        rocsparse_direction dirb,                                                                    \
+        JTYPE & Mb,                                                                                  \
+        JTYPE & Nb,                                                                                  \
+        ITYPE & nnzb,                                                                                \
+        JTYPE & row_block_dim,                                                                       \
+        JTYPE & col_block_dim,                                                                       \
+        rocsparse_index_base              base,                                                      \
+        int32_t                           dim_x,                                                     \
+        int32_t                           dim_y,                                                     \
+        int32_t                           dim_z,                                                     \
+        int32_t                           points,                                                    \
+        JTYPE                             dof,                                                       \
+        rocsparse_matrix_stencil_boundary boundary,                                                  \
+        double                            ax,                                                        \
+        double                            ay,                                                        \
+        double                            az);                                                       \
     template void rocsparse_init_gebsr_tridiagonal<ITYPE, JTYPE, TTYPE>(                             \
         std::vector<ITYPE> & row_ptr,                                                                \
         std::vector<JTYPE> & col_ind,                                                                \
@@ -2096,10 +3308,6 @@ INSTANTIATE(double);
 INSTANTIATE(rocsparse_float_complex);
 INSTANTIATE(rocsparse_double_complex);
 
-INSTANTIATE1(int32_t, int32_t);
-INSTANTIATE1(int64_t, int32_t);
-INSTANTIATE1(int64_t, int64_t);
-
 INSTANTIATE2(int32_t, int8_t);
 INSTANTIATE2(int64_t, int8_t);
 INSTANTIATE2(int32_t, float);
@@ -117,6 +117,48 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
         break;
     }
 
+    case rocsparse_matrix_rmat:
+    {
+        this->m_instance = new rocsparse_matrix_factory_rmat<T, I, J>(arg.rmat_scale,
+                                                                      arg.rmat_edge_factor,
+                                                                      arg.rmat_a,
+                                                                      arg.rmat_b,
+                                                                      arg.rmat_c,
+                                                                      arg.rmat_d,
+                                                                      arg.rmat_seed,
+                                                                      full_rank,
+                                                                      to_int);
+        break;
+    }
+
+    case rocsparse_matrix_rowdist:
+    {
+        this->m_instance = new rocsparse_matrix_factory_rowdist<T, I, J>(arg.rowdist,
+                                                                         arg.rowdist_mean,
+                                                                         arg.rowdist_cv,
+                                                                         arg.rowdist_max,
+                                                                         arg.rowdist_bandwidth,
+                                                                         arg.rowdist_clustering,
+                                                                         arg.rowdist_seed,
+                                                                         full_rank,
+                                                                         to_int);
+        break;
+    }
+
+    case rocsparse_matrix_stencil:
+    {
+        this->m_instance = new rocsparse_matrix_factory_stencil<T, I, J>(arg.dimx,
+                                                                         arg.dimy,
+                                                                         arg.dimz,
+                                                                         arg.stencil_points,
+                                                                         arg.stencil_dof,
+                                                                         arg.stencil_boundary,
+                                                                         arg.stencil_ax,
+                                                                         arg.stencil_ay,
+                                                                         arg.stencil_az);
+        break;
+    }
+
     case rocsparse_matrix_file_rocalution:
     {
         std::string full_filename;
@@ -744,6 +786,19 @@ void rocsparse_matrix_factory<T, I, J>::init_bsr(host_gebsr_matrix<T, I, J>&   t
                                                  J&                            nb_,
                                                  rocsparse_index_base          base_)
 {
+    //
+    // The stencil matrices are assembled with their dof x dof blocks, without the
+    // conversion from CSR.
+    //
+    if(dynamic_cast<rocsparse_matrix_factory_stencil<T, I, J>*>(this->m_instance) != nullptr)
+    {
+        I nnzb      = 0;
+        J block_dim = this->m_arg.block_dim;
+        this->init_gebsr(that_, this->m_arg.direction, mb_, nb_, nnzb, block_dim, block_dim, base_);
+        that_on_device_(that_);
+        return;
+    }
+
     traits_init_bsr<T, I, J>::init(*this, that_, that_on_device_, mb_, nb_, base_);
 }
 
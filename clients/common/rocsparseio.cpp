@@ -32,6 +32,67 @@ extern "C" rocsparseio_status rocsparseio_close(rocsparseio_handle handle)
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_set_codecs(rocsparseio_handle handle,
+                                                      rocsparseio_codec  index_codec,
+                                                      rocsparseio_codec  value_codec)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::set_codecs(handle, index_codec, value_codec));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_set_io_engine(rocsparseio_handle handle,
+                                                         uint64_t           chunk_size,
+                                                         uint64_t           queue_depth)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::set_io_engine(handle, chunk_size, queue_depth));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_archive_set_name(rocsparseio_handle handle,
+                                                            const char*        name)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!name, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::archive_set_name(handle, name));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_archive_get_size(rocsparseio_handle handle,
+                                                            uint64_t*          nentries)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!nentries, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::archive_get_size(handle, nentries));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_archive_get_entry(rocsparseio_handle  handle,
+                                                             uint64_t            index,
+                                                             const char**        name,
+                                                             rocsparseio_format* format,
+                                                             uint64_t*           nbytes)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    rocsparseio::format_t f;
+    ROCSPARSEIO_C_CHECK(rocsparseio::archive_get_entry(handle, index, name, &f, nbytes));
+    if(format != nullptr)
+    {
+        format[0] = (rocsparseio_format)f;
+    }
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_archive_seek(rocsparseio_handle handle,
+                                                        const char*        name)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!name, rocsparseio_status_invalid_pointer);
+    // No check message, an unknown name is a regular lookup miss.
+    return (rocsparseio_status)rocsparseio::archive_seek(handle, name);
+}
+
 extern "C" rocsparseio_status rocsparseio_read_format(rocsparseio_handle  handle,
                                                       rocsparseio_format* format)
 {
@@ -277,6 +338,18 @@ extern "C" rocsparseio_status rocsparseiox_read_sparse_coo(rocsparseio_handle ha
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_map_sparse_coo(rocsparseio_handle handle,
+                                                          const void**       row_ind,
+                                                          const void**       col_ind,
+                                                          const void**       val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == row_ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == col_ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == val, rocsparseio::status_t::invalid_pointer);
+    return (rocsparseio_status)rocsparseio::map_sparse_coo(handle, row_ind, col_ind, val);
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_coo(rocsparseio_handle handle,
                                                           uint64_t*          m,
                                                           uint64_t*          n,
@@ -425,6 +498,126 @@ extern "C" rocsparseio_status
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_map_sparse_csx(rocsparseio_handle handle,
+                                                          const void**       ptr,
+                                                          const void**       ind,
+                                                          const void**       val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == val, rocsparseio::status_t::invalid_pointer);
+    // No check message, a misaligned section is recoverable with rocsparseiox_read_sparse_csx.
+    return (rocsparseio_status)rocsparseio::map_sparse_csx(handle, ptr, ind, val);
+}
+
+extern "C" rocsparseio_status rocsparseiox_read_metadata_sparse_csx_rows(rocsparseio_handle handle,
+                                                                         uint64_t           r0,
+                                                                         uint64_t           r1,
+                                                                         uint64_t*          nnz)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == nnz, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_metadata_sparse_csx_rows(handle, r0, r1, nnz));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_read_sparse_csx_rows(
+    rocsparseio_handle handle, uint64_t r0, uint64_t r1, void* ptr, void* ind, void* val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == val, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_sparse_csx_rows(handle, r0, r1, ptr, ind, val));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status
+    rocsparseiox_stream_sparse_csx_begin(rocsparseio_handle     handle,
+                                         rocsparseio_direction  dir,
+                                         uint64_t               m,
+                                         uint64_t               n,
+                                         rocsparseio_type       ptr_type,
+                                         rocsparseio_type       ind_type,
+                                         rocsparseio_type       val_type,
+                                         rocsparseio_index_base base,
+                                         uint64_t               buffer_size)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_csx_begin(
+        handle, dir, m, n, ptr_type, ind_type, val_type, base, buffer_size));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_stream_sparse_csx_rows(rocsparseio_handle handle,
+                                                                  uint64_t           nrows,
+                                                                  const void*        ptr,
+                                                                  const void*        ind,
+                                                                  const void*        val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_rows(handle, nrows, ptr, ind, val));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_stream_sparse_csx_end(rocsparseio_handle handle)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_end(handle));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status
+    rocsparseiox_stream_sparse_gebsx_begin(rocsparseio_handle     handle,
+                                           rocsparseio_direction  dir,
+                                           rocsparseio_direction  dirb,
+                                           uint64_t               mb,
+                                           uint64_t               nb,
+                                           uint64_t               row_block_dim,
+                                           uint64_t               col_block_dim,
+                                           rocsparseio_type       ptr_type,
+                                           rocsparseio_type       ind_type,
+                                           rocsparseio_type       val_type,
+                                           rocsparseio_index_base base,
+                                           uint64_t               buffer_size)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_gebsx_begin(handle,
+                                                               dir,
+                                                               dirb,
+                                                               mb,
+                                                               nb,
+                                                               row_block_dim,
+                                                               col_block_dim,
+                                                               ptr_type,
+                                                               ind_type,
+                                                               val_type,
+                                                               base,
+                                                               buffer_size));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_stream_sparse_gebsx_rows(rocsparseio_handle handle,
+                                                                    uint64_t           nrowsb,
+                                                                    const void*        ptr,
+                                                                    const void*        ind,
+                                                                    const void*        val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_rows(handle, nrowsb, ptr, ind, val));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_stream_sparse_gebsx_end(rocsparseio_handle handle)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::stream_sparse_end(handle));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_csx(rocsparseio_handle     handle,
                                                           rocsparseio_direction* dir_,
                                                           uint64_t*              m,
@@ -624,6 +817,41 @@ extern "C" rocsparseio_status
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_map_sparse_gebsx(rocsparseio_handle handle,
+                                                            const void**       ptr,
+                                                            const void**       ind,
+                                                            const void**       val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == val, rocsparseio::status_t::invalid_pointer);
+    return (rocsparseio_status)rocsparseio::map_sparse_gebsx(handle, ptr, ind, val);
+}
+
+extern "C" rocsparseio_status
+    rocsparseiox_read_metadata_sparse_gebsx_rows(rocsparseio_handle handle,
+                                                 uint64_t           r0,
+                                                 uint64_t           r1,
+                                                 uint64_t*          nnzb)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == nnzb, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_metadata_sparse_gebsx_rows(handle, r0, r1, nnzb));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_read_sparse_gebsx_rows(
+    rocsparseio_handle handle, uint64_t r0, uint64_t r1, void* ptr, void* ind, void* val)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ptr, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == ind, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(nullptr == val, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::read_sparse_gebsx_rows(handle, r0, r1, ptr, ind, val));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_gebsx(rocsparseio_handle handle,
 
                                                             rocsparseio_direction* dir,
@@ -23,12 +23,22 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifndef WIN32
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #define ROCSPARSEIO_CHECK(_todo)                                                                \
     {                                                                                           \
@@ -493,6 +503,124 @@ namespace rocsparseio
         }
     };
 
+    //!
+    //! @brief c++11 struct for codec enum.
+    //!
+    struct codec_t
+    {
+        typedef enum value_type_ : rocsparseio_codec_t
+        {
+            none         = rocsparseio_codec_none,
+            delta_varint = rocsparseio_codec_delta_varint,
+            byte_shuffle = rocsparseio_codec_byte_shuffle
+        } value_type;
+
+        value_type       value{};
+        inline constexpr operator value_type() const
+        {
+            return this->value;
+        };
+        inline explicit constexpr operator rocsparseio_codec() const
+        {
+            return (rocsparseio_codec)this->value;
+        };
+        constexpr codec_t(){};
+        constexpr codec_t(rocsparseio_codec_t ival)
+            : value((value_type)ival){};
+
+        inline bool is_invalid() const
+        {
+            switch(this->value)
+            {
+            case none:
+            case delta_varint:
+            case byte_shuffle:
+            {
+                return false;
+            }
+            }
+            return true;
+        };
+
+        inline const char* to_string() const
+        {
+            switch(this->value)
+            {
+#define CASE(case_name)    \
+    case case_name:        \
+    {                      \
+        return #case_name; \
+    }
+                CASE(none);
+                CASE(delta_varint);
+                CASE(byte_shuffle);
+#undef CASE
+            }
+            return "unknown";
+        }
+    };
+
+    //!
+    //! @brief Layout revisions of a file, see ROCSPARSEIO_VERSION_MINOR.
+    //!
+    typedef enum layout_revision_
+    {
+        layout_revision_packed  = 0,
+        layout_revision_aligned = 1,
+        layout_revision_codec   = 2,
+        layout_revision_archive = 3
+    } layout_revision;
+
+    //!
+    //! @brief Configuration of the transfers of large array sections, split into chunks of
+    //! \p chunk_size bytes serviced by up to \p queue_depth threads with positioned reads and
+    //! writes. A queue depth of one uses the stdio stream.
+    //!
+    struct engine_t
+    {
+        uint64_t chunk_size{ROCSPARSEIO_IO_CHUNK_SIZE};
+        uint64_t queue_depth{1};
+    };
+
+    //!
+    //! @brief State of a sparse matrix written by batches of rows (or block rows).
+    //! @note The array of offsets is reserved in the file and filled by blocks staged in
+    //! \p buffer, indices are appended to the file and values to a spool file, which is
+    //! copied after the indices once the last row is received.
+    //!
+    struct stream_t
+    {
+        bool              active{};
+        uint64_t          m{};
+        uint64_t          nrows{};
+        uint64_t          nnz{};
+        uint64_t          block_nmemb{1};
+        uint64_t          base{};
+        type_t            ptr_type{};
+        type_t            ind_type{};
+        type_t            data_type{};
+        long              nnz_pos{};
+        long              ptr_pos{};
+        long              ind_nmemb_pos{};
+        long              end_pos{};
+        uint64_t          ptr_nflushed{};
+        uint64_t          ptr_nstaged{};
+        std::vector<char> buffer{};
+        FILE*             spool{};
+        std::string       spool_name{};
+    };
+
+    //!
+    //! @brief Entry of the table of contents of an archive.
+    //!
+    struct entry_t
+    {
+        std::string name{};
+        format_t    format{};
+        uint64_t    offset{};
+        uint64_t    nbytes{};
+    };
+
     //!
     //! @brief c++11 struct for rwmode enum.
     //!
@@ -500,8 +628,10 @@ namespace rocsparseio
     {
         typedef enum value_type_ : rocsparseio_rwmode_t
         {
-            read  = rocsparseio_rwmode_read,
-            write = rocsparseio_rwmode_write
+            read          = rocsparseio_rwmode_read,
+            write         = rocsparseio_rwmode_write,
+            read_mmap     = rocsparseio_rwmode_read_mmap,
+            write_aligned = rocsparseio_rwmode_write_aligned
         } value_type;
 
         value_type value;
@@ -521,6 +651,8 @@ namespace rocsparseio
             {
             case read:
             case write:
+            case read_mmap:
+            case write_aligned:
             {
                 return false;
             }
@@ -539,6 +671,8 @@ namespace rocsparseio
     }
                 CASE(read);
                 CASE(write);
+                CASE(read_mmap);
+                CASE(write_aligned);
 #undef CASE
             }
             return "unknown";
@@ -581,6 +715,12 @@ namespace rocsparseio
         return os;
     }
 
+    inline std::ostream& operator<<(std::ostream& os, const codec_t& that_)
+    {
+        os << that_.to_string();
+        return os;
+    }
+
 } // namespace rocsparseio
 
 struct _rocsparseio_handle
@@ -588,6 +728,24 @@ struct _rocsparseio_handle
     rocsparseio::rwmode_t mode;
     std::string           filename{};
     FILE*                 f{};
+    uint64_t              alignment{1};
+    rocsparseio::codec_t  index_codec{};
+    rocsparseio::codec_t  value_codec{};
+    rocsparseio::engine_t engine{};
+    rocsparseio::stream_t stream{};
+    const char*           map{};
+    uint64_t              map_size{};
+
+    rocsparseio::layout_revision revision{rocsparseio::layout_revision_packed};
+
+    //
+    // Table of contents of an archive, and name of the next object to write.
+    //
+    std::vector<rocsparseio::entry_t>         entries{};
+    std::unordered_map<std::string, uint64_t> entry_index{};
+    std::string                               entry_name{};
+    bool                                      entry_open{};
+
     _rocsparseio_handle(rocsparseio::rwmode_t mode_, const char* filename_)
         : mode(mode_)
         , filename(filename_)
@@ -688,6 +846,17 @@ namespace rocsparseio
         return status_t::success;
     }
 
+    template <typename source>
+    inline status_t convert_scalar(const source& s, index_base_t& t)
+    {
+        t = static_cast<index_base_t>(s);
+        if(t.is_invalid())
+        {
+            return status_t::invalid_value;
+        }
+        return status_t::success;
+    }
+
     template <typename T, typename J>
     inline status_t fwrite_scalar(J scalar_, FILE* out_)
     {
@@ -735,696 +904,2531 @@ namespace rocsparseio
         return status_t::success;
     };
 
-    inline status_t fwrite_array(FILE* out_, uint64_t size_, uint64_t nmemb_, const void* data_)
+    //!
+    //! @brief Number of padding bytes from the position \p pos_ to the next multiple of
+    //! \p alignment_.
+    //!
+    inline uint64_t padding_size(uint64_t pos_, uint64_t alignment_)
     {
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(size_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nmemb_, out_));
-        if(nmemb_ != fwrite(data_, size_, nmemb_, out_))
-        {
-            return status_t::invalid_file_operation;
-        }
-        return status_t::success;
+        return (alignment_ > 1) ? (alignment_ - pos_ % alignment_) % alignment_ : 0;
     }
 
-    inline status_t fread_array(FILE* in_, void* data_)
+    inline status_t fwrite_padding(FILE* out_, uint64_t alignment_)
     {
-        uint64_t size;
-        uint64_t nmemb;
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
-        if(nmemb != fread(data_, size, nmemb, in_))
+        if(alignment_ > 1)
         {
-            return status_t::invalid_file_operation;
+            static const char zeros[ROCSPARSEIO_ALIGNMENT]{};
+            const long        pos = ftell(out_);
+            if(pos < 0 || alignment_ > ROCSPARSEIO_ALIGNMENT)
+            {
+                return status_t::invalid_file_operation;
+            }
+            const uint64_t npad = padding_size(pos, alignment_);
+            if(npad != fwrite(zeros, 1, npad, out_))
+            {
+                return status_t::invalid_file_operation;
+            }
         }
         return status_t::success;
     }
 
-    inline status_t fread_array_metadata(FILE* in_, uint64_t* size_, uint64_t* nmemb_)
+    inline status_t fread_padding(FILE* in_, uint64_t alignment_)
     {
-        long pos = ftell(in_);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb_, in_));
-        if(0 != fseek(in_, pos, SEEK_SET))
+        if(alignment_ > 1)
         {
-            return status_t::invalid_file_operation;
+            const long pos = ftell(in_);
+            if(pos < 0)
+            {
+                return status_t::invalid_file_operation;
+            }
+            const uint64_t npad = padding_size(pos, alignment_);
+            if(npad > 0 && 0 != fseek(in_, npad, SEEK_CUR))
+            {
+                return status_t::invalid_file_operation;
+            }
         }
         return status_t::success;
     }
 
-} // namespace rocsparseio
-
-namespace rocsparseio
-{
-
-    //
-    // ////////////////////////////////////////////////
-    //
-    inline status_t fwrite_dense_vector(
-        FILE* out_, type_t data_type_, uint64_t data_nmemb_, const void* data_, uint64_t data_inc_)
+    //!
+    //! @brief Transfer \p nbytes_ bytes at the current position of a stream, and move the
+    //! position past them.
+    //! @note Transfers larger than one chunk are split into chunks read or written in parallel
+    //! with pread / pwrite on the file descriptor of the stream, the stream is flushed before
+    //! and repositioned after, such that the bytes of the file are the same as with stdio.
+    //!
+    inline status_t
+        ftransfer(FILE* f_, bool write_, void* data_, uint64_t nbytes_, const engine_t& engine_)
     {
-
-        ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
-
-        ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
-
-        ROCSPARSEIO_CHECK_ARG(((data_nmemb_ > 0) && (data_ == nullptr)), status_t::invalid_pointer);
-        ROCSPARSEIO_CHECK_ARG(((data_inc_ > 0) && (data_ == nullptr)), status_t::invalid_size);
-
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
-        uint64_t data_size = data_type_.size();
-        if(data_inc_ == 1)
+#ifndef WIN32
+        if(engine_.queue_depth > 1 && engine_.chunk_size > 0 && nbytes_ > engine_.chunk_size)
         {
-            if(data_nmemb_ != fwrite(data_, data_size, data_nmemb_, out_))
+            const long pos = ftell(f_);
+            if(pos < 0 || (write_ && 0 != fflush(f_)))
             {
                 return status_t::invalid_file_operation;
             }
-        }
-        else
-        {
-            for(uint64_t i = 0; i < data_nmemb_; ++i)
+
+            const int      fd          = fileno(f_);
+            const uint64_t chunk_size  = engine_.chunk_size;
+            const uint64_t nchunks     = (nbytes_ + chunk_size - 1) / chunk_size;
+            const int      num_threads = (int)std::min(engine_.queue_depth, nchunks);
+            std::vector<char> chunk_valid(nchunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+#endif
+            for(uint64_t c = 0; c < nchunks; ++c)
             {
-                if(1
-                   != fwrite(((const char*)data_) + i * data_inc_ * data_size, data_size, 1, out_))
+                const uint64_t first = c * chunk_size;
+                const uint64_t n     = std::min(chunk_size, nbytes_ - first);
+                char*          p     = ((char*)data_) + first;
+                uint64_t       done  = 0;
+                while(done < n)
+                {
+                    const ssize_t k
+                        = write_ ? pwrite(fd, p + done, n - done, pos + first + done)
+                                 : pread(fd, p + done, n - done, pos + first + done);
+                    if(k < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if(k <= 0)
+                    {
+                        break;
+                    }
+                    done += k;
+                }
+                chunk_valid[c] = (done == n);
+            }
+            (void)num_threads;
+
+            for(uint64_t c = 0; c < nchunks; ++c)
+            {
+                if(!chunk_valid[c])
                 {
                     return status_t::invalid_file_operation;
                 }
             }
+            if(0 != fseek(f_, pos + nbytes_, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            return status_t::success;
         }
-        return status_t::success;
-    }
-
-    inline status_t fread_format(FILE* in, format_t* format)
-    {
-        ROCSPARSEIO_CHECK_ARG(in == nullptr, status_t::invalid_pointer);
-        ROCSPARSEIO_CHECK_ARG(format == nullptr, status_t::invalid_pointer);
-        long pos = ftell(in);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in));
-        if(0 != fseek(in, pos, SEEK_SET))
+#endif
+        const uint64_t n = write_ ? fwrite(data_, 1, nbytes_, f_) : fread(data_, 1, nbytes_, f_);
+        if(n != nbytes_)
         {
             return status_t::invalid_file_operation;
         }
         return status_t::success;
-    };
+    }
 
-    inline status_t fread_metadata_dense_vector(FILE* in, type_t* type, uint64_t* nmemb)
+    inline status_t
+        fwrite_bulk(FILE* out_, const void* data_, uint64_t nbytes_, const engine_t& engine_)
     {
-        ROCSPARSEIO_CHECK_ARG(in == nullptr, status_t::invalid_pointer);
-        ROCSPARSEIO_CHECK_ARG(type == nullptr, status_t::invalid_pointer);
-        ROCSPARSEIO_CHECK_ARG(nmemb == nullptr, status_t::invalid_pointer);
-        long     pos = ftell(in);
-        format_t format(0);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in));
-        if(format != format_t::dense_vector)
+        return ftransfer(out_, true, (void*)data_, nbytes_, engine_);
+    }
+
+    inline status_t fread_bulk(FILE* in_, void* data_, uint64_t nbytes_, const engine_t& engine_)
+    {
+        return ftransfer(in_, false, data_, nbytes_, engine_);
+    }
+
+    //
+    // Codecs of array sections.
+    //
+    inline uint64_t codec_zigzag(uint64_t delta_)
+    {
+        return (delta_ << 1) ^ (uint64_t)((int64_t)delta_ >> 63);
+    }
+
+    inline uint64_t codec_unzigzag(uint64_t u_)
+    {
+        return (u_ >> 1) ^ (0 - (u_ & 1));
+    }
+
+    inline uint64_t codec_varint_size(uint64_t u_)
+    {
+        uint64_t n = 1;
+        while(u_ >= 0x80)
         {
-            std::cerr << " wrong format, not flagged as a dense_vector. " << std::endl;
-            return status_t::invalid_format;
+            u_ >>= 7;
+            ++n;
         }
+        return n;
+    }
 
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in));
-        if(0 != fseek(in, pos, SEEK_SET))
+    inline void codec_put_varint(uint64_t u_, std::vector<unsigned char>& out_)
+    {
+        while(u_ >= 0x80)
         {
-            return status_t::invalid_file_operation;
+            out_.push_back((unsigned char)(u_ | 0x80));
+            u_ >>= 7;
         }
-        return status_t::success;
-    };
+        out_.push_back((unsigned char)u_);
+    }
 
-    inline status_t fread_dense_vector(FILE* in_, void* data_, uint64_t inc_)
+    inline bool
+        codec_get_varint(const unsigned char* in_, uint64_t in_size_, uint64_t* k_, uint64_t* u_)
     {
-        if(0 != fseek(in_, sizeof(uint64_t), SEEK_CUR))
+        uint64_t u = 0;
+        for(uint64_t shift = 0; shift < 64; shift += 7)
         {
-            return status_t::invalid_file_operation;
+            if(k_[0] >= in_size_)
+            {
+                return false;
+            }
+            const unsigned char b = in_[k_[0]++];
+            u |= ((uint64_t)(b & 0x7f)) << shift;
+            if(!(b & 0x80))
+            {
+                u_[0] = u;
+                return true;
+            }
         }
-        type_t type;
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in_));
-        uint64_t size = type.size();
-        uint64_t nmemb;
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
-        if(inc_ == 1)
+        return false;
+    }
+
+    //!
+    //! @brief Delta encoding of integers, the differences of consecutive elements are stored
+    //! as zigzag varints. The first element of a chunk is a difference to zero.
+    //!
+    template <typename T>
+    inline void
+        codec_encode_delta_varint(uint64_t n_, const T* data_, std::vector<unsigned char>& out_)
+    {
+        uint64_t prev = 0;
+        for(uint64_t i = 0; i < n_; ++i)
         {
-            return fread_data(in_, size, nmemb, data_);
+            const uint64_t v = (uint64_t)(int64_t)data_[i];
+            codec_put_varint(codec_zigzag(v - prev), out_);
+            prev = v;
         }
-        else
+    }
+
+    template <typename T>
+    inline bool codec_decode_delta_varint(uint64_t             n_,
+                                          const unsigned char* in_,
+                                          uint64_t             in_size_,
+                                          T*                   data_)
+    {
+        uint64_t prev = 0;
+        uint64_t k    = 0;
+        for(uint64_t i = 0; i < n_; ++i)
         {
-            void* buff = malloc(size * nmemb);
-            ROCSPARSEIO_CHECK(fread_data(in_, size, nmemb, buff));
-            uint64_t j = 0;
-            for(uint64_t i = 0; i < nmemb; ++i)
+            uint64_t u;
+            if(!codec_get_varint(in_, in_size_, &k, &u))
             {
-                memcpy(((char*)data_) + j * size, ((char*)buff) + i * size, size);
-                j += inc_;
+                return false;
             }
-            free(buff);
-            return status_t::invalid_value;
+            prev += codec_unzigzag(u);
+            data_[i] = (T)(int64_t)prev;
         }
+        return k == in_size_;
     }
 
-} // namespace rocsparseio
-
-namespace rocsparseio
-{
-
-    inline status_t fwrite_dense_matrix(FILE*       out_,
-                                        order_t     order_,
-                                        uint64_t    m_,
-                                        uint64_t    n_,
-                                        type_t      data_type_,
-                                        const void* data_,
-                                        uint64_t    data_ld_)
+    //!
+    //! @brief Byte plane encoding, byte k of all the elements forms the plane k. A plane is
+    //! stored with a tag, either as a constant, as runs (varint length, byte) or raw.
+    //! With IEEE values, the planes of the sign and exponent bytes are separated from the
+    //! mantissa and compress well.
+    //!
+    typedef enum codec_plane_
     {
-        ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
-
-        ROCSPARSEIO_CHECK_ARG(order_.is_invalid(), status_t::invalid_value);
-
-        ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
-
-        ROCSPARSEIO_CHECK_ARG((((m_ > 0) && (n_ > 0)) && (data_ == nullptr)),
-                              status_t::invalid_pointer);
+        codec_plane_raw      = 0,
+        codec_plane_constant = 1,
+        codec_plane_runs     = 2
+    } codec_plane;
 
-        ROCSPARSEIO_CHECK_ARG((((m_ > 0) && (n_ > 0)) && (data_ == nullptr)),
-                              status_t::invalid_pointer);
+    inline void codec_encode_byte_shuffle(uint64_t                    n_,
+                                          uint64_t                    size_,
+                                          const unsigned char*        data_,
+                                          std::vector<unsigned char>& out_)
+    {
+        for(uint64_t k = 0; k < size_; ++k)
+        {
+            uint64_t nruns      = 0;
+            uint64_t runs_bytes = 0;
+            for(uint64_t i = 0; i < n_;)
+            {
+                uint64_t j = i + 1;
+                while(j < n_ && data_[j * size_ + k] == data_[i * size_ + k])
+                {
+                    ++j;
+                }
+                ++nruns;
+                runs_bytes += codec_varint_size(j - i) + 1;
+                i = j;
+            }
 
-        ROCSPARSEIO_CHECK_ARG(((order_ == order_t::row) && (data_ld_ < n_)),
-                              status_t::invalid_size);
-
-        ROCSPARSEIO_CHECK_ARG(((order_ == order_t::column) && (data_ld_ < m_)),
-                              status_t::invalid_size);
-
-        uint64_t data_nmemb = m_ * n_;
-
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_matrix, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(order_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb, out_));
-
-        uint64_t data_size = data_type_.size();
-        switch(order_)
-        {
-        case order_t::row:
-        {
-            if(data_ld_ == n_)
+            if(nruns == 1)
+            {
+                out_.push_back(codec_plane_constant);
+                out_.push_back(data_[k]);
+            }
+            else if(runs_bytes < n_)
             {
-                if(data_nmemb != fwrite(data_, data_size, data_nmemb, out_))
+                out_.push_back(codec_plane_runs);
+                for(uint64_t i = 0; i < n_;)
                 {
-                    return status_t::invalid_file_operation;
+                    uint64_t j = i + 1;
+                    while(j < n_ && data_[j * size_ + k] == data_[i * size_ + k])
+                    {
+                        ++j;
+                    }
+                    codec_put_varint(j - i, out_);
+                    out_.push_back(data_[i * size_ + k]);
+                    i = j;
                 }
             }
             else
             {
-                for(uint64_t i = 0; i < m_; ++i)
+                out_.push_back(codec_plane_raw);
+                for(uint64_t i = 0; i < n_; ++i)
                 {
-                    if(n_
-                       != fwrite(
-                           ((const char*)data_) + i * data_ld_ * data_size, data_size, n_, out_))
-                    {
-                        return status_t::invalid_file_operation;
-                    }
+                    out_.push_back(data_[i * size_ + k]);
                 }
             }
-            break;
         }
+    }
 
-        case order_t::column:
+    inline bool codec_decode_byte_shuffle(uint64_t             n_,
+                                          uint64_t             size_,
+                                          const unsigned char* in_,
+                                          uint64_t             in_size_,
+                                          unsigned char*       data_)
+    {
+        uint64_t k = 0;
+        for(uint64_t plane = 0; plane < size_; ++plane)
         {
-            if(data_ld_ == m_)
+            if(k >= in_size_)
+            {
+                return false;
+            }
+            switch(in_[k++])
+            {
+            case codec_plane_constant:
             {
-                if(data_nmemb != fwrite(data_, data_size, data_nmemb, out_))
+                if(k >= in_size_)
                 {
-                    return status_t::invalid_file_operation;
+                    return false;
+                }
+                const unsigned char b = in_[k++];
+                for(uint64_t i = 0; i < n_; ++i)
+                {
+                    data_[i * size_ + plane] = b;
                 }
+                break;
             }
-            else
+            case codec_plane_runs:
             {
-                for(uint64_t j = 0; j < n_; ++j)
+                for(uint64_t i = 0; i < n_;)
                 {
-                    if(m_
-                       != fwrite(
-                           ((const char*)data_) + j * data_ld_ * data_size, data_size, m_, out_))
+                    uint64_t len;
+                    if(!codec_get_varint(in_, in_size_, &k, &len) || len > n_ - i
+                       || k >= in_size_)
                     {
-                        return status_t::invalid_file_operation;
+                        return false;
+                    }
+                    const unsigned char b = in_[k++];
+                    for(uint64_t j = 0; j < len; ++j)
+                    {
+                        data_[(i + j) * size_ + plane] = b;
                     }
+                    i += len;
                 }
+                break;
+            }
+            case codec_plane_raw:
+            {
+                if(n_ > in_size_ - k)
+                {
+                    return false;
+                }
+                for(uint64_t i = 0; i < n_; ++i)
+                {
+                    data_[i * size_ + plane] = in_[k++];
+                }
+                break;
+            }
+            default:
+            {
+                return false;
+            }
             }
-            break;
-        }
         }
-        return status_t::success;
-    };
+        return k == in_size_;
+    }
 
-    inline status_t fread_dense_matrix(FILE* in_, void* data_)
+    inline status_t codec_encode(codec_t                     codec_,
+                                 uint64_t                    size_,
+                                 uint64_t                    n_,
+                                 const void*                 data_,
+                                 std::vector<unsigned char>& out_)
     {
-        if(0 != fseek(in_, sizeof(uint64_t) * 4, SEEK_CUR))
+        out_.clear();
+        switch(codec_)
         {
-            return status_t::invalid_file_operation;
+        case codec_t::delta_varint:
+        {
+            switch(size_)
+            {
+            case sizeof(int32_t):
+            {
+                codec_encode_delta_varint(n_, (const int32_t*)data_, out_);
+                return status_t::success;
+            }
+            case sizeof(int64_t):
+            {
+                codec_encode_delta_varint(n_, (const int64_t*)data_, out_);
+                return status_t::success;
+            }
+            }
+            return status_t::invalid_value;
         }
-        type_t type;
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in_));
-        uint64_t size = type.size();
-        uint64_t nmemb;
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
-        return fread_data(in_, size, nmemb, data_);
-    }
-
-    inline status_t fread_metadata_dense_matrix(
-        FILE* in_, order_t* order_, uint64_t* m_, uint64_t* n_, type_t* type_)
-    {
-        long     pos = ftell(in_);
-        format_t format(0);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
-        if(format != format_t::dense_matrix)
+        case codec_t::byte_shuffle:
         {
-            std::cerr << " wrong format, not flagged as a dense matrix. " << std::endl;
-            return status_t::invalid_format;
+            codec_encode_byte_shuffle(n_, size_, (const unsigned char*)data_, out_);
+            return status_t::success;
         }
-
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(order_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type_, in_));
-        if(0 != fseek(in_, pos, SEEK_SET))
+        case codec_t::none:
         {
-            return status_t::invalid_file_operation;
+            break;
         }
-        return status_t::success;
+        }
+        return status_t::invalid_value;
     }
 
-} // namespace rocsparseio
-
-//
-//
-//
-namespace rocsparseio
-{
-    inline status_t fwrite_sparse_csx(FILE*       out_,
-                                      direction_t dir_,
-                                      uint64_t    m_,
-                                      uint64_t    n_,
-                                      uint64_t    nnz_,
-                                      type_t      ptr_type_,
-                                      const void* __restrict__ ptr_,
-                                      type_t ind_type_,
-                                      const void* __restrict__ ind_,
-                                      type_t data_type_,
-                                      const void* __restrict__ data_,
-                                      index_base_t base_)
+    inline bool codec_decode(codec_t              codec_,
+                             uint64_t             size_,
+                             uint64_t             n_,
+                             const unsigned char* in_,
+                             uint64_t             in_size_,
+                             void*                data_)
     {
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_csx, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
-        switch(dir_)
+        switch(codec_)
         {
-        case direction_t::row:
+        case codec_t::delta_varint:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), m_ + 1, ptr_));
-            break;
+            switch(size_)
+            {
+            case sizeof(int32_t):
+            {
+                return codec_decode_delta_varint(n_, in_, in_size_, (int32_t*)data_);
+            }
+            case sizeof(int64_t):
+            {
+                return codec_decode_delta_varint(n_, in_, in_size_, (int64_t*)data_);
+            }
+            }
+            return false;
         }
-        case direction_t::column:
+        case codec_t::byte_shuffle:
+        {
+            return codec_decode_byte_shuffle(n_, size_, in_, in_size_, (unsigned char*)data_);
+        }
+        case codec_t::none:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), n_ + 1, ptr_));
             break;
         }
         }
+        return false;
+    }
 
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), nnz_, ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, data_type_.size(), nnz_, data_));
+    //!
+    //! @brief Number of chunks encoded or decoded in parallel at once, which bounds the
+    //! temporary memory.
+    //!
+    static constexpr uint64_t codec_batch_nchunks = 64;
 
-        return status_t::success;
+    //!
+    //! @brief Location of the data of an array section in the file.
+    //! @note With a codec, the data are a table of chunk offsets followed by the chunks.
+    //!
+    struct section_t
+    {
+        uint64_t              size{};
+        uint64_t              nmemb{};
+        long                  pos{};
+        codec_t               codec{};
+        uint64_t              chunk_nmemb{};
+        std::vector<uint64_t> chunk_offsets{};
     };
 
-    inline status_t fread_metadata_sparse_csx(FILE*         in_,
-                                              direction_t*  dir_,
-                                              uint64_t*     m_,
-                                              uint64_t*     n_,
-                                              uint64_t*     nnz_,
-                                              type_t*       ptr_type,
-                                              type_t*       ind_type,
-                                              type_t*       data_type,
-                                              index_base_t* base)
-    {
-        long     pos = ftell(in_);
-        format_t format(0);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dir_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnz_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ptr_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ind_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
-        if(0 != fseek(in_, pos, SEEK_SET))
+    inline status_t fwrite_array(FILE*       out_,
+                                 uint64_t    size_,
+                                 uint64_t    nmemb_,
+                                 const void* data_,
+                                 uint64_t        alignment_ = 1,
+                                 codec_t         codec_     = codec_t::none,
+                                 const engine_t& engine_    = engine_t())
+    {
+        //
+        // The codec is stored in the high bits of the element size.
+        //
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(size_ | (((uint64_t)codec_) << 32), out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nmemb_, out_));
+        ROCSPARSEIO_CHECK(fwrite_padding(out_, alignment_));
+        if(codec_ == codec_t::none)
         {
-            return status_t::invalid_file_operation;
+            return fwrite_bulk(out_, data_, size_ * nmemb_, engine_);
         }
-        return status_t::success;
-    }
 
-    inline status_t fread_sparse_csx(FILE* in_,
-                                     void* __restrict__ ptr_,
-                                     void* __restrict__ ind_,
-                                     void* __restrict__ data_)
-    {
-        if(0 != fseek(in_, sizeof(uint64_t) * 9, SEEK_CUR))
+        const uint64_t chunk_nmemb = ROCSPARSEIO_CODEC_CHUNK_NMEMB;
+        const uint64_t nchunks     = (nmemb_ + chunk_nmemb - 1) / chunk_nmemb;
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(chunk_nmemb, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nchunks, out_));
+
+        //
+        // Reserve the table of chunk offsets, filled once the chunks are written.
+        //
+        std::vector<uint64_t> offsets(nchunks + 1, 0);
+        const long            table_pos = ftell(out_);
+        if(table_pos < 0
+           || (nchunks + 1) != fwrite(offsets.data(), sizeof(uint64_t), nchunks + 1, out_))
         {
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ptr_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
-
-        return status_t::success;
-    }
-
-} // namespace rocsparseio
+        std::vector<std::vector<unsigned char>> chunks(codec_batch_nchunks);
+        std::vector<status_t>                   chunk_status(codec_batch_nchunks);
+        for(uint64_t c0 = 0; c0 < nchunks; c0 += codec_batch_nchunks)
+        {
+            const uint64_t c1 = std::min(c0 + codec_batch_nchunks, nchunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for(uint64_t c = c0; c < c1; ++c)
+            {
+                const uint64_t first = c * chunk_nmemb;
+                const uint64_t n     = std::min(chunk_nmemb, nmemb_ - first);
+                chunk_status[c - c0] = codec_encode(
+                    codec_, size_, n, ((const char*)data_) + first * size_, chunks[c - c0]);
+            }
 
-namespace rocsparseio
-{
-    inline status_t fwrite_sparse_coo(FILE*    out_,
-                                      uint64_t m_,
-                                      uint64_t n_,
-                                      uint64_t nnz_,
-                                      type_t   row_ind_type_,
-                                      const void* __restrict__ row_ind_,
-                                      type_t col_ind_type_,
-                                      const void* __restrict__ col_ind_,
-                                      type_t data_type_,
-                                      const void* __restrict__ data_,
-                                      index_base_t base_)
-    {
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_coo, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(row_ind_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_ind_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, row_ind_type_.size(), nnz_, row_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, col_ind_type_.size(), nnz_, col_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, data_type_.size(), nnz_, data_));
-        return status_t::success;
-    };
+            for(uint64_t c = c0; c < c1; ++c)
+            {
+                ROCSPARSEIO_CHECK(chunk_status[c - c0]);
+                const std::vector<unsigned char>& chunk = chunks[c - c0];
+                ROCSPARSEIO_CHECK(fwrite_bulk(out_, chunk.data(), chunk.size(), engine_));
+                offsets[c + 1] = offsets[c] + chunk.size();
+            }
+        }
 
-    inline status_t fread_metadata_sparse_coo(FILE*         in_,
-                                              uint64_t*     m_,
-                                              uint64_t*     n_,
-                                              uint64_t*     nnz_,
-                                              type_t*       row_ind_type,
-                                              type_t*       col_ind_type,
-                                              type_t*       data_type,
-                                              index_base_t* base)
-    {
-        long     pos = ftell(in_);
-        format_t format(0);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnz_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(row_ind_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(col_ind_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
-        if(0 != fseek(in_, pos, SEEK_SET))
+        const long end_pos = ftell(out_);
+        if(end_pos < 0 || 0 != fseek(out_, table_pos, SEEK_SET)
+           || (nchunks + 1) != fwrite(offsets.data(), sizeof(uint64_t), nchunks + 1, out_)
+           || 0 != fseek(out_, end_pos, SEEK_SET))
         {
             return status_t::invalid_file_operation;
         }
         return status_t::success;
     }
 
-    inline status_t fread_sparse_coo(FILE* in_,
-                                     void* __restrict__ row_ind_,
-                                     void* __restrict__ col_ind_,
-                                     void* __restrict__ data_)
+    //!
+    //! @brief Read the header of the array section at the current position, the file
+    //! position is moved to the data of the section.
+    //!
+    inline status_t fread_array_header(FILE* in_, section_t* section_, uint64_t alignment_)
     {
-        if(0 != fseek(in_, sizeof(uint64_t) * 8, SEEK_CUR))
+        uint64_t size;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(section_->nmemb, in_));
+        ROCSPARSEIO_CHECK(fread_padding(in_, alignment_));
+        section_->size  = size & 0xffffffff;
+        section_->codec = (rocsparseio_codec_t)(size >> 32);
+        if(section_->codec.is_invalid())
         {
-            return status_t::invalid_file_operation;
+            return status_t::invalid_format;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, row_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, col_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
+        if(section_->codec != codec_t::none)
+        {
+            uint64_t nchunks;
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(section_->chunk_nmemb, in_));
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nchunks, in_));
+            if(section_->chunk_nmemb == 0
+               || nchunks != (section_->nmemb + section_->chunk_nmemb - 1) / section_->chunk_nmemb)
+            {
+                return status_t::invalid_format;
+            }
+            section_->chunk_offsets.resize(nchunks + 1);
+            ROCSPARSEIO_CHECK(
+                fread_data(in_, sizeof(uint64_t), nchunks + 1, section_->chunk_offsets.data()));
+        }
 
+        section_->pos = ftell(in_);
+        if(section_->pos < 0)
+        {
+            return status_t::invalid_file_operation;
+        }
         return status_t::success;
     }
 
-} // namespace rocsparseio
-
-namespace rocsparseio
-{
+    //!
+    //! @brief Read and decode the chunks [\p c0_, \p c1_) of an encoded array section into
+    //! \p data_, chunks being decoded in parallel.
+    //!
+    inline status_t fread_section_chunks(FILE*            in_,
+                                         const section_t& section_,
+                                         uint64_t         c0_,
+                                         uint64_t         c1_,
+                                         void*            data_,
+                                         const engine_t&  engine_ = engine_t())
+    {
+        const uint64_t             chunk_nmemb = section_.chunk_nmemb;
+        const uint64_t*            offsets     = section_.chunk_offsets.data();
+        std::vector<unsigned char> buffer;
+        std::vector<char>          chunk_valid(codec_batch_nchunks);
+        for(uint64_t b0 = c0_; b0 < c1_; b0 += codec_batch_nchunks)
+        {
+            const uint64_t b1 = std::min(b0 + codec_batch_nchunks, c1_);
+            if(offsets[b1] < offsets[b0])
+            {
+                return status_t::invalid_format;
+            }
+            buffer.resize(offsets[b1] - offsets[b0]);
+            if(0 != fseek(in_, section_.pos + offsets[b0], SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            ROCSPARSEIO_CHECK(fread_bulk(in_, buffer.data(), buffer.size(), engine_));
 
-    inline status_t fwrite_sparse_gebsx(FILE*       out_,
-                                        direction_t dir_,
-                                        direction_t dirb_,
-                                        uint64_t    mb_,
-                                        uint64_t    nb_,
-                                        uint64_t    nnzb_,
-                                        uint64_t    row_block_dim_,
-                                        uint64_t    col_block_dim_,
-                                        type_t      ptr_type_,
-                                        const void* __restrict__ ptr_,
-                                        type_t ind_type_,
-                                        const void* __restrict__ ind_,
-                                        type_t data_type_,
-                                        const void* __restrict__ data_,
-                                        index_base_t base_)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for(uint64_t c = b0; c < b1; ++c)
+            {
+                const uint64_t first = c * chunk_nmemb;
+                const uint64_t n     = std::min(chunk_nmemb, section_.nmemb - first);
+                chunk_valid[c - b0]
+                    = (offsets[c + 1] >= offsets[c])
+                      && codec_decode(section_.codec,
+                                      section_.size,
+                                      n,
+                                      buffer.data() + (offsets[c] - offsets[b0]),
+                                      offsets[c + 1] - offsets[c],
+                                      ((char*)data_) + (first - c0_ * chunk_nmemb) * section_.size);
+            }
+
+            for(uint64_t c = b0; c < b1; ++c)
+            {
+                if(!chunk_valid[c - b0])
+                {
+                    return status_t::invalid_format;
+                }
+            }
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Number of bytes of the data of an array section in the file.
+    //!
+    inline uint64_t section_nbytes(const section_t& section_)
     {
+        return (section_.codec == codec_t::none) ? section_.size * section_.nmemb
+                                                 : section_.chunk_offsets.back();
+    }
 
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_gebsx, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dirb_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(mb_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nb_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnzb_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(row_block_dim_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_block_dim_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
+    inline status_t fread_array(FILE*           in_,
+                                void*           data_,
+                                uint64_t        alignment_ = 1,
+                                const engine_t& engine_    = engine_t())
+    {
+        section_t section;
+        ROCSPARSEIO_CHECK(fread_array_header(in_, &section, alignment_));
+        if(section.codec == codec_t::none)
+        {
+            return fread_bulk(in_, data_, section.size * section.nmemb, engine_);
+        }
+
+        ROCSPARSEIO_CHECK(fread_section_chunks(
+            in_, section, 0, section.chunk_offsets.size() - 1, data_, engine_));
+        if(0 != fseek(in_, section.pos + section_nbytes(section), SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_array_metadata(FILE* in_, uint64_t* size_, uint64_t* nmemb_)
+    {
+        long pos = ftell(in_);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb_, in_));
+        size_[0] &= 0xffffffff;
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Locate the array section at the current position and move the file position
+    //! past it, without reading its data.
+    //!
+    inline status_t fskip_array(FILE* in_, section_t* section_, uint64_t alignment_ = 1)
+    {
+        ROCSPARSEIO_CHECK(fread_array_header(in_, section_, alignment_));
+        if(0 != fseek(in_, section_nbytes(section_[0]), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Read the elements [\p first_, \p first_ + \p nmemb_) of an array section.
+    //! @note With a codec, only the chunks holding the elements are read and decoded.
+    //!
+    inline status_t fread_section(FILE*            in_,
+                                  const section_t& section_,
+                                  uint64_t         first_,
+                                  uint64_t         nmemb_,
+                                  void*            data_,
+                                  const engine_t&  engine_ = engine_t())
+    {
+        if(first_ + nmemb_ > section_.nmemb)
+        {
+            return status_t::invalid_size;
+        }
+        if(nmemb_ == 0)
+        {
+            return status_t::success;
+        }
+
+        if(section_.codec == codec_t::none)
+        {
+            if(0 != fseek(in_, section_.pos + first_ * section_.size, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            return fread_bulk(in_, data_, section_.size * nmemb_, engine_);
+        }
+
+        const uint64_t    chunk_nmemb = section_.chunk_nmemb;
+        const uint64_t    c0          = first_ / chunk_nmemb;
+        const uint64_t    c1          = (first_ + nmemb_ - 1) / chunk_nmemb + 1;
+        const uint64_t    nchunk_nmemb
+            = std::min((c1 - c0) * chunk_nmemb, section_.nmemb - c0 * chunk_nmemb);
+        std::vector<char> chunks(nchunk_nmemb * section_.size);
+        ROCSPARSEIO_CHECK(fread_section_chunks(in_, section_, c0, c1, chunks.data(), engine_));
+        memcpy(data_,
+               chunks.data() + (first_ - c0 * chunk_nmemb) * section_.size,
+               nmemb_ * section_.size);
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Read the element \p i_ of an array section of offsets.
+    //!
+    inline status_t
+        fread_section_offset(FILE* in_, const section_t& section_, uint64_t i_, uint64_t* value_)
+    {
+        switch(section_.size)
+        {
+        case sizeof(int32_t):
+        {
+            int32_t value;
+            ROCSPARSEIO_CHECK(fread_section(in_, section_, i_, 1, &value));
+            return convert_scalar(value, value_[0]);
+        }
+        case sizeof(int64_t):
+        {
+            int64_t value;
+            ROCSPARSEIO_CHECK(fread_section(in_, section_, i_, 1, &value));
+            return convert_scalar(value, value_[0]);
+        }
+        }
+        return status_t::invalid_format;
+    }
+
+    template <typename T>
+    inline void rebase_offsets(uint64_t n_, T* offsets_, T shift_)
+    {
+        for(uint64_t i = 0; i < n_; ++i)
+        {
+            offsets_[i] -= shift_;
+        }
+    }
+
+    //!
+    //! @brief Locate the three array sections of a compressed sparse object, stored after
+    //! \p nscalars_ metadata scalars.
+    //!
+    inline status_t fskip_sparse_compressed(FILE*      in_,
+                                            uint64_t   nscalars_,
+                                            section_t* ptr_,
+                                            section_t* ind_,
+                                            section_t* data_,
+                                            uint64_t   alignment_)
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * nscalars_, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fskip_array(in_, ptr_, alignment_));
+        ROCSPARSEIO_CHECK(fskip_array(in_, ind_, alignment_));
+        ROCSPARSEIO_CHECK(fskip_array(in_, data_, alignment_));
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Number of entries of the rows [\p r0_, \p r1_) of a compressed sparse object,
+    //! the file position is left unchanged.
+    //!
+    inline status_t fread_sparse_compressed_rows_nnz(FILE*     in_,
+                                                     uint64_t  nscalars_,
+                                                     uint64_t  r0_,
+                                                     uint64_t  r1_,
+                                                     uint64_t* nnz_,
+                                                     uint64_t  alignment_)
+    {
+        const long pos = ftell(in_);
+        if(pos < 0)
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        section_t ptr, ind, data;
+        uint64_t  begin = 0, end = 0;
+        status_t  status = fskip_sparse_compressed(in_, nscalars_, &ptr, &ind, &data, alignment_);
+        if(status == status_t::success && (r0_ > r1_ || r1_ >= ptr.nmemb))
+        {
+            status = status_t::invalid_size;
+        }
+        if(status == status_t::success)
+        {
+            status = fread_section_offset(in_, ptr, r0_, &begin);
+        }
+        if(status == status_t::success)
+        {
+            status = fread_section_offset(in_, ptr, r1_, &end);
+        }
+
+        //
+        // The position is restored on failure too.
+        //
+        if(status != status_t::success)
+        {
+            fseek(in_, pos, SEEK_SET);
+            return status;
+        }
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        nnz_[0] = end - begin;
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Read the rows [\p r0_, \p r1_) of a compressed sparse object, the offsets
+    //! are rebased to start from \p base_. Only the byte ranges of the rows are read from the
+    //! sections of indices and values, and the file position is moved past the object.
+    //!
+    inline status_t fread_sparse_compressed_rows(FILE*    in_,
+                                                 uint64_t nscalars_,
+                                                 uint64_t base_,
+                                                 uint64_t block_nmemb_,
+                                                 uint64_t r0_,
+                                                 uint64_t r1_,
+                                                 void* __restrict__ ptr_,
+                                                 void* __restrict__ ind_,
+                                                 void* __restrict__ data_,
+                                                 uint64_t        alignment_,
+                                                 const engine_t& engine_)
+    {
+        section_t ptr, ind, data;
+        ROCSPARSEIO_CHECK(fskip_sparse_compressed(in_, nscalars_, &ptr, &ind, &data, alignment_));
+        const long end_pos = ftell(in_);
+        if(r0_ > r1_ || r1_ >= ptr.nmemb)
+        {
+            return status_t::invalid_size;
+        }
+
+        const uint64_t nrows = r1_ - r0_;
+        ROCSPARSEIO_CHECK(fread_section(in_, ptr, r0_, nrows + 1, ptr_));
+
+        //
+        // Offsets of the first and last rows, then rebase.
+        //
+        uint64_t begin, end;
+        switch(ptr.size)
+        {
+        case sizeof(int32_t):
+        {
+            int32_t* p = (int32_t*)ptr_;
+            ROCSPARSEIO_CHECK(convert_scalar(p[0], begin));
+            ROCSPARSEIO_CHECK(convert_scalar(p[nrows], end));
+            if(begin < base_ || end < begin)
+            {
+                return status_t::invalid_format;
+            }
+            rebase_offsets(nrows + 1, p, (int32_t)(begin - base_));
+            break;
+        }
+        case sizeof(int64_t):
+        {
+            int64_t* p = (int64_t*)ptr_;
+            ROCSPARSEIO_CHECK(convert_scalar(p[0], begin));
+            ROCSPARSEIO_CHECK(convert_scalar(p[nrows], end));
+            if(begin < base_ || end < begin)
+            {
+                return status_t::invalid_format;
+            }
+            rebase_offsets(nrows + 1, p, (int64_t)(begin - base_));
+            break;
+        }
+        default:
+        {
+            return status_t::invalid_format;
+        }
+        }
+
+        const uint64_t shift = begin - base_;
+
+        ROCSPARSEIO_CHECK(fread_section(in_, ind, shift, end - begin, ind_, engine_));
+        ROCSPARSEIO_CHECK(fread_section(
+            in_, data, shift * block_nmemb_, (end - begin) * block_nmemb_, data_, engine_));
+        if(0 != fseek(in_, end_pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+} // namespace rocsparseio
+
+namespace rocsparseio
+{
+
+    //
+    // ////////////////////////////////////////////////
+    //
+    inline status_t fwrite_dense_vector(FILE*           out_,
+                                        type_t          data_type_,
+                                        uint64_t        data_nmemb_,
+                                        const void*     data_,
+                                        uint64_t        data_inc_,
+                                        const engine_t& engine_ = engine_t())
+    {
+
+        ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
+
+        ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
+
+        ROCSPARSEIO_CHECK_ARG(((data_nmemb_ > 0) && (data_ == nullptr)), status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(((data_inc_ > 0) && (data_ == nullptr)), status_t::invalid_size);
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
+        uint64_t data_size = data_type_.size();
+        if(data_inc_ == 1)
+        {
+            ROCSPARSEIO_CHECK(fwrite_bulk(out_, data_, data_size * data_nmemb_, engine_));
+        }
+        else
+        {
+            for(uint64_t i = 0; i < data_nmemb_; ++i)
+            {
+                if(1
+                   != fwrite(((const char*)data_) + i * data_inc_ * data_size, data_size, 1, out_))
+                {
+                    return status_t::invalid_file_operation;
+                }
+            }
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_format(FILE* in, format_t* format)
+    {
+        ROCSPARSEIO_CHECK_ARG(in == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(format == nullptr, status_t::invalid_pointer);
+        long pos = ftell(in);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in));
+        if(0 != fseek(in, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    };
+
+    inline status_t fread_metadata_dense_vector(FILE* in, type_t* type, uint64_t* nmemb)
+    {
+        ROCSPARSEIO_CHECK_ARG(in == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(type == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(nmemb == nullptr, status_t::invalid_pointer);
+        long     pos = ftell(in);
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in));
+        if(format != format_t::dense_vector)
+        {
+            std::cerr << " wrong format, not flagged as a dense_vector. " << std::endl;
+            return status_t::invalid_format;
+        }
+
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in));
+        if(0 != fseek(in, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    };
+
+    inline status_t fread_dense_vector(FILE*           in_,
+                                       void*           data_,
+                                       uint64_t        inc_,
+                                       const engine_t& engine_ = engine_t())
+    {
+        if(0 != fseek(in_, sizeof(uint64_t), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+        type_t type;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in_));
+        uint64_t size = type.size();
+        uint64_t nmemb;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
+        if(inc_ == 1)
+        {
+            return fread_bulk(in_, data_, size * nmemb, engine_);
+        }
+        else
+        {
+            void* buff = malloc(size * nmemb);
+            ROCSPARSEIO_CHECK(fread_data(in_, size, nmemb, buff));
+            uint64_t j = 0;
+            for(uint64_t i = 0; i < nmemb; ++i)
+            {
+                memcpy(((char*)data_) + j * size, ((char*)buff) + i * size, size);
+                j += inc_;
+            }
+            free(buff);
+            return status_t::invalid_value;
+        }
+    }
+
+} // namespace rocsparseio
+
+namespace rocsparseio
+{
+
+    inline status_t fwrite_dense_matrix(FILE*       out_,
+                                        order_t     order_,
+                                        uint64_t    m_,
+                                        uint64_t    n_,
+                                        type_t      data_type_,
+                                        const void*     data_,
+                                        uint64_t        data_ld_,
+                                        const engine_t& engine_ = engine_t())
+    {
+        ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
+
+        ROCSPARSEIO_CHECK_ARG(order_.is_invalid(), status_t::invalid_value);
+
+        ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
+
+        ROCSPARSEIO_CHECK_ARG((((m_ > 0) && (n_ > 0)) && (data_ == nullptr)),
+                              status_t::invalid_pointer);
+
+        ROCSPARSEIO_CHECK_ARG((((m_ > 0) && (n_ > 0)) && (data_ == nullptr)),
+                              status_t::invalid_pointer);
+
+        ROCSPARSEIO_CHECK_ARG(((order_ == order_t::row) && (data_ld_ < n_)),
+                              status_t::invalid_size);
+
+        ROCSPARSEIO_CHECK_ARG(((order_ == order_t::column) && (data_ld_ < m_)),
+                              status_t::invalid_size);
+
+        uint64_t data_nmemb = m_ * n_;
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_matrix, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(order_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb, out_));
+
+        uint64_t data_size = data_type_.size();
+        switch(order_)
+        {
+        case order_t::row:
+        {
+            if(data_ld_ == n_)
+            {
+                ROCSPARSEIO_CHECK(fwrite_bulk(out_, data_, data_size * data_nmemb, engine_));
+            }
+            else
+            {
+                for(uint64_t i = 0; i < m_; ++i)
+                {
+                    if(n_
+                       != fwrite(
+                           ((const char*)data_) + i * data_ld_ * data_size, data_size, n_, out_))
+                    {
+                        return status_t::invalid_file_operation;
+                    }
+                }
+            }
+            break;
+        }
+
+        case order_t::column:
+        {
+            if(data_ld_ == m_)
+            {
+                ROCSPARSEIO_CHECK(fwrite_bulk(out_, data_, data_size * data_nmemb, engine_));
+            }
+            else
+            {
+                for(uint64_t j = 0; j < n_; ++j)
+                {
+                    if(m_
+                       != fwrite(
+                           ((const char*)data_) + j * data_ld_ * data_size, data_size, m_, out_))
+                    {
+                        return status_t::invalid_file_operation;
+                    }
+                }
+            }
+            break;
+        }
+        }
+        return status_t::success;
+    };
+
+    inline status_t
+        fread_dense_matrix(FILE* in_, void* data_, const engine_t& engine_ = engine_t())
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * 4, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+        type_t type;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type, in_));
+        uint64_t size = type.size();
+        uint64_t nmemb;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
+        return fread_bulk(in_, data_, size * nmemb, engine_);
+    }
+
+    inline status_t fread_metadata_dense_matrix(
+        FILE* in_, order_t* order_, uint64_t* m_, uint64_t* n_, type_t* type_)
+    {
+        long     pos = ftell(in_);
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
+        if(format != format_t::dense_matrix)
+        {
+            std::cerr << " wrong format, not flagged as a dense matrix. " << std::endl;
+            return status_t::invalid_format;
+        }
+
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(order_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(type_, in_));
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+} // namespace rocsparseio
+
+//
+//
+//
+namespace rocsparseio
+{
+    inline status_t fwrite_sparse_csx(FILE*       out_,
+                                      direction_t dir_,
+                                      uint64_t    m_,
+                                      uint64_t    n_,
+                                      uint64_t    nnz_,
+                                      type_t      ptr_type_,
+                                      const void* __restrict__ ptr_,
+                                      type_t ind_type_,
+                                      const void* __restrict__ ind_,
+                                      type_t data_type_,
+                                      const void* __restrict__ data_,
+                                      index_base_t base_,
+                                      uint64_t        alignment_   = 1,
+                                      codec_t         index_codec_ = codec_t::none,
+                                      codec_t         value_codec_ = codec_t::none,
+                                      const engine_t& engine_      = engine_t())
+    {
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_csx, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
+        switch(dir_)
+        {
+        case direction_t::row:
+        {
+            ROCSPARSEIO_CHECK(fwrite_array(
+                out_, ptr_type_.size(), m_ + 1, ptr_, alignment_, index_codec_, engine_));
+            break;
+        }
+        case direction_t::column:
+        {
+            ROCSPARSEIO_CHECK(fwrite_array(
+                out_, ptr_type_.size(), n_ + 1, ptr_, alignment_, index_codec_, engine_));
+            break;
+        }
+        }
+
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, ind_type_.size(), nnz_, ind_, alignment_, index_codec_, engine_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, data_type_.size(), nnz_, data_, alignment_, value_codec_, engine_));
+
+        return status_t::success;
+    };
+
+    inline status_t fread_metadata_sparse_csx(FILE*         in_,
+                                              direction_t*  dir_,
+                                              uint64_t*     m_,
+                                              uint64_t*     n_,
+                                              uint64_t*     nnz_,
+                                              type_t*       ptr_type,
+                                              type_t*       ind_type,
+                                              type_t*       data_type,
+                                              index_base_t* base)
+    {
+        long     pos = ftell(in_);
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dir_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnz_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ptr_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ind_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_sparse_csx(FILE* in_,
+                                     void* __restrict__ ptr_,
+                                     void* __restrict__ ind_,
+                                     void* __restrict__ data_,
+                                     uint64_t        alignment_ = 1,
+                                     const engine_t& engine_    = engine_t())
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * 9, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fread_array(in_, ptr_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, ind_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, data_, alignment_, engine_));
+
+        return status_t::success;
+    }
+
+    inline status_t fread_metadata_sparse_csx_rows(
+        FILE* in_, uint64_t r0_, uint64_t r1_, uint64_t* nnz_, uint64_t alignment_ = 1)
+    {
+        return fread_sparse_compressed_rows_nnz(in_, 9, r0_, r1_, nnz_, alignment_);
+    }
+
+    inline status_t fread_sparse_csx_rows(FILE*    in_,
+                                          uint64_t r0_,
+                                          uint64_t r1_,
+                                          void* __restrict__ ptr_,
+                                          void* __restrict__ ind_,
+                                          void* __restrict__ data_,
+                                          uint64_t        alignment_ = 1,
+                                          const engine_t& engine_    = engine_t())
+    {
+        direction_t  dir;
+        uint64_t     m, n, nnz;
+        type_t       ptr_type, ind_type, data_type;
+        index_base_t base;
+        ROCSPARSEIO_CHECK(fread_metadata_sparse_csx(
+            in_, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &data_type, &base));
+        return fread_sparse_compressed_rows(
+            in_, 9, base, 1, r0_, r1_, ptr_, ind_, data_, alignment_, engine_);
+    }
+
+} // namespace rocsparseio
+
+namespace rocsparseio
+{
+    inline status_t fwrite_sparse_coo(FILE*    out_,
+                                      uint64_t m_,
+                                      uint64_t n_,
+                                      uint64_t nnz_,
+                                      type_t   row_ind_type_,
+                                      const void* __restrict__ row_ind_,
+                                      type_t col_ind_type_,
+                                      const void* __restrict__ col_ind_,
+                                      type_t data_type_,
+                                      const void* __restrict__ data_,
+                                      index_base_t base_,
+                                      uint64_t        alignment_   = 1,
+                                      codec_t         index_codec_ = codec_t::none,
+                                      codec_t         value_codec_ = codec_t::none,
+                                      const engine_t& engine_      = engine_t())
+    {
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_coo, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(row_ind_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_ind_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
+        ROCSPARSEIO_CHECK(fwrite_array(
+            out_, row_ind_type_.size(), nnz_, row_ind_, alignment_, index_codec_, engine_));
+        ROCSPARSEIO_CHECK(fwrite_array(
+            out_, col_ind_type_.size(), nnz_, col_ind_, alignment_, index_codec_, engine_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, data_type_.size(), nnz_, data_, alignment_, value_codec_, engine_));
+        return status_t::success;
+    };
+
+    inline status_t fread_metadata_sparse_coo(FILE*         in_,
+                                              uint64_t*     m_,
+                                              uint64_t*     n_,
+                                              uint64_t*     nnz_,
+                                              type_t*       row_ind_type,
+                                              type_t*       col_ind_type,
+                                              type_t*       data_type,
+                                              index_base_t* base)
+    {
+        long     pos = ftell(in_);
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(m_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(n_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnz_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(row_ind_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(col_ind_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_sparse_coo(FILE* in_,
+                                     void* __restrict__ row_ind_,
+                                     void* __restrict__ col_ind_,
+                                     void* __restrict__ data_,
+                                     uint64_t        alignment_ = 1,
+                                     const engine_t& engine_    = engine_t())
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * 8, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fread_array(in_, row_ind_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, col_ind_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, data_, alignment_, engine_));
+
+        return status_t::success;
+    }
+
+} // namespace rocsparseio
+
+namespace rocsparseio
+{
+
+    inline status_t fwrite_sparse_gebsx(FILE*       out_,
+                                        direction_t dir_,
+                                        direction_t dirb_,
+                                        uint64_t    mb_,
+                                        uint64_t    nb_,
+                                        uint64_t    nnzb_,
+                                        uint64_t    row_block_dim_,
+                                        uint64_t    col_block_dim_,
+                                        type_t      ptr_type_,
+                                        const void* __restrict__ ptr_,
+                                        type_t ind_type_,
+                                        const void* __restrict__ ind_,
+                                        type_t data_type_,
+                                        const void* __restrict__ data_,
+                                        index_base_t base_,
+                                        uint64_t        alignment_   = 1,
+                                        codec_t         index_codec_ = codec_t::none,
+                                        codec_t         value_codec_ = codec_t::none,
+                                        const engine_t& engine_      = engine_t())
+    {
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_gebsx, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dirb_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(mb_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nb_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnzb_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(row_block_dim_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_block_dim_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
+
+        switch(dir_)
+        {
+        case direction_t::row:
+        {
+            ROCSPARSEIO_CHECK(fwrite_array(
+                out_, ptr_type_.size(), mb_ + 1, ptr_, alignment_, index_codec_, engine_));
+            break;
+        }
+        case direction_t::column:
+        {
+            ROCSPARSEIO_CHECK(fwrite_array(
+                out_, ptr_type_.size(), nb_ + 1, ptr_, alignment_, index_codec_, engine_));
+            break;
+        }
+        }
+
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, ind_type_.size(), nnzb_, ind_, alignment_, index_codec_, engine_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_,
+                                       data_type_.size(),
+                                       nnzb_ * row_block_dim_ * col_block_dim_,
+                                       data_,
+                                       alignment_,
+                                       value_codec_,
+                                       engine_));
+
+        return status_t::success;
+    };
+
+    inline status_t fread_metadata_sparse_gebsx(FILE*         in_,
+                                                direction_t*  dir_,
+                                                direction_t*  dirb_,
+                                                uint64_t*     mb_,
+                                                uint64_t*     nb_,
+                                                uint64_t*     nnzb_,
+                                                uint64_t*     row_block_dim_,
+                                                uint64_t*     col_block_dim_,
+                                                type_t*       ptr_type,
+                                                type_t*       ind_type,
+                                                type_t*       data_type,
+                                                index_base_t* base)
+    {
+        long     pos = ftell(in_);
+        format_t format(0);
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dir_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dirb_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(mb_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nb_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnzb_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(row_block_dim_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(col_block_dim_, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ptr_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ind_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_sparse_gebsx(FILE* in_,
+                                       void* __restrict__ ptr_,
+                                       void* __restrict__ ind_,
+                                       void* __restrict__ data_,
+                                       uint64_t        alignment_ = 1,
+                                       const engine_t& engine_    = engine_t())
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * 12, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fread_array(in_, ptr_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, ind_, alignment_, engine_));
+        ROCSPARSEIO_CHECK(fread_array(in_, data_, alignment_, engine_));
+
+        return status_t::success;
+    }
+
+    inline status_t fread_metadata_sparse_gebsx_rows(
+        FILE* in_, uint64_t r0_, uint64_t r1_, uint64_t* nnzb_, uint64_t alignment_ = 1)
+    {
+        return fread_sparse_compressed_rows_nnz(in_, 12, r0_, r1_, nnzb_, alignment_);
+    }
+
+    inline status_t fread_sparse_gebsx_rows(FILE*    in_,
+                                            uint64_t r0_,
+                                            uint64_t r1_,
+                                            void* __restrict__ ptr_,
+                                            void* __restrict__ ind_,
+                                            void* __restrict__ data_,
+                                            uint64_t        alignment_ = 1,
+                                            const engine_t& engine_    = engine_t())
+    {
+        direction_t  dir, dirb;
+        uint64_t     mb, nb, nnzb, row_block_dim, col_block_dim;
+        type_t       ptr_type, ind_type, data_type;
+        index_base_t base;
+        ROCSPARSEIO_CHECK(fread_metadata_sparse_gebsx(in_,
+                                                      &dir,
+                                                      &dirb,
+                                                      &mb,
+                                                      &nb,
+                                                      &nnzb,
+                                                      &row_block_dim,
+                                                      &col_block_dim,
+                                                      &ptr_type,
+                                                      &ind_type,
+                                                      &data_type,
+                                                      &base));
+        return fread_sparse_compressed_rows(in_,
+                                            12,
+                                            base,
+                                            row_block_dim * col_block_dim,
+                                            r0_,
+                                            r1_,
+                                            ptr_,
+                                            ind_,
+                                            data_,
+                                            alignment_,
+                                            engine_);
+    }
+
+} // namespace rocsparseio
+
+namespace rocsparseio
+{
+    template <>
+    inline type_t type_t::convert<int32_t>()
+    {
+        return type_t::int32;
+    };
+    template <>
+    inline type_t type_t::convert<int64_t>()
+    {
+        return type_t::int64;
+    };
+
+    template <>
+    inline type_t type_t::convert<float>()
+    {
+        return type_t::float32;
+    };
+    template <>
+    inline type_t type_t::convert<double>()
+    {
+        return type_t::float64;
+    };
+
+    template <typename... Ts>
+    inline status_t read_format(rocsparseio_handle handle, Ts&&... ts)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        return fread_format(handle->f, ts...);
+    }
+
+    //!
+    //! @brief Map the file of a handle opened with rwmode_t::read_mmap.
+    //! @note The mapping is private and read-only, pages are only loaded on first access.
+    //!
+    inline status_t map_file(rocsparseio_handle handle)
+    {
+#ifdef WIN32
+        return status_t::invalid_mode;
+#else
+        struct stat st;
+        const int   fd = fileno(handle->f);
+        if(0 != fstat(fd, &st))
+        {
+            return status_t::invalid_file_operation;
+        }
+        void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map == MAP_FAILED)
+        {
+            return status_t::invalid_memory;
+        }
+        handle->map      = (const char*)map;
+        handle->map_size = st.st_size;
+        return status_t::success;
+#endif
+    }
+
+    //!
+    //! @brief Get the address of the next array section in the file mapping and move the file
+    //! position past it.
+    //! @note The pages of the section are advised for sequential access.
+    //!
+    inline status_t map_array(rocsparseio_handle handle, const void** data_)
+    {
+        section_t section;
+        ROCSPARSEIO_CHECK(fread_array_header(handle->f, &section, handle->alignment));
+
+        //
+        // Encoded sections cannot be used in place.
+        //
+        if(section.codec != codec_t::none)
+        {
+            return status_t::invalid_format;
+        }
+
+        const uint64_t size  = section.size;
+        const uint64_t nmemb = section.nmemb;
+        const long     pos   = section.pos;
+        const uint64_t offset = pos;
+        const uint64_t nbytes = size * nmemb;
+        if(offset + nbytes > handle->map_size)
+        {
+            return status_t::invalid_file;
+        }
+
+        //
+        // The section must be naturally aligned to be used in place.
+        //
+        const uint64_t natural = (size < sizeof(double)) ? size : sizeof(double);
+        if(natural > 1 && (offset % natural) != 0)
+        {
+            return status_t::invalid_format;
+        }
+
+#ifndef WIN32
+        if(nbytes > 0)
+        {
+            const uint64_t page  = sysconf(_SC_PAGESIZE);
+            const uint64_t first = offset - offset % page;
+            madvise((void*)(handle->map + first), offset + nbytes - first, MADV_SEQUENTIAL);
+        }
+#endif
+
+        data_[0] = handle->map + offset;
+        if(0 != fseek(handle->f, nbytes, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Map the three array sections of a sparse object, stored after \p nscalars_
+    //! metadata scalars. The file position is restored if the sections cannot be mapped.
+    //!
+    inline status_t map_sparse_arrays(rocsparseio_handle handle,
+                                      uint64_t           nscalars_,
+                                      const void**       a_,
+                                      const void**       b_,
+                                      const void**       c_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle->map == nullptr, status_t::invalid_mode);
+        const long pos = ftell(handle->f);
+        if(pos < 0 || 0 != fseek(handle->f, sizeof(uint64_t) * nscalars_, SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        status_t status = map_array(handle, a_);
+        if(status == status_t::success)
+        {
+            status = map_array(handle, b_);
+        }
+        if(status == status_t::success)
+        {
+            status = map_array(handle, c_);
+        }
+        if(status != status_t::success)
+        {
+            fseek(handle->f, pos, SEEK_SET);
+        }
+        return status;
+    }
+
+    //!
+    //! @brief Magic number ending an archive, "RSIO.TOC".
+    //!
+    inline uint64_t toc_magic()
+    {
+        uint64_t   magic;
+        const char tag[sizeof(uint64_t) + 1] = "RSIO.TOC";
+        memcpy(&magic, tag, sizeof(uint64_t));
+        return magic;
+    }
+
+    //!
+    //! @brief Read the table of contents of an archive and index its entries by name.
+    //!
+    inline status_t fread_toc(rocsparseio_handle handle)
+    {
+        FILE* in = handle->f;
+        if(0 != fseek(in, -2 * (long)sizeof(uint64_t), SEEK_END))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        const long trailer_offset = ftell(in);
+        uint64_t   toc_offset, magic;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(toc_offset, in));
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(magic, in));
+        if(magic != toc_magic() || trailer_offset < 0 || toc_offset >= (uint64_t)trailer_offset)
+        {
+            return status_t::invalid_format;
+        }
+
+        if(0 != fseek(in, toc_offset, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        uint64_t nentries;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nentries, in));
+        if(nentries > (trailer_offset - toc_offset) / (4 * sizeof(uint64_t)))
+        {
+            return status_t::invalid_format;
+        }
+
+        handle->entries.resize(nentries);
+        handle->entry_index.reserve(nentries);
+        for(uint64_t i = 0; i < nentries; ++i)
+        {
+            entry_t& entry = handle->entries[i];
+            uint64_t name_size;
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(&entry.format, in));
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(entry.offset, in));
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(entry.nbytes, in));
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(name_size, in));
+            if(entry.offset + entry.nbytes > toc_offset || name_size > trailer_offset - toc_offset)
+            {
+                return status_t::invalid_format;
+            }
+
+            entry.name.resize(name_size);
+            if(name_size != fread(&entry.name[0], 1, name_size, in))
+            {
+                return status_t::invalid_file_operation;
+            }
+            ROCSPARSEIO_CHECK(fread_padding(in, sizeof(uint64_t)));
+            handle->entry_index[entry.name] = i;
+        }
+
+        //
+        // Back to the first object.
+        //
+        if(0 != fseek(in, 2 * sizeof(uint64_t), SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t open(rocsparseio_handle* p_handle, rwmode_t mode, const char* filename, ...)
+    {
+        char filename_[512];
+        {
+            va_list args;
+            va_start(args, filename);
+            if(vsnprintf(filename_, 512, filename, args) >= 512)
+            {
+                std::cerr << "string is too long and is trucated. " << std::endl;
+                return status_t::invalid_value;
+            }
+            va_end(args);
+        }
+
+        rocsparseio_handle h = new _rocsparseio_handle(mode, filename_);
+        p_handle[0]          = h;
+
+        h->f = nullptr;
+        switch(mode)
+        {
+        case rwmode_t::read:
+        case rwmode_t::read_mmap:
+        {
+            h->f = fopen(filename_, "rb");
+            if(h->f == nullptr)
+            {
+                return status_t::invalid_file;
+            }
+
+            {
+                uint64_t ref_value[2]{};
+                char*    p = (char*)&ref_value[0];
+                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
+                uint64_t value[2]{};
+                if(2 != fread(&value[0], sizeof(uint64_t), 2, h->f))
+                {
+                    return status_t::invalid_file_operation;
+                }
+                //	    std::cout << "read " << value[0] << " " << value[1] <<
+                //std::endl;
+
+                //
+                // The last byte of the header holds the layout revision.
+                //
+                const int minor        = ((const unsigned char*)&value[0])[15];
+                ((char*)&value[0])[15] = 0;
+                if(ref_value[0] != value[0] || ref_value[1] != value[1])
+                {
+                    std::cerr << "incompatible rocsparseio version: " << std::endl;
+                    std::cerr << "   expected      : " << ref_value[0] << "." << ref_value[1]
+                              << std::endl;
+                    std::cerr << "   from file     : " << value[0] << "." << value[1] << std::endl;
+                    return status_t::invalid_file;
+                }
+                if(minor > ROCSPARSEIO_VERSION_MINOR)
+                {
+                    std::cerr << "incompatible rocsparseio layout revision: " << std::endl;
+                    std::cerr << "   expected      : <= " << ROCSPARSEIO_VERSION_MINOR << std::endl;
+                    std::cerr << "   from file     : " << minor << std::endl;
+                    return status_t::invalid_file;
+                }
+                h->alignment = (minor >= layout_revision_aligned) ? ROCSPARSEIO_ALIGNMENT : 1;
+                h->revision  = (layout_revision)minor;
+            }
+
+            if(h->revision >= layout_revision_archive)
+            {
+                ROCSPARSEIO_CHECK(fread_toc(h));
+            }
+
+            if(mode == rwmode_t::read_mmap)
+            {
+                ROCSPARSEIO_CHECK(map_file(h));
+            }
+            break;
+        }
+
+        case rwmode_t::write:
+        case rwmode_t::write_aligned:
+        {
+            //
+            // The aligned layout is opt-in, the default layout is readable by any reader.
+            //
+            const bool aligned = (mode == rwmode_t::write_aligned);
+            h->mode            = rwmode_t::write;
+
+            h->f = fopen(filename_, "wb");
+            if(h->f == nullptr)
+            {
+                return status_t::invalid_file;
+            }
+
+            //
+            // WRITE HEADER
+            //
+            {
+                uint64_t value[2]{};
+                char*    p = (char*)&value;
+                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
+                p[15] = aligned ? layout_revision_aligned : layout_revision_packed;
+                if(2 != fwrite(&value[0], sizeof(uint64_t), 2, h->f))
+                {
+                    return status_t::invalid_file_operation;
+                }
+            }
+            h->alignment = aligned ? ROCSPARSEIO_ALIGNMENT : 1;
+            h->revision  = aligned ? layout_revision_aligned : layout_revision_packed;
+
+            break;
+        }
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Overwrite the layout revision in the header of a file being written.
+    //!
+    inline status_t fwrite_layout_revision(FILE* out_, layout_revision revision_)
+    {
+        const long pos = ftell(out_);
+        if(pos < 0 || 0 != fseek(out_, 15, SEEK_SET) || EOF == fputc(revision_, out_)
+           || 0 != fseek(out_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Raise the layout revision of a file being written, lower revisions are ignored.
+    //! @note The sections of the revisions above the packed one are aligned, a packed file is
+    //! only raised before its first object.
+    //!
+    inline status_t raise_layout_revision(rocsparseio_handle handle, layout_revision revision_)
+    {
+        if(revision_ > handle->revision)
+        {
+            if(handle->alignment == 1)
+            {
+                if(ftell(handle->f) != long(2 * sizeof(uint64_t)))
+                {
+                    return status_t::invalid_mode;
+                }
+                handle->alignment = ROCSPARSEIO_ALIGNMENT;
+            }
+            ROCSPARSEIO_CHECK(fwrite_layout_revision(handle->f, revision_));
+            handle->revision = revision_;
+        }
+        return status_t::success;
+    }
+
+    inline status_t
+        set_codecs(rocsparseio_handle handle, codec_t index_codec_, codec_t value_codec_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle->mode != rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(index_codec_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(value_codec_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(value_codec_ == codec_t::delta_varint, status_t::invalid_value);
+        handle->index_codec = index_codec_;
+        handle->value_codec = value_codec_;
+        if(index_codec_ != codec_t::none || value_codec_ != codec_t::none)
+        {
+            ROCSPARSEIO_CHECK(raise_layout_revision(handle, layout_revision_codec));
+        }
+        return status_t::success;
+    }
+
+    inline status_t
+        set_io_engine(rocsparseio_handle handle, uint64_t chunk_size_, uint64_t queue_depth_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(chunk_size_ == 0, status_t::invalid_size);
+        ROCSPARSEIO_CHECK_ARG(queue_depth_ == 0, status_t::invalid_size);
+        handle->engine.chunk_size  = chunk_size_;
+        handle->engine.queue_depth = queue_depth_;
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Name the next object to write, the file becomes an archive whose table of contents
+    //! is written when the handle is closed.
+    //!
+    inline status_t archive_set_name(rocsparseio_handle handle, const char* name_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle->mode != rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(!name_, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(name_[0] == '\0', status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(handle->entry_index.count(name_) > 0, status_t::invalid_value);
+        ROCSPARSEIO_CHECK(raise_layout_revision(handle, layout_revision_archive));
+        handle->entry_name = name_;
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Record the object starting at the current file position, under the pending name
+    //! if any. The previous entry ends where this object starts.
+    //!
+    inline status_t archive_begin_object(rocsparseio_handle handle, format_t format_)
+    {
+        if(handle->revision < layout_revision_archive)
+        {
+            return status_t::success;
+        }
+
+        const long pos = ftell(handle->f);
+        if(pos < 0)
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        if(handle->entry_open)
+        {
+            entry_t& last      = handle->entries.back();
+            last.nbytes        = pos - last.offset;
+            handle->entry_open = false;
+        }
+
+        if(!handle->entry_name.empty())
+        {
+            entry_t entry;
+            entry.name                      = handle->entry_name;
+            entry.format                    = format_;
+            entry.offset                    = pos;
+            handle->entry_index[entry.name] = handle->entries.size();
+            handle->entries.push_back(entry);
+            handle->entry_name.clear();
+            handle->entry_open = true;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Start a new object, no object can be written while a matrix is streamed.
+    //!
+    inline status_t begin_object(rocsparseio_handle handle, format_t format_)
+    {
+        ROCSPARSEIO_CHECK_ARG(handle->stream.active, status_t::invalid_mode);
+        return archive_begin_object(handle, format_);
+    }
+
+    //!
+    //! @brief Write the table of contents of an archive, followed by the trailer which locates it.
+    //! @note Each entry is its format, offset, size in bytes and name, padded to 8 bytes.
+    //!
+    inline status_t fwrite_toc(rocsparseio_handle handle)
+    {
+        FILE* out = handle->f;
+
+        //
+        // End the last entry, a name not followed by any object is dropped.
+        //
+        handle->entry_name.clear();
+        ROCSPARSEIO_CHECK(archive_begin_object(handle, format_t()));
+        ROCSPARSEIO_CHECK(fwrite_padding(out, handle->alignment));
+
+        const long toc_offset = ftell(out);
+        if(toc_offset < 0)
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        const uint64_t nentries = handle->entries.size();
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nentries, out));
+        for(const entry_t& entry : handle->entries)
+        {
+            const uint64_t name_size = entry.name.size();
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.format, out));
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.offset, out));
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.nbytes, out));
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(name_size, out));
+            if(name_size != fwrite(entry.name.data(), 1, name_size, out))
+            {
+                return status_t::invalid_file_operation;
+            }
+            ROCSPARSEIO_CHECK(fwrite_padding(out, sizeof(uint64_t)));
+        }
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(toc_offset, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(toc_magic(), out));
+        return status_t::success;
+    }
+
+    inline status_t archive_get_size(rocsparseio_handle handle, uint64_t* nentries_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(!nentries_, status_t::invalid_pointer);
+        nentries_[0] = handle->entries.size();
+        return status_t::success;
+    }
+
+    inline status_t archive_get_entry(rocsparseio_handle handle,
+                                      uint64_t           index_,
+                                      const char**       name_,
+                                      format_t*          format_,
+                                      uint64_t*          nbytes_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(index_ >= handle->entries.size(), status_t::invalid_value);
+        const entry_t& entry = handle->entries[index_];
+        if(name_ != nullptr)
+        {
+            name_[0] = entry.name.c_str();
+        }
+        if(format_ != nullptr)
+        {
+            format_[0] = entry.format;
+        }
+        if(nbytes_ != nullptr)
+        {
+            nbytes_[0] = entry.nbytes;
+        }
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Move the file position to the named entry of an archive, such that it is the next
+    //! object to read.
+    //!
+    inline status_t archive_seek(rocsparseio_handle handle, const char* name_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle->mode == rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(!name_, status_t::invalid_pointer);
+        const auto it = handle->entry_index.find(name_);
+        if(it == handle->entry_index.end())
+        {
+            return status_t::invalid_value;
+        }
+        if(0 != fseek(handle->f, handle->entries[it->second].offset, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
 
-        switch(dir_)
+    //!
+    //! @brief Write the staged offsets to their place in the reserved array of offsets.
+    //!
+    inline status_t stream_flush_offsets(rocsparseio_handle handle)
+    {
+        stream_t&      stream = handle->stream;
+        FILE*          out    = handle->f;
+        const uint64_t size   = stream.ptr_type.size();
+        if(stream.ptr_nstaged == 0)
         {
-        case direction_t::row:
+            return status_t::success;
+        }
+        if(0 != fseek(out, stream.ptr_pos + stream.ptr_nflushed * size, SEEK_SET)
+           || stream.ptr_nstaged != fwrite(stream.buffer.data(), size, stream.ptr_nstaged, out)
+           || 0 != fseek(out, stream.end_pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        stream.ptr_nflushed += stream.ptr_nstaged;
+        stream.ptr_nstaged = 0;
+        return status_t::success;
+    }
+
+    //!
+    //! @brief Stage the offset \p value_ of the next row, the staged offsets are written to
+    //! the file when the buffer is full.
+    //!
+    inline status_t stream_stage_offset(rocsparseio_handle handle, uint64_t value_)
+    {
+        stream_t&      stream = handle->stream;
+        const uint64_t size   = stream.ptr_type.size();
+        if((stream.ptr_nstaged + 1) * size > stream.buffer.size())
+        {
+            ROCSPARSEIO_CHECK(stream_flush_offsets(handle));
+        }
+        char* p = stream.buffer.data() + stream.ptr_nstaged * size;
+        switch(stream.ptr_type)
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), mb_ + 1, ptr_));
+        case type_t::int32:
+        {
+            if(value_ > (uint64_t)std::numeric_limits<int32_t>::max())
+            {
+                return status_t::invalid_size;
+            }
+            const int32_t v = (int32_t)value_;
+            memcpy(p, &v, sizeof(int32_t));
             break;
         }
-        case direction_t::column:
+        case type_t::int64:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), nb_ + 1, ptr_));
+            const int64_t v = (int64_t)value_;
+            memcpy(p, &v, sizeof(int64_t));
             break;
         }
+        default:
+        {
+            return status_t::invalid_format;
         }
-
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), nnzb_, ind_));
-        ROCSPARSEIO_CHECK(
-            fwrite_array(out_, data_type_.size(), nnzb_ * row_block_dim_ * col_block_dim_, data_));
-
+        }
+        ++stream.ptr_nstaged;
         return status_t::success;
-    };
+    }
 
-    inline status_t fread_metadata_sparse_gebsx(FILE*         in_,
-                                                direction_t*  dir_,
-                                                direction_t*  dirb_,
-                                                uint64_t*     mb_,
-                                                uint64_t*     nb_,
-                                                uint64_t*     nnzb_,
-                                                uint64_t*     row_block_dim_,
-                                                uint64_t*     col_block_dim_,
-                                                type_t*       ptr_type,
-                                                type_t*       ind_type,
-                                                type_t*       data_type,
-                                                index_base_t* base)
+    //!
+    //! @brief Get the element \p i_ of an array of offsets of type \p type_.
+    //!
+    inline uint64_t offset_at(type_t type_, const void* offsets_, uint64_t i_)
     {
-        long     pos = ftell(in_);
-        format_t format(0);
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(format, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dir_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(dirb_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(mb_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nb_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nnzb_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(row_block_dim_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(col_block_dim_, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ptr_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(ind_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(data_type, in_));
-        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(base, in_));
-        if(0 != fseek(in_, pos, SEEK_SET))
+        return (type_ == type_t::int32) ? (uint64_t)((const int32_t*)offsets_)[i_]
+                                        : (uint64_t)((const int64_t*)offsets_)[i_];
+    }
+
+    //!
+    //! @brief Release the spool file and the buffer of a stream.
+    //!
+    inline void stream_release(rocsparseio_handle handle)
+    {
+        stream_t& stream = handle->stream;
+        if(stream.spool != nullptr)
         {
-            return status_t::invalid_file_operation;
+            fclose(stream.spool);
+            remove(stream.spool_name.c_str());
         }
-        return status_t::success;
+        handle->stream = stream_t();
     }
 
-    inline status_t fread_sparse_gebsx(FILE* in_,
-                                       void* __restrict__ ptr_,
-                                       void* __restrict__ ind_,
-                                       void* __restrict__ data_)
-    {
-        if(0 != fseek(in_, sizeof(uint64_t) * 12, SEEK_CUR))
+    //!
+    //! @brief Reserve the array of \p m_ + 1 offsets of a streamed sparse matrix and write the
+    //! header of its array of indices, after its metadata.
+    //!
+    inline status_t stream_sparse_arrays_header(rocsparseio_handle handle,
+                                                uint64_t           m_,
+                                                uint64_t           block_nmemb_,
+                                                type_t             ptr_type_,
+                                                type_t             ind_type_,
+                                                type_t             data_type_,
+                                                index_base_t       base_)
+    {
+        stream_t& stream = handle->stream;
+        FILE*     out    = handle->f;
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_.size(), out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_ + 1, out));
+        ROCSPARSEIO_CHECK(fwrite_padding(out, handle->alignment));
+        stream.ptr_pos = ftell(out);
+        if(stream.ptr_pos < 0 || 0 != fseek(out, (m_ + 1) * ptr_type_.size(), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_.size(), out));
+        stream.ind_nmemb_pos = ftell(out);
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(0, out));
+        ROCSPARSEIO_CHECK(fwrite_padding(out, handle->alignment));
+        stream.end_pos = ftell(out);
+        if(stream.nnz_pos < 0 || stream.ind_nmemb_pos < 0 || stream.end_pos < 0)
         {
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ptr_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
+        stream.m           = m_;
+        stream.block_nmemb = block_nmemb_;
+        stream.base        = (base_ == index_base_t::one) ? 1 : 0;
+        stream.ptr_type    = ptr_type_;
+        stream.ind_type    = ind_type_;
+        stream.data_type   = data_type_;
+        return stream_stage_offset(handle, stream.base);
+    }
+
+    //!
+    //! @brief Check the types of a streamed sparse matrix, and open its spool file.
+    //!
+    inline status_t stream_sparse_open(rocsparseio_handle handle,
+                                       format_t           format_,
+                                       type_t             ptr_type_,
+                                       type_t             ind_type_,
+                                       type_t             data_type_,
+                                       index_base_t       base_,
+                                       uint64_t           buffer_size_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle->mode != rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(ptr_type_ != type_t::int32 && ptr_type_ != type_t::int64,
+                              status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(ind_type_ != type_t::int32 && ind_type_ != type_t::int64,
+                              status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(base_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(buffer_size_ < ptr_type_.size(), status_t::invalid_size);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_));
 
+        stream_t& stream  = handle->stream;
+        stream.spool_name = handle->filename + ".spool";
+        stream.spool      = fopen(stream.spool_name.c_str(), "w+b");
+        if(stream.spool == nullptr)
+        {
+            return status_t::invalid_file;
+        }
+        stream.buffer.resize(buffer_size_);
         return status_t::success;
     }
 
-} // namespace rocsparseio
+    //!
+    //! @brief Write the metadata of a streamed sparse matrix in compressed format.
+    //!
+    inline status_t stream_sparse_csx_header(rocsparseio_handle handle,
+                                             direction_t        dir_,
+                                             uint64_t           m_,
+                                             uint64_t           n_,
+                                             type_t             ptr_type_,
+                                             type_t             ind_type_,
+                                             type_t             data_type_,
+                                             index_base_t       base_)
+    {
+        FILE* out = handle->f;
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_csx, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out));
+        handle->stream.nnz_pos = ftell(out);
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(0, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out));
+        return stream_sparse_arrays_header(handle,
+                                           (dir_ == direction_t::row) ? m_ : n_,
+                                           1,
+                                           ptr_type_,
+                                           ind_type_,
+                                           data_type_,
+                                           base_);
+    }
 
-namespace rocsparseio
-{
-    template <>
-    inline type_t type_t::convert<int32_t>()
-    {
-        return type_t::int32;
-    };
-    template <>
-    inline type_t type_t::convert<int64_t>()
-    {
-        return type_t::int64;
-    };
+    //!
+    //! @brief Write the metadata of a streamed sparse matrix in general block compressed format.
+    //!
+    inline status_t stream_sparse_gebsx_header(rocsparseio_handle handle,
+                                               direction_t        dir_,
+                                               direction_t        dirb_,
+                                               uint64_t           mb_,
+                                               uint64_t           nb_,
+                                               uint64_t           row_block_dim_,
+                                               uint64_t           col_block_dim_,
+                                               type_t             ptr_type_,
+                                               type_t             ind_type_,
+                                               type_t             data_type_,
+                                               index_base_t       base_)
+    {
+        FILE* out = handle->f;
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_gebsx, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dirb_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(mb_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nb_, out));
+        handle->stream.nnz_pos = ftell(out);
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(0, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(row_block_dim_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_block_dim_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out));
+        return stream_sparse_arrays_header(handle,
+                                           (dir_ == direction_t::row) ? mb_ : nb_,
+                                           row_block_dim_ * col_block_dim_,
+                                           ptr_type_,
+                                           ind_type_,
+                                           data_type_,
+                                           base_);
+    }
 
-    template <>
-    inline type_t type_t::convert<float>()
-    {
-        return type_t::float32;
-    };
-    template <>
-    inline type_t type_t::convert<double>()
-    {
-        return type_t::float64;
-    };
+    //!
+    //! @brief Start writing a sparse matrix in compressed format by batches of rows (or
+    //! columns), the number of non-zeros is not known in advance. At most \p buffer_size_ bytes
+    //! are staged, in addition to the stdio buffers.
+    //! @note The arrays are written without codec.
+    //!
+    inline status_t stream_sparse_csx_begin(rocsparseio_handle handle,
+                                            direction_t        dir_,
+                                            uint64_t           m_,
+                                            uint64_t           n_,
+                                            type_t             ptr_type_,
+                                            type_t             ind_type_,
+                                            type_t             data_type_,
+                                            index_base_t       base_,
+                                            uint64_t           buffer_size_)
+    {
+        ROCSPARSEIO_CHECK_ARG(dir_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK(stream_sparse_open(
+            handle, format_t::sparse_csx, ptr_type_, ind_type_, data_type_, base_, buffer_size_));
+        const status_t status = stream_sparse_csx_header(
+            handle, dir_, m_, n_, ptr_type_, ind_type_, data_type_, base_);
+        if(status != status_t::success)
+        {
+            stream_release(handle);
+            return status;
+        }
+        handle->stream.active = true;
+        return status_t::success;
+    }
 
-    template <typename... Ts>
-    inline status_t read_format(rocsparseio_handle handle, Ts&&... ts)
-    {
-        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_format(handle->f, ts...);
+    //!
+    //! @brief Start writing a sparse matrix in general block compressed format by batches of
+    //! block rows (or block columns), see stream_sparse_csx_begin.
+    //!
+    inline status_t stream_sparse_gebsx_begin(rocsparseio_handle handle,
+                                              direction_t        dir_,
+                                              direction_t        dirb_,
+                                              uint64_t           mb_,
+                                              uint64_t           nb_,
+                                              uint64_t           row_block_dim_,
+                                              uint64_t           col_block_dim_,
+                                              type_t             ptr_type_,
+                                              type_t             ind_type_,
+                                              type_t             data_type_,
+                                              index_base_t       base_,
+                                              uint64_t           buffer_size_)
+    {
+        ROCSPARSEIO_CHECK_ARG(dir_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(dirb_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(row_block_dim_ == 0, status_t::invalid_size);
+        ROCSPARSEIO_CHECK_ARG(col_block_dim_ == 0, status_t::invalid_size);
+        ROCSPARSEIO_CHECK(stream_sparse_open(
+            handle, format_t::sparse_gebsx, ptr_type_, ind_type_, data_type_, base_, buffer_size_));
+        const status_t status = stream_sparse_gebsx_header(handle,
+                                                           dir_,
+                                                           dirb_,
+                                                           mb_,
+                                                           nb_,
+                                                           row_block_dim_,
+                                                           col_block_dim_,
+                                                           ptr_type_,
+                                                           ind_type_,
+                                                           data_type_,
+                                                           base_);
+        if(status != status_t::success)
+        {
+            stream_release(handle);
+            return status;
+        }
+        handle->stream.active = true;
+        return status_t::success;
     }
 
-    inline status_t open(rocsparseio_handle* p_handle, rwmode_t mode, const char* filename, ...)
+    //!
+    //! @brief Append \p nrows_ rows (or block rows), described by \p nrows_ + 1 offsets of the
+    //! type of the matrix offsets relative to \p ptr_[0], and their indices and values.
+    //!
+    inline status_t stream_sparse_rows(rocsparseio_handle handle,
+                                           uint64_t           nrows_,
+                                           const void*        ptr_,
+                                           const void*        ind_,
+                                           const void*        data_)
     {
-        char filename_[512];
-        {
-            va_list args;
-            va_start(args, filename);
-            if(vsnprintf(filename_, 512, filename, args) >= 512)
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        stream_t& stream = handle->stream;
+        ROCSPARSEIO_CHECK_ARG(!stream.active, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(stream.nrows + nrows_ > stream.m, status_t::invalid_size);
+        ROCSPARSEIO_CHECK_ARG(!ptr_, status_t::invalid_pointer);
+
+        const uint64_t begin = offset_at(stream.ptr_type, ptr_, 0);
+        const uint64_t nnz   = offset_at(stream.ptr_type, ptr_, nrows_) - begin;
+        ROCSPARSEIO_CHECK_ARG((nnz > 0) && (!ind_ || !data_), status_t::invalid_pointer);
+        for(uint64_t i = 1; i <= nrows_; ++i)
+        {
+            const uint64_t offset = offset_at(stream.ptr_type, ptr_, i);
+            if(offset < offset_at(stream.ptr_type, ptr_, i - 1))
             {
-                std::cerr << "string is too long and is trucated. " << std::endl;
                 return status_t::invalid_value;
             }
-            va_end(args);
+            ROCSPARSEIO_CHECK(
+                stream_stage_offset(handle, stream.base + stream.nnz + offset - begin));
         }
 
-        rocsparseio_handle h = new _rocsparseio_handle(mode, filename_);
-        p_handle[0]          = h;
-
-        h->f = nullptr;
-        switch(mode)
-        {
-        case rwmode_t::read:
+        ROCSPARSEIO_CHECK(
+            fwrite_bulk(handle->f, ind_, nnz * stream.ind_type.size(), handle->engine));
+        ROCSPARSEIO_CHECK(fwrite_bulk(stream.spool,
+                                      data_,
+                                      nnz * stream.block_nmemb * stream.data_type.size(),
+                                      handle->engine));
+        stream.end_pos = ftell(handle->f);
+        if(stream.end_pos < 0)
         {
-            h->f = fopen(filename_, "rb");
-            if(h->f == nullptr)
-            {
-                return status_t::invalid_file;
-            }
-
-            {
-                uint64_t ref_value[2]{};
-                char*    p = (char*)&ref_value[0];
-                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
-                uint64_t value[2]{};
-                if(2 != fread(&value[0], sizeof(uint64_t), 2, h->f))
-                {
-                    return status_t::invalid_file_operation;
-                }
-                //	    std::cout << "read " << value[0] << " " << value[1] <<
-                //std::endl;
-                if(ref_value[0] != value[0] || ref_value[1] != value[1])
-                {
-                    std::cerr << "incompatible rocsparseio version: " << std::endl;
-                    std::cerr << "   expected      : " << ref_value[0] << "." << ref_value[1]
-                              << std::endl;
-                    std::cerr << "   from file     : " << value[0] << "." << value[1] << std::endl;
-                    return status_t::invalid_file;
-                }
-            }
-
-            break;
+            return status_t::invalid_file_operation;
         }
+        stream.nrows += nrows_;
+        stream.nnz += nnz;
+        return status_t::success;
+    }
 
-        case rwmode_t::write:
+    //!
+    //! @brief Write the remaining offsets, copy the values after the indices and patch the
+    //! number of non-zeros, all the rows must have been appended.
+    //!
+    inline status_t stream_sparse_finish(rocsparseio_handle handle)
+    {
+        stream_t& stream = handle->stream;
+        FILE*     out    = handle->f;
+        if(stream.nrows != stream.m)
         {
+            return status_t::invalid_size;
+        }
+        ROCSPARSEIO_CHECK(stream_flush_offsets(handle));
 
-            h->f = fopen(filename_, "wb");
-            if(h->f == nullptr)
-            {
-                return status_t::invalid_file;
-            }
-
-            //
-            // WRITE HEADER
-            //
-            {
-                uint64_t value[2]{};
-                char*    p = (char*)&value;
-                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
-                if(2 != fwrite(&value[0], sizeof(uint64_t), 2, h->f))
-                {
-                    return status_t::invalid_file_operation;
-                }
-            }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.data_type.size(), out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.nnz * stream.block_nmemb, out));
+        ROCSPARSEIO_CHECK(fwrite_padding(out, handle->alignment));
+        if(0 != fflush(stream.spool) || 0 != fseek(stream.spool, 0, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        uint64_t remaining = stream.nnz * stream.block_nmemb * stream.data_type.size();
+        while(remaining > 0)
+        {
+            const uint64_t n = std::min(remaining, (uint64_t)stream.buffer.size());
+            ROCSPARSEIO_CHECK(fread_data(stream.spool, 1, n, stream.buffer.data()));
+            ROCSPARSEIO_CHECK(fwrite_bulk(out, stream.buffer.data(), n, handle->engine));
+            remaining -= n;
+        }
 
-            break;
+        const long end_pos = ftell(out);
+        if(end_pos < 0 || 0 != fseek(out, stream.nnz_pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.nnz, out));
+        if(0 != fseek(out, stream.ind_nmemb_pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
         }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.nnz, out));
+        if(0 != fseek(out, end_pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
         }
         return status_t::success;
     }
 
+    inline status_t stream_sparse_end(rocsparseio_handle handle)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(!handle->stream.active, status_t::invalid_mode);
+        const status_t status = stream_sparse_finish(handle);
+        stream_release(handle);
+        return status;
+    }
+
     //!
     //! @brief Close.
     //!
     inline status_t close(rocsparseio_handle handle)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        status_t status = status_t::success;
+        if(handle->stream.active)
+        {
+            status = stream_sparse_end(handle);
+        }
+        if(handle->mode == rwmode_t::write && handle->revision >= layout_revision_archive)
+        {
+            const status_t toc_status = fwrite_toc(handle);
+            status = (status == status_t::success) ? toc_status : status;
+        }
+#ifndef WIN32
+        if(handle->map != nullptr)
+        {
+            munmap((void*)handle->map, handle->map_size);
+        }
+#endif
         if(handle->f != nullptr)
         {
             fclose(handle->f);
         }
         delete handle;
-        return status_t::success;
+        return status;
     }
 
     template <typename... Ts>
     inline status_t write_dense_vector(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fwrite_dense_vector(handle->f, ts...);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::dense_vector));
+        return fwrite_dense_vector(handle->f, ts..., handle->engine);
     }
 
     template <typename... Ts>
     inline status_t read_dense_vector(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_dense_vector(handle->f, ts...);
+        return fread_dense_vector(handle->f, ts..., handle->engine);
     }
 
     template <typename... Ts>
@@ -1438,7 +3442,8 @@ namespace rocsparseio
     inline status_t write_dense_matrix(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fwrite_dense_matrix(handle->f, ts...);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::dense_matrix));
+        return fwrite_dense_matrix(handle->f, ts..., handle->engine);
     }
 
     template <typename... Ts>
@@ -1452,7 +3457,7 @@ namespace rocsparseio
     inline status_t read_dense_matrix(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_dense_matrix(handle->f, ts...);
+        return fread_dense_matrix(handle->f, ts..., handle->engine);
     }
 
     template <typename T, typename J>
@@ -1461,6 +3466,7 @@ namespace rocsparseio
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
         ROCSPARSEIO_CHECK_ARG(handle->mode != rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::dense_matrix));
         return fwrite_dense_matrix(handle->f,
                                    order_,
                                    static_cast<uint64_t>(m_),
@@ -1468,14 +3474,21 @@ namespace rocsparseio
                                    type_t::convert<T>(),
                                    data_,
                                    (order_ == ROCSPARSEIO_ORDER_ROW) ? static_cast<uint64_t>(n_)
-                                                                     : static_cast<uint64_t>(m_));
+                                                                     : static_cast<uint64_t>(m_),
+                                   handle->engine);
     };
 
     template <typename... Ts>
     inline status_t write_sparse_csx(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fwrite_sparse_csx(handle->f, ts...);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::sparse_csx));
+        return fwrite_sparse_csx(handle->f,
+                                 ts...,
+                                 handle->alignment,
+                                 handle->index_codec,
+                                 handle->value_codec,
+                                 handle->engine);
     }
 
     template <typename... Ts>
@@ -1489,14 +3502,34 @@ namespace rocsparseio
     inline status_t read_sparse_csx(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_sparse_csx(handle->f, ts...);
+        return fread_sparse_csx(handle->f, ts..., handle->alignment, handle->engine);
+    }
+
+    template <typename... Ts>
+    inline status_t read_metadata_sparse_csx_rows(rocsparseio_handle handle, Ts&&... ts)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        return fread_metadata_sparse_csx_rows(handle->f, ts..., handle->alignment);
+    }
+
+    template <typename... Ts>
+    inline status_t read_sparse_csx_rows(rocsparseio_handle handle, Ts&&... ts)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        return fread_sparse_csx_rows(handle->f, ts..., handle->alignment, handle->engine);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_coo(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fwrite_sparse_coo(handle->f, ts...);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::sparse_coo));
+        return fwrite_sparse_coo(handle->f,
+                                 ts...,
+                                 handle->alignment,
+                                 handle->index_codec,
+                                 handle->value_codec,
+                                 handle->engine);
     }
 
     template <typename... Ts>
@@ -1510,14 +3543,20 @@ namespace rocsparseio
     inline status_t read_sparse_coo(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_sparse_coo(handle->f, ts...);
+        return fread_sparse_coo(handle->f, ts..., handle->alignment, handle->engine);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_gebsx(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fwrite_sparse_gebsx(handle->f, ts...);
+        ROCSPARSEIO_CHECK(begin_object(handle, format_t::sparse_gebsx));
+        return fwrite_sparse_gebsx(handle->f,
+                                   ts...,
+                                   handle->alignment,
+                                   handle->index_codec,
+                                   handle->value_codec,
+                                   handle->engine);
     }
 
     template <typename... Ts>
@@ -1531,7 +3570,45 @@ namespace rocsparseio
     inline status_t read_sparse_gebsx(rocsparseio_handle handle, Ts&&... ts)
     {
         ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
-        return fread_sparse_gebsx(handle->f, ts...);
+        return fread_sparse_gebsx(handle->f, ts..., handle->alignment, handle->engine);
+    }
+
+    template <typename... Ts>
+    inline status_t read_metadata_sparse_gebsx_rows(rocsparseio_handle handle, Ts&&... ts)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        return fread_metadata_sparse_gebsx_rows(handle->f, ts..., handle->alignment);
+    }
+
+    template <typename... Ts>
+    inline status_t read_sparse_gebsx_rows(rocsparseio_handle handle, Ts&&... ts)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle, status_t::invalid_handle);
+        return fread_sparse_gebsx_rows(handle->f, ts..., handle->alignment, handle->engine);
+    }
+
+    inline status_t map_sparse_csx(rocsparseio_handle handle,
+                                   const void**       ptr_,
+                                   const void**       ind_,
+                                   const void**       data_)
+    {
+        return map_sparse_arrays(handle, 9, ptr_, ind_, data_);
+    }
+
+    inline status_t map_sparse_coo(rocsparseio_handle handle,
+                                   const void**       row_ind_,
+                                   const void**       col_ind_,
+                                   const void**       data_)
+    {
+        return map_sparse_arrays(handle, 8, row_ind_, col_ind_, data_);
+    }
+
+    inline status_t map_sparse_gebsx(rocsparseio_handle handle,
+                                     const void**       ptr_,
+                                     const void**       ind_,
+                                     const void**       data_)
+    {
+        return map_sparse_arrays(handle, 12, ptr_, ind_, data_);
     }
 
 } // namespace rocsparseio
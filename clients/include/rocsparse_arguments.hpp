@@ -60,6 +60,29 @@ struct Arguments
     rocsparse_int u;
     rocsparse_int uu;
 
+    rocsparse_int rmat_scale;
+    rocsparse_int rmat_edge_factor;
+    uint32_t      rmat_seed;
+    double        rmat_a;
+    double        rmat_b;
+    double        rmat_c;
+    double        rmat_d;
+
+    rocsparse_matrix_rowdist_kind rowdist;
+    rocsparse_int                 rowdist_max;
+    rocsparse_int                 rowdist_bandwidth;
+    uint32_t                      rowdist_seed;
+    double                        rowdist_mean;
+    double                        rowdist_cv;
+    double                        rowdist_clustering;
+
+    rocsparse_matrix_stencil_boundary stencil_boundary;
+    rocsparse_int                     stencil_points;
+    rocsparse_int                     stencil_dof;
+    double                            stencil_ax;
+    double                            stencil_ay;
+    double                            stencil_az;
+
     rocsparse_indextype index_type_I;
     rocsparse_indextype index_type_J;
 
@@ -208,6 +231,26 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(l);
         ROCSPARSE_FORMAT_CHECK(u);
         ROCSPARSE_FORMAT_CHECK(uu);
+        ROCSPARSE_FORMAT_CHECK(rmat_scale);
+        ROCSPARSE_FORMAT_CHECK(rmat_edge_factor);
+        ROCSPARSE_FORMAT_CHECK(rmat_seed);
+        ROCSPARSE_FORMAT_CHECK(rmat_a);
+        ROCSPARSE_FORMAT_CHECK(rmat_b);
+        ROCSPARSE_FORMAT_CHECK(rmat_c);
+        ROCSPARSE_FORMAT_CHECK(rmat_d);
+        ROCSPARSE_FORMAT_CHECK(rowdist);
+        ROCSPARSE_FORMAT_CHECK(rowdist_max);
+        ROCSPARSE_FORMAT_CHECK(rowdist_bandwidth);
+        ROCSPARSE_FORMAT_CHECK(rowdist_seed);
+        ROCSPARSE_FORMAT_CHECK(rowdist_mean);
+        ROCSPARSE_FORMAT_CHECK(rowdist_cv);
+        ROCSPARSE_FORMAT_CHECK(rowdist_clustering);
+        ROCSPARSE_FORMAT_CHECK(stencil_boundary);
+        ROCSPARSE_FORMAT_CHECK(stencil_points);
+        ROCSPARSE_FORMAT_CHECK(stencil_dof);
+        ROCSPARSE_FORMAT_CHECK(stencil_ax);
+        ROCSPARSE_FORMAT_CHECK(stencil_ay);
+        ROCSPARSE_FORMAT_CHECK(stencil_az);
         ROCSPARSE_FORMAT_CHECK(index_type_I);
         ROCSPARSE_FORMAT_CHECK(index_type_J);
         ROCSPARSE_FORMAT_CHECK(a_type);
@@ -447,6 +490,26 @@ private:
         print("l", arg.l);
         print("u", arg.u);
         print("uu", arg.uu);
+        print("rmat_scale", arg.rmat_scale);
+        print("rmat_edge_factor", arg.rmat_edge_factor);
+        print("rmat_seed", arg.rmat_seed);
+        print("rmat_a", arg.rmat_a);
+        print("rmat_b", arg.rmat_b);
+        print("rmat_c", arg.rmat_c);
+        print("rmat_d", arg.rmat_d);
+        print("rowdist", rocsparse_matrix_rowdist_kind2string(arg.rowdist));
+        print("rowdist_max", arg.rowdist_max);
+        print("rowdist_bandwidth", arg.rowdist_bandwidth);
+        print("rowdist_seed", arg.rowdist_seed);
+        print("rowdist_mean", arg.rowdist_mean);
+        print("rowdist_cv", arg.rowdist_cv);
+        print("rowdist_clustering", arg.rowdist_clustering);
+        print("stencil_boundary", rocsparse_matrix_stencil_boundary2string(arg.stencil_boundary));
+        print("stencil_points", arg.stencil_points);
+        print("stencil_dof", arg.stencil_dof);
+        print("stencil_ax", arg.stencil_ax);
+        print("stencil_ay", arg.stencil_ay);
+        print("stencil_az", arg.stencil_az);
         print("alpha", arg.alpha);
         print("alphai", arg.alphai);
         print("beta", arg.beta);
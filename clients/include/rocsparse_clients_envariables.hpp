@@ -79,10 +79,13 @@ struct rocsparse_clients_envariables
     typedef enum var_string_ : int32_t
     {
         MATRICES_DIR,
-        TEST_DATA_DIR
+        TEST_DATA_DIR,
+        MATRICES_CACHE_DIR,
+        MATRICES_CACHE_SIZE
     } var_string;
 
-    static constexpr var_string s_var_string_all[2] = {MATRICES_DIR, TEST_DATA_DIR};
+    static constexpr var_string s_var_string_all[4]
+        = {MATRICES_DIR, TEST_DATA_DIR, MATRICES_CACHE_DIR, MATRICES_CACHE_SIZE};
 
     ///
     /// @brief Return value of a string variable.
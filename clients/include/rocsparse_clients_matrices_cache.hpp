@@ -0,0 +1,91 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+#include <vector>
+
+///
+/// @brief Cache of the CSR matrices parsed from text (or rocALUTION) files.
+///
+/// The cache is enabled by the environment variable ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR,
+/// each entry is a rocSPARSEIO file of this directory keyed by the format, the canonical
+/// path, the size and the modification time of the source file, the index and value types
+/// and the index base. A modified source file is therefore never served from the cache,
+/// its stale entries are reclaimed by the eviction.
+///
+/// The size of the directory is capped by ROCSPARSE_CLIENTS_MATRICES_CACHE_SIZE (in MiB,
+/// @ref ROCSPARSE_CLIENTS_MATRICES_CACHE_DEFAULT_SIZE if undefined), the least recently
+/// used entries are removed when an entry is stored.
+///
+#define ROCSPARSE_CLIENTS_MATRICES_CACHE_DEFAULT_SIZE 4096
+
+///
+/// @brief Is the cache enabled ?
+///
+bool rocsparse_clients_matrices_cache_enabled();
+
+///
+/// @brief Directory of the cache, empty if the cache is disabled.
+///
+const char* rocsparse_clients_matrices_cache_dir_get();
+
+///
+/// @brief Set the directory of the cache in place of ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR,
+/// which is only read once; an empty directory disables the cache.
+///
+void rocsparse_clients_matrices_cache_dir_set(const char* dir);
+
+///
+/// @brief Load a matrix from the cache.
+/// @param format name of the format of the source file, part of the key.
+/// @param filename path of the source file.
+/// @return true on a hit, false if the entry does not exist or cannot be read.
+///
+template <typename I, typename J, typename T>
+bool rocsparse_clients_matrices_cache_load(const char*          format,
+                                           const char*          filename,
+                                           std::vector<I>&      row_ptr,
+                                           std::vector<J>&      col_ind,
+                                           std::vector<T>&      val,
+                                           J&                   M,
+                                           J&                   N,
+                                           I&                   nnz,
+                                           rocsparse_index_base base);
+
+///
+/// @brief Store a matrix parsed from a source file into the cache.
+/// @note Failures are reported on the standard error and otherwise ignored.
+///
+template <typename I, typename J, typename T>
+void rocsparse_clients_matrices_cache_store(const char*           format,
+                                            const char*           filename,
+                                            const std::vector<I>& row_ptr,
+                                            const std::vector<J>& col_ind,
+                                            const std::vector<T>& val,
+                                            J                     M,
+                                            J                     N,
+                                            I                     nnz,
+                                            rocsparse_index_base  base);
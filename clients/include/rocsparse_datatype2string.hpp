@@ -49,6 +49,48 @@ constexpr auto rocsparse_matrix_init_kind2string(rocsparse_matrix_init_kind matr
     return "invalid";
 }
 
+typedef enum rocsparse_matrix_rowdist_kind_
+{
+    rocsparse_matrix_rowdist_kind_uniform   = 0, /**< Uniform row lengths */
+    rocsparse_matrix_rowdist_kind_normal    = 1, /**< Normal row lengths */
+    rocsparse_matrix_rowdist_kind_lognormal = 2, /**< Log-normal row lengths */
+    rocsparse_matrix_rowdist_kind_zipf      = 3 /**< Power-law (Zipf) row lengths */
+} rocsparse_matrix_rowdist_kind;
+
+constexpr auto rocsparse_matrix_rowdist_kind2string(rocsparse_matrix_rowdist_kind rowdist)
+{
+    switch(rowdist)
+    {
+    case rocsparse_matrix_rowdist_kind_uniform:
+        return "uniform";
+    case rocsparse_matrix_rowdist_kind_normal:
+        return "normal";
+    case rocsparse_matrix_rowdist_kind_lognormal:
+        return "lognormal";
+    case rocsparse_matrix_rowdist_kind_zipf:
+        return "zipf";
+    }
+    return "invalid";
+}
+
+typedef enum rocsparse_matrix_stencil_boundary_
+{
+    rocsparse_matrix_stencil_boundary_dirichlet = 0, /**< Dirichlet boundary conditions */
+    rocsparse_matrix_stencil_boundary_periodic  = 1 /**< Periodic boundary conditions */
+} rocsparse_matrix_stencil_boundary;
+
+constexpr auto rocsparse_matrix_stencil_boundary2string(rocsparse_matrix_stencil_boundary boundary)
+{
+    switch(boundary)
+    {
+    case rocsparse_matrix_stencil_boundary_dirichlet:
+        return "dirichlet";
+    case rocsparse_matrix_stencil_boundary_periodic:
+        return "periodic";
+    }
+    return "invalid";
+}
+
 typedef enum rocsparse_matrix_init_
 {
     rocsparse_matrix_random           = 0, /**< Random initialization */
@@ -61,7 +103,10 @@ typedef enum rocsparse_matrix_init_
     rocsparse_matrix_zero             = 7, /**< Generates zero matrix */
     rocsparse_matrix_file_rocsparseio = 8, /**< Read from rocsparseio file */
     rocsparse_matrix_tridiagonal      = 9, /**< Initialize tridiagonal matrix */
-    rocsparse_matrix_pentadiagonal    = 10 /**< Initialize pentadiagonal matrix */
+    rocsparse_matrix_pentadiagonal    = 10, /**< Initialize pentadiagonal matrix */
+    rocsparse_matrix_rmat             = 11, /**< Initialize R-MAT (power-law) matrix */
+    rocsparse_matrix_rowdist          = 12, /**< Initialize matrix with given row lengths */
+    rocsparse_matrix_stencil          = 13 /**< Initialize multi-DOF stencil matrix */
 } rocsparse_matrix_init;
 
 constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
@@ -90,6 +135,12 @@ constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
         return "tri";
     case rocsparse_matrix_pentadiagonal:
         return "penta";
+    case rocsparse_matrix_rmat:
+        return "rmat";
+    case rocsparse_matrix_rowdist:
+        return "rowdist";
+    case rocsparse_matrix_stencil:
+        return "stencil";
     }
     return "invalid";
 }
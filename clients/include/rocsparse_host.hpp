@@ -309,6 +309,42 @@ void host_cscmv(rocsparse_operation trans,
                 rocsparse_matrix_type matrix_type,
                 rocsparse_spmv_alg    algo);
 
+/*! \brief Structure analysis of a sparse triangular matrix for the host solvers.
+ *
+ *  Rows are grouped into levels, such that each row only depends on rows of previous
+ *  levels. All rows of a level can then be processed in parallel. The analysis only
+ *  depends on the sparsity pattern and can be re-used for any number of right-hand
+ *  sides and repeated solves with updated values.
+ */
+template <typename I, typename J>
+struct host_trm_info
+{
+    rocsparse_operation trans{rocsparse_operation_none};
+    rocsparse_fill_mode fill_mode{rocsparse_fill_mode_lower};
+
+    J m{};
+    I nnz{};
+
+    // Rows sorted by level, rows of level l are level_row[level_ptr[l]:level_ptr[l + 1]]
+    std::vector<J> level_ptr;
+    std::vector<J> level_row;
+
+    // Transposed pattern and value permutation, only used if trans != none
+    std::vector<I> trmt_row_ptr;
+    std::vector<J> trmt_col_ind;
+    std::vector<I> trmt_perm;
+};
+
+template <typename I, typename J>
+void host_trm_analysis(rocsparse_operation  trans,
+                       J                    M,
+                       I                    nnz,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
+                       rocsparse_fill_mode  fill_mode,
+                       rocsparse_index_base base,
+                       host_trm_info<I, J>& info);
+
 template <typename I, typename J, typename T>
 void host_csrsv(rocsparse_operation  trans,
                 J                    M,
@@ -326,6 +362,20 @@ void host_csrsv(rocsparse_operation  trans,
                 J*                   struct_pivot,
                 J*                   numeric_pivot);
 
+template <typename I, typename J, typename T>
+void host_csrsv(const host_trm_info<I, J>& info,
+                T                          alpha,
+                const I*                   csr_row_ptr,
+                const J*                   csr_col_ind,
+                const T*                   csr_val,
+                const T*                   x,
+                int64_t                    x_inc,
+                T*                         y,
+                rocsparse_diag_type        diag_type,
+                rocsparse_index_base       base,
+                J*                         struct_pivot,
+                J*                         numeric_pivot);
+
 template <typename I, typename T>
 void host_coosv(rocsparse_operation  trans,
                 I                    M,
@@ -607,6 +657,22 @@ void host_csrsm(J                    M,
                 J*                   struct_pivot,
                 J*                   numeric_pivot);
 
+template <typename I, typename J, typename T>
+void host_csrsm(const host_trm_info<I, J>& info,
+                J                          nrhs,
+                rocsparse_operation        transB,
+                T                          alpha,
+                const I*                   csr_row_ptr,
+                const J*                   csr_col_ind,
+                const T*                   csr_val,
+                T*                         B,
+                int64_t                    ldb,
+                rocsparse_order            order_B,
+                rocsparse_diag_type        diag_type,
+                rocsparse_index_base       base,
+                J*                         struct_pivot,
+                J*                         numeric_pivot);
+
 template <typename I, typename T>
 void host_coosm(I                    M,
                 I                    nrhs,
@@ -842,6 +908,20 @@ void host_bsric0(rocsparse_direction               direction,
                  rocsparse_int*                    struct_pivot,
                  rocsparse_int*                    numeric_pivot);
 
+// Level scheduled incomplete factorizations. info is the analysis of the lower triangular
+// part of the (block) sparsity pattern, obtained by host_trm_analysis() with
+// rocsparse_operation_none and rocsparse_fill_mode_lower, and can be shared with host_csrsv().
+template <typename T>
+void host_bsric0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                 rocsparse_direction                                direction,
+                 rocsparse_int                                      block_dim,
+                 const std::vector<rocsparse_int>&                  bsr_row_ptr,
+                 const std::vector<rocsparse_int>&                  bsr_col_ind,
+                 std::vector<T>&                                    bsr_val,
+                 rocsparse_index_base                               base,
+                 rocsparse_int*                                     struct_pivot,
+                 rocsparse_int*                                     numeric_pivot);
+
 template <typename T, typename U>
 void host_bsrilu0(rocsparse_direction               dir,
                   rocsparse_int                     mb,
@@ -856,6 +936,20 @@ void host_bsrilu0(rocsparse_direction               dir,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T, typename U>
+void host_bsrilu0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                  rocsparse_direction                                dir,
+                  const std::vector<rocsparse_int>&                  bsr_row_ptr,
+                  const std::vector<rocsparse_int>&                  bsr_col_ind,
+                  std::vector<T>&                                    bsr_val,
+                  rocsparse_int                                      bsr_dim,
+                  rocsparse_index_base                               base,
+                  rocsparse_int*                                     struct_pivot,
+                  rocsparse_int*                                     numeric_pivot,
+                  bool                                               boost,
+                  U                                                  boost_tol,
+                  T                                                  boost_val);
+
 template <typename T>
 void host_csric0(rocsparse_int                     M,
                  const std::vector<rocsparse_int>& csr_row_ptr,
@@ -867,6 +961,17 @@ void host_csric0(rocsparse_int                     M,
                  rocsparse_int*                    singular_pivot,
                  double                            tol);
 
+template <typename T>
+void host_csric0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                 const std::vector<rocsparse_int>&                  csr_row_ptr,
+                 const std::vector<rocsparse_int>&                  csr_col_ind,
+                 std::vector<T>&                                    csr_val,
+                 rocsparse_index_base                               base,
+                 rocsparse_int*                                     struct_pivot,
+                 rocsparse_int*                                     numeric_pivot,
+                 rocsparse_int*                                     singular_pivot,
+                 double                                             tol);
+
 template <typename T, typename U>
 void host_csrilu0(rocsparse_int                     M,
                   const std::vector<rocsparse_int>& csr_row_ptr,
@@ -881,6 +986,20 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T, typename U>
+void host_csrilu0(const host_trm_info<rocsparse_int, rocsparse_int>& info,
+                  const std::vector<rocsparse_int>&                  csr_row_ptr,
+                  const std::vector<rocsparse_int>&                  csr_col_ind,
+                  std::vector<T>&                                    csr_val,
+                  rocsparse_index_base                               base,
+                  rocsparse_int*                                     struct_pivot,
+                  rocsparse_int*                                     numeric_pivot,
+                  rocsparse_int*                                     singular_pivot,
+                  double                                             tol,
+                  bool                                               boost,
+                  U                                                  boost_tol,
+                  T                                                  boost_val);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -1034,6 +1153,23 @@ void host_csr_to_csc(J                    M,
                      rocsparse_action     action,
                      rocsparse_index_base base);
 
+// Transposes the sparsity pattern of a CSR matrix (or the block pattern of a BSR matrix), where
+// perm[k] holds the (zero based) position of the k-th CSC entry within the CSR arrays. The
+// values can then be transposed by a single gather with host_csr_to_csc_values.
+template <typename I, typename J>
+void host_csr_to_csc_pattern(J                    M,
+                             J                    N,
+                             I                    nnz,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             std::vector<J>&      csc_row_ind,
+                             std::vector<I>&      csc_col_ptr,
+                             std::vector<I>&      perm,
+                             rocsparse_index_base base);
+
+template <typename I, typename T>
+void host_csr_to_csc_values(I nnz, const I* perm, const T* csr_val, T* csc_val);
+
 template <typename T>
 void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
@@ -1247,4 +1383,13 @@ void host_coosort_by_column(rocsparse_int               M,
                             std::vector<rocsparse_int>& coo_col_ind,
                             std::vector<T>&             coo_val);
 
+// Computes the permutation that sorts the COO entries by primary_ind and then by secondary_ind,
+// using a stable parallel LSD radix sort whose digits cover only the index range that is
+// actually present.
+template <typename I, typename J>
+void host_coosort_permutation(I               nnz,
+                              const J*        primary_ind,
+                              const J*        secondary_ind,
+                              std::vector<I>& perm);
+
 #endif // ROCSPARSE_HOST_HPP
@@ -0,0 +1,238 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \brief CPU execution backend of the generic API.
+ *
+ *  The functions below mirror the generic rocSPARSE API on host memory and are executed by
+ *  the reference engine (rocsparse_host.cpp), parallelized with OpenMP when available. They
+ *  follow the staging of their device counterparts (buffer size, preprocess / analysis,
+ *  compute), such that an application pipeline can be exercised on machines without a GPU.
+ *  Scalars are always read from host memory. Compute type and data types of all operands
+ *  have to be equal. The host kernels do not use temporary storage: the buffer size stages
+ *  report 0 bytes and \p temp_buffer is not accessed, except for the dense conversions below.
+ *
+ *  The backend uses its own descriptors, prefixed with rocsparse_host, which do not interfere
+ *  with the device descriptors when both are used in the same application.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_HOST_GENERIC_HPP
+#define ROCSPARSE_HOST_GENERIC_HPP
+
+#include <rocsparse.h>
+
+typedef struct _rocsparse_host_spmat_descr* rocsparse_host_spmat_descr;
+typedef struct _rocsparse_host_dnvec_descr* rocsparse_host_dnvec_descr;
+typedef struct _rocsparse_host_dnmat_descr* rocsparse_host_dnmat_descr;
+
+/*
+ * ===========================================================================
+ *    descriptors
+ * ===========================================================================
+ */
+rocsparse_status rocsparse_host_create_coo_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       coo_row_ind,
+                                                 void*                       coo_col_ind,
+                                                 void*                       coo_val,
+                                                 rocsparse_indextype         idx_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type);
+
+rocsparse_status rocsparse_host_create_csr_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       csr_row_ptr,
+                                                 void*                       csr_col_ind,
+                                                 void*                       csr_val,
+                                                 rocsparse_indextype         row_ptr_type,
+                                                 rocsparse_indextype         col_ind_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type);
+
+rocsparse_status rocsparse_host_create_csc_descr(rocsparse_host_spmat_descr* descr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     nnz,
+                                                 void*                       csc_col_ptr,
+                                                 void*                       csc_row_ind,
+                                                 void*                       csc_val,
+                                                 rocsparse_indextype         col_ptr_type,
+                                                 rocsparse_indextype         row_ind_type,
+                                                 rocsparse_index_base        idx_base,
+                                                 rocsparse_datatype          data_type);
+
+rocsparse_status rocsparse_host_destroy_spmat_descr(rocsparse_host_spmat_descr descr);
+
+rocsparse_status rocsparse_host_spmat_get_size(rocsparse_host_spmat_descr descr,
+                                               int64_t*                   rows,
+                                               int64_t*                   cols,
+                                               int64_t*                   nnz);
+
+rocsparse_status rocsparse_host_coo_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      coo_row_ind,
+                                                 void*                      coo_col_ind,
+                                                 void*                      coo_val);
+
+rocsparse_status rocsparse_host_csr_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      csr_row_ptr,
+                                                 void*                      csr_col_ind,
+                                                 void*                      csr_val);
+
+rocsparse_status rocsparse_host_csc_set_pointers(rocsparse_host_spmat_descr descr,
+                                                 void*                      csc_col_ptr,
+                                                 void*                      csc_row_ind,
+                                                 void*                      csc_val);
+
+rocsparse_status rocsparse_host_spmat_set_attribute(rocsparse_host_spmat_descr descr,
+                                                    rocsparse_spmat_attribute  attribute,
+                                                    const void*                data,
+                                                    size_t                     data_size);
+
+rocsparse_status rocsparse_host_create_dnvec_descr(rocsparse_host_dnvec_descr* descr,
+                                                   int64_t                     size,
+                                                   void*                       values,
+                                                   rocsparse_datatype          data_type);
+
+rocsparse_status rocsparse_host_destroy_dnvec_descr(rocsparse_host_dnvec_descr descr);
+
+rocsparse_status rocsparse_host_create_dnmat_descr(rocsparse_host_dnmat_descr* descr,
+                                                   int64_t                     rows,
+                                                   int64_t                     cols,
+                                                   int64_t                     ld,
+                                                   void*                       values,
+                                                   rocsparse_datatype          data_type,
+                                                   rocsparse_order             order);
+
+rocsparse_status rocsparse_host_destroy_dnmat_descr(rocsparse_host_dnmat_descr descr);
+
+/*
+ * ===========================================================================
+ *    generic SPARSE
+ * ===========================================================================
+ */
+
+/*! \brief Host SpMV, y := alpha * op(A) * x + beta * y for COO, CSR and CSC matrices. */
+rocsparse_status rocsparse_host_spmv(rocsparse_operation        trans,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat,
+                                     rocsparse_host_dnvec_descr x,
+                                     const void*                beta,
+                                     rocsparse_host_dnvec_descr y,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spmv_alg         alg,
+                                     rocsparse_spmv_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer);
+
+/*! \brief Host SpMM, C := alpha * op(A) * op(B) + beta * C for COO, CSR and CSC matrices. */
+rocsparse_status rocsparse_host_spmm(rocsparse_operation        trans_A,
+                                     rocsparse_operation        trans_B,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat_A,
+                                     rocsparse_host_dnmat_descr mat_B,
+                                     const void*                beta,
+                                     rocsparse_host_dnmat_descr mat_C,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spmm_alg         alg,
+                                     rocsparse_spmm_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer);
+
+/*! \brief Host SpSV, op(A) * y = alpha * x for COO and CSR matrices.
+ *
+ *  The preprocess stage of a CSR matrix performs the level analysis of the triangular
+ *  pattern, which is kept in the matrix descriptor and re-used by all subsequent solves.
+ */
+rocsparse_status rocsparse_host_spsv(rocsparse_operation        trans,
+                                     const void*                alpha,
+                                     rocsparse_host_spmat_descr mat,
+                                     rocsparse_host_dnvec_descr x,
+                                     rocsparse_host_dnvec_descr y,
+                                     rocsparse_datatype         compute_type,
+                                     rocsparse_spsv_alg         alg,
+                                     rocsparse_spsv_stage       stage,
+                                     size_t*                    buffer_size,
+                                     void*                      temp_buffer);
+
+/*! \brief Host SpGEMM, C := alpha * A * B + beta * D for CSR matrices.
+ *
+ *  The nnz stage computes the row pointer array of C and updates its number of non-zeros,
+ *  the compute (or symbolic and numeric) stage fills its column indices and values.
+ *  All operands have to use the offset and index types of C, and transposed operands are
+ *  not supported; rocsparse_status_not_implemented is returned otherwise.
+ */
+rocsparse_status rocsparse_host_spgemm(rocsparse_operation        trans_A,
+                                       rocsparse_operation        trans_B,
+                                       const void*                alpha,
+                                       rocsparse_host_spmat_descr A,
+                                       rocsparse_host_spmat_descr B,
+                                       const void*                beta,
+                                       rocsparse_host_spmat_descr D,
+                                       rocsparse_host_spmat_descr C,
+                                       rocsparse_datatype         compute_type,
+                                       rocsparse_spgemm_alg       alg,
+                                       rocsparse_spgemm_stage     stage,
+                                       size_t*                    buffer_size,
+                                       void*                      temp_buffer);
+
+/*! \brief Host conversion of a COO, CSR or CSC matrix into a dense matrix.
+ *
+ *  As for the device routine, the call with a nullptr \p temp_buffer returns the buffer size.
+ *  The buffer size is a single byte, which is never accessed.
+ */
+rocsparse_status rocsparse_host_sparse_to_dense(rocsparse_host_spmat_descr    mat_A,
+                                                rocsparse_host_dnmat_descr    mat_B,
+                                                rocsparse_sparse_to_dense_alg alg,
+                                                size_t*                       buffer_size,
+                                                void*                         temp_buffer);
+
+/*! \brief Host conversion of a dense matrix into a COO, CSR or CSC matrix.
+ *
+ *  As for the device routine, the call with a nullptr \p temp_buffer returns the buffer size,
+ *  the call with a valid \p buffer_size and \p temp_buffer determines the number of non-zeros
+ *  (and the offsets of a CSR or CSC matrix), the call with a nullptr \p buffer_size fills the
+ *  remaining arrays. The buffer size is a single byte, which is never accessed.
+ */
+rocsparse_status rocsparse_host_dense_to_sparse(rocsparse_host_dnmat_descr    mat_A,
+                                                rocsparse_host_spmat_descr    mat_B,
+                                                rocsparse_dense_to_sparse_alg alg,
+                                                size_t*                       buffer_size,
+                                                void*                         temp_buffer);
+
+/*! \brief Host conversion between the CSR, CSC and (row sorted) COO formats.
+ *
+ *  The analysis stage sets the number of non-zeros of \p target, the compute stage fills
+ *  its arrays. CSR to CSC and CSC to CSR conversions are stable.
+ */
+rocsparse_status rocsparse_host_sparse_to_sparse(rocsparse_host_spmat_descr       source,
+                                                 rocsparse_host_spmat_descr       target,
+                                                 rocsparse_sparse_to_sparse_stage stage,
+                                                 size_t*                          buffer_size,
+                                                 void*                            temp_buffer);
+
+#endif // ROCSPARSE_HOST_GENERIC_HPP
@@ -537,4 +537,207 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                         J                    u,
                                         J                    uu);
 
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in CSR format.
+ *  \details edge_factor * M edges are drawn with the probabilities (a, b, c, d) of the 2x2
+ *  Kronecker seed, normalized by their sum, duplicated edges are merged. The matrix only depends
+ *  on its parameters and on seed, not on the number of threads. */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rmat(std::vector<I>&      row_ptr,
+                             std::vector<J>&      col_ind,
+                             std::vector<T>&      val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             J                    edge_factor,
+                             double               a,
+                             double               b,
+                             double               c,
+                             double               d,
+                             uint64_t             seed,
+                             bool                 full_rank = false,
+                             bool                 to_int    = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_rmat(std::vector<I>&      row_ind,
+                             std::vector<I>&      col_ind,
+                             std::vector<T>&      val,
+                             I                    M,
+                             I                    N,
+                             int64_t&             nnz,
+                             rocsparse_index_base base,
+                             I                    edge_factor,
+                             double               a,
+                             double               b,
+                             double               c,
+                             double               d,
+                             uint64_t             seed,
+                             bool                 full_rank = false,
+                             bool                 to_int    = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (power-law) sparse matrix in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rmat(std::vector<I>&      row_ptr,
+                               std::vector<J>&      col_ind,
+                               std::vector<T>&      val,
+                               J                    Mb,
+                               J                    Nb,
+                               I&                   nnzb,
+                               J                    row_block_dim,
+                               J                    col_block_dim,
+                               rocsparse_index_base base,
+                               J                    edge_factor,
+                               double               a,
+                               double               b,
+                               double               c,
+                               double               d,
+                               uint64_t             seed,
+                               bool                 to_int = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the row lengths in CSR
+ *  format.
+ *  \details The row lengths are drawn independently from the distribution family of mean mean
+ *  and of coefficient of variation cv, rounded and clamped to max_length (if positive) and to
+ *  the columns available to the row. The columns of the row i are drawn within bandwidth of
+ *  the diagonal i * N / M (if positive), clustering in [0, 1] groups them in runs of
+ *  consecutive columns, from scattered columns (0) to a single dense run (1). Negative
+ *  lengths are clamped to 0, which raises the mean of the uniform and normal families with a
+ *  large cv. The matrix only depends on its parameters and on seed, not on the number of
+ *  threads. */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rowdist(std::vector<I>&               row_ptr,
+                                std::vector<J>&               col_ind,
+                                std::vector<T>&               val,
+                                J                             M,
+                                J                             N,
+                                I&                            nnz,
+                                rocsparse_index_base          base,
+                                rocsparse_matrix_rowdist_kind family,
+                                double                        mean,
+                                double                        cv,
+                                J                             max_length,
+                                J                             bandwidth,
+                                double                        clustering,
+                                uint64_t                      seed,
+                                bool                          full_rank = false,
+                                bool                          to_int    = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the row lengths in COO
+ *  format */
+template <typename I, typename T>
+void rocsparse_init_coo_rowdist(std::vector<I>&               row_ind,
+                                std::vector<I>&               col_ind,
+                                std::vector<T>&               val,
+                                I                             M,
+                                I                             N,
+                                int64_t&                      nnz,
+                                rocsparse_index_base          base,
+                                rocsparse_matrix_rowdist_kind family,
+                                double                        mean,
+                                double                        cv,
+                                I                             max_length,
+                                I                             bandwidth,
+                                double                        clustering,
+                                uint64_t                      seed,
+                                bool                          full_rank = false,
+                                bool                          to_int    = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with a given distribution of the block row lengths in
+ *  GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rowdist(std::vector<I>&               row_ptr,
+                                  std::vector<J>&               col_ind,
+                                  std::vector<T>&               val,
+                                  J                             Mb,
+                                  J                             Nb,
+                                  I&                            nnzb,
+                                  J                             row_block_dim,
+                                  J                             col_block_dim,
+                                  rocsparse_index_base          base,
+                                  rocsparse_matrix_rowdist_kind family,
+                                  double                        mean,
+                                  double                        cv,
+                                  J                             max_length,
+                                  J                             bandwidth,
+                                  double                        clustering,
+                                  uint64_t                      seed,
+                                  bool                          to_int = false);
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in CSR format.
+ *  \details The grid of dim_x x dim_y x dim_z nodes (dim_z may be 0 for 2D grids) is
+ *  discretized by the 5 or 9-point (2D) or by the 7, 19 or 27-point (3D) stencil, the
+ *  couplings along the axes are weighted by the anisotropy coefficients ax, ay and az and the
+ *  boundaries are either Dirichlet or periodic. Each node carries dof degrees of freedom
+ *  coupled by a dense dof x dof matrix, the rows of a node are consecutive. */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_stencil(std::vector<I>&                   row_ptr,
+                                std::vector<J>&                   col_ind,
+                                std::vector<T>&                   val,
+                                J&                                M,
+                                J&                                N,
+                                I&                                nnz,
+                                rocsparse_index_base              base,
+                                int32_t                           dim_x,
+                                int32_t                           dim_y,
+                                int32_t                           dim_z,
+                                int32_t                           points,
+                                J                                 dof,
+                                rocsparse_matrix_stencil_boundary boundary,
+                                double                            ax,
+                                double                            ay,
+                                double                            az);
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in COO format. */
+template <typename I, typename T>
+void rocsparse_init_coo_stencil(std::vector<I>&                   row_ind,
+                                std::vector<I>&                   col_ind,
+                                std::vector<T>&                   val,
+                                I&                                M,
+                                I&                                N,
+                                int64_t&                          nnz,
+                                rocsparse_index_base              base,
+                                int32_t                           dim_x,
+                                int32_t                           dim_y,
+                                int32_t                           dim_z,
+                                int32_t                           points,
+                                I                                 dof,
+                                rocsparse_matrix_stencil_boundary boundary,
+                                double                            ax,
+                                double                            ay,
+                                double                            az);
+
+/* ==================================================================================== */
+/*! \brief  Generate a multi-DOF stencil matrix in GEBSR format.
+ *  \details The matrix is assembled directly with one block row per node and dense
+ *  dof x dof blocks, row_block_dim and col_block_dim are set to dof. */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_stencil(std::vector<I>&                   row_ptr,
+                                  std::vector<J>&                   col_ind,
+                                  std::vector<T>&                   val,
+                                  rocsparse_direction               dirb,
+                                  J&                                Mb,
+                                  J&                                Nb,
+                                  I&                                nnzb,
+                                  J&                                row_block_dim,
+                                  J&                                col_block_dim,
+                                  rocsparse_index_base              base,
+                                  int32_t                           dim_x,
+                                  int32_t                           dim_y,
+                                  int32_t                           dim_z,
+                                  int32_t                           points,
+                                  J                                 dof,
+                                  rocsparse_matrix_stencil_boundary boundary,
+                                  double                            ax,
+                                  double                            ay,
+                                  double                            az);
+
 #endif // ROCSPARSE_INIT_HPP
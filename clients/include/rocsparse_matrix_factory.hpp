@@ -36,6 +36,9 @@ std::string rocsparse_exepath();
 #include "rocsparse_matrix_factory_laplace3d.hpp"
 #include "rocsparse_matrix_factory_pentadiagonal.hpp"
 #include "rocsparse_matrix_factory_random.hpp"
+#include "rocsparse_matrix_factory_rmat.hpp"
+#include "rocsparse_matrix_factory_rowdist.hpp"
+#include "rocsparse_matrix_factory_stencil.hpp"
 #include "rocsparse_matrix_factory_tridiagonal.hpp"
 #include "rocsparse_matrix_factory_zero.hpp"
 
@@ -0,0 +1,102 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_FACTORY_ROWDIST_HPP
+#define ROCSPARSE_MATRIX_FACTORY_ROWDIST_HPP
+
+#include "rocsparse_matrix_factory_base.hpp"
+
+//
+// Row length distribution factory, the lengths of the rows are drawn independently from a
+// distribution family (uniform, normal, log-normal or Zipf) of given mean and coefficient
+// of variation, capped by max_length if positive. The columns of a row are drawn within
+// bandwidth of the diagonal if positive, clustering in [0, 1] groups them in runs of
+// consecutive columns.
+//
+// The matrix only depends on the parameters and on seed.
+//
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+struct rocsparse_matrix_factory_rowdist : public rocsparse_matrix_factory_base<T, I, J>
+{
+private:
+    rocsparse_matrix_rowdist_kind m_family;
+    double                        m_mean;
+    double                        m_cv;
+    J                             m_max_length;
+    J                             m_bandwidth;
+    double                        m_clustering;
+    uint64_t                      m_seed;
+    bool                          m_fullrank;
+    bool                          m_to_int;
+
+public:
+    rocsparse_matrix_factory_rowdist(rocsparse_matrix_rowdist_kind family,
+                                     double                        mean,
+                                     double                        cv,
+                                     J                             max_length,
+                                     J                             bandwidth,
+                                     double                        clustering,
+                                     uint64_t                      seed,
+                                     bool                          fullrank = false,
+                                     bool                          to_int   = false);
+
+    virtual void init_csr(std::vector<I>&        csr_row_ptr,
+                          std::vector<J>&        csr_col_ind,
+                          std::vector<T>&        csr_val,
+                          J&                     M,
+                          J&                     N,
+                          I&                     nnz,
+                          rocsparse_index_base   base,
+                          rocsparse_matrix_type  matrix_type,
+                          rocsparse_fill_mode    uplo,
+                          rocsparse_storage_mode storage) override;
+
+    virtual void init_gebsr(std::vector<I>&        bsr_row_ptr,
+                            std::vector<J>&        bsr_col_ind,
+                            std::vector<T>&        bsr_val,
+                            rocsparse_direction    dirb,
+                            J&                     Mb,
+                            J&                     Nb,
+                            I&                     nnzb,
+                            J&                     row_block_dim,
+                            J&                     col_block_dim,
+                            rocsparse_index_base   base,
+                            rocsparse_matrix_type  matrix_type,
+                            rocsparse_fill_mode    uplo,
+                            rocsparse_storage_mode storage) override;
+
+    virtual void init_coo(std::vector<I>&        coo_row_ind,
+                          std::vector<I>&        coo_col_ind,
+                          std::vector<T>&        coo_val,
+                          I&                     M,
+                          I&                     N,
+                          int64_t&               nnz,
+                          rocsparse_index_base   base,
+                          rocsparse_matrix_type  matrix_type,
+                          rocsparse_fill_mode    uplo,
+                          rocsparse_storage_mode storage) override;
+};
+
+#endif // ROCSPARSE_MATRIX_FACTORY_ROWDIST_HPP
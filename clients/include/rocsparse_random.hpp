@@ -279,4 +279,128 @@ inline T random_cached_generator_normal()
     return static_cast<T>(rocsparse_normal_double());
 }
 
+/* ==================================================================================== */
+/*! \brief  Counter-based random number generator.
+ *  \details The number drawn at (stream, counter) is a hash of the seed, the stream and the
+ *  counter, it does not depend on any other draw. The matrix generators use it to generate
+ *  rows (or edges) independently, in parallel, with a result that does not depend on the
+ *  number of threads. */
+class rocsparse_counter_rng
+{
+    uint64_t m_seed;
+
+public:
+    //! SplitMix64 finalizer.
+    static uint64_t mix(uint64_t x)
+    {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    explicit rocsparse_counter_rng(uint64_t seed)
+        : m_seed(mix(seed))
+    {
+    }
+
+    //! 64 random bits.
+    uint64_t operator()(uint64_t stream, uint64_t counter) const
+    {
+        return mix(mix(this->m_seed ^ mix(stream)) + counter);
+    }
+
+    //! Uniform number in [0, 1).
+    double uniform(uint64_t stream, uint64_t counter) const
+    {
+        return ((*this)(stream, counter) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    //! Uniform integer in [a, b].
+    int64_t uniform_int(uint64_t stream, uint64_t counter, int64_t a, int64_t b) const
+    {
+        return a + int64_t(this->uniform(stream, counter) * double(b - a + 1));
+    }
+
+    //! Uniform value in [a, b) ([a, b] for integers), complex values are uniform in the
+    //! annulus [|a|, |b|).
+    template <typename T>
+    T value(uint64_t stream, uint64_t counter, T a, T b) const
+    {
+        return std::is_integral<T>()
+                   ? static_cast<T>(this->uniform_int(stream, counter, int64_t(a), int64_t(b)))
+                   : static_cast<T>(std::real(a)
+                                    + this->uniform(stream, counter)
+                                          * (std::real(b) - std::real(a)));
+    }
+
+    //! Integer value in [a, b], converted to T.
+    template <typename T>
+    T value_exact(uint64_t stream, uint64_t counter, int a = 1, int b = 10) const
+    {
+        return static_cast<T>(this->uniform_int(stream, counter, a, b));
+    }
+
+    //! Value in the default range of random_cached_generator, [1, 10] for integers and
+    //! [0, 1) otherwise.
+    template <typename T>
+    T value(uint64_t stream, uint64_t counter) const
+    {
+        return std::is_integral<T>()
+                   ? this->value_exact<T>(stream, counter)
+                   : this->value(stream, counter, static_cast<T>(0), static_cast<T>(1));
+    }
+};
+
+template <>
+inline rocsparse_float_complex rocsparse_counter_rng::value(uint64_t                stream,
+                                                            uint64_t                counter,
+                                                            rocsparse_float_complex a,
+                                                            rocsparse_float_complex b) const
+{
+    const float theta = this->uniform(stream, 2 * counter) * 2.0f * acos(-1.0f);
+    const float r
+        = std::abs(a) + this->uniform(stream, 2 * counter + 1) * (std::abs(b) - std::abs(a));
+    return rocsparse_float_complex(r * cos(theta), r * sin(theta));
+}
+
+template <>
+inline rocsparse_double_complex rocsparse_counter_rng::value(uint64_t                 stream,
+                                                             uint64_t                 counter,
+                                                             rocsparse_double_complex a,
+                                                             rocsparse_double_complex b) const
+{
+    const double theta = this->uniform(stream, 2 * counter) * 2.0 * acos(-1.0);
+    const double r
+        = std::abs(a) + this->uniform(stream, 2 * counter + 1) * (std::abs(b) - std::abs(a));
+    return rocsparse_double_complex(r * cos(theta), r * sin(theta));
+}
+
+template <>
+inline rocsparse_float_complex
+    rocsparse_counter_rng::value_exact(uint64_t stream, uint64_t counter, int a, int b) const
+{
+    return rocsparse_float_complex(this->uniform_int(stream, 2 * counter, a, b),
+                                   this->uniform_int(stream, 2 * counter + 1, a, b));
+}
+
+template <>
+inline rocsparse_double_complex
+    rocsparse_counter_rng::value_exact(uint64_t stream, uint64_t counter, int a, int b) const
+{
+    return rocsparse_double_complex(this->uniform_int(stream, 2 * counter, a, b),
+                                    this->uniform_int(stream, 2 * counter + 1, a, b));
+}
+
+/*! \brief  Draw the seed of a counter-based random number generator.
+ *  \details The seed is drawn from the raw output of the random number generator, the
+ *  matrices generated after rocsparse_seedrand() are therefore the same on any platform. */
+inline uint64_t rocsparse_counter_rng_seed()
+{
+    rocsparse_rng_t& rng = rocsparse_rng_get();
+    const uint64_t   hi  = rng();
+    const uint64_t   lo  = rng();
+    return (hi << 32) ^ lo;
+}
+
 #endif // ROCSPARSE_RANDOM_HPP
@@ -29,6 +29,38 @@
 
 #define ROCSPARSEIO_VERSION_MAJOR 1
 
+/*! \brief Revision of the file layout, written in the last byte of the file header.
+ *
+ *  \details
+ *  - 0: array sections are written back to back.
+ *  - 1: array sections are padded such that their data start on a multiple of
+ *       \ref ROCSPARSEIO_ALIGNMENT bytes from the beginning of the file.
+ *  - 2: array sections of sparse matrices may be encoded with a \ref rocsparseio_codec.
+ *  - 3: the file is an archive of named objects, ended by a table of contents.
+ *
+ *  Files of any revision lower or equal to \ref ROCSPARSEIO_VERSION_MINOR can be read.
+ */
+#define ROCSPARSEIO_VERSION_MINOR 3
+
+/*! \brief Alignment in bytes of the array sections of a file.
+ */
+#define ROCSPARSEIO_ALIGNMENT 64
+
+/*! \brief Number of elements of the chunks an encoded array section is split into, chunks
+ *  are encoded and decoded independently.
+ */
+#define ROCSPARSEIO_CODEC_CHUNK_NMEMB 65536
+
+/*! \brief Default size in bytes of the chunks large array sections are transferred by, see
+ *  \ref rocsparseiox_set_io_engine.
+ */
+#define ROCSPARSEIO_IO_CHUNK_SIZE (1 << 22)
+
+/*! \brief Default number of chunks transferred concurrently, see
+ *  \ref rocsparseiox_set_io_engine.
+ */
+#define ROCSPARSEIO_IO_QUEUE_DEPTH 8
+
 #include <stddef.h>
 #include <stdint.h>
 
@@ -73,6 +105,7 @@ typedef rocsparseio_enum_t rocsparseio_direction_t;
 typedef rocsparseio_enum_t rocsparseio_type_t;
 typedef rocsparseio_enum_t rocsparseio_format_t;
 typedef rocsparseio_enum_t rocsparseio_index_base_t;
+typedef rocsparseio_enum_t rocsparseio_codec_t;
 
 /*! \ingroup types_module
  *  \brief Enumerates status.
@@ -91,6 +124,8 @@ typedef rocsparseio_enum_t rocsparseio_index_base_t;
 
 #define ROCSPARSEIO_RWMODE_READ 0
 #define ROCSPARSEIO_RWMODE_WRITE 1
+#define ROCSPARSEIO_RWMODE_READ_MMAP 2
+#define ROCSPARSEIO_RWMODE_WRITE_ALIGNED 3
 
 #define ROCSPARSEIO_ORDER_ROW 0
 #define ROCSPARSEIO_ORDER_COLUMN 1
@@ -115,6 +150,10 @@ typedef rocsparseio_enum_t rocsparseio_index_base_t;
 #define ROCSPARSEIO_FORMAT_SPARSE_GEBSX 3
 #define ROCSPARSEIO_FORMAT_SPARSE_COO 4
 
+#define ROCSPARSEIO_CODEC_NONE 0
+#define ROCSPARSEIO_CODEC_DELTA_VARINT 1
+#define ROCSPARSEIO_CODEC_BYTE_SHUFFLE 2
+
 typedef enum rocsparseio_index_base_
 {
     rocsparseio_index_base_zero = 0,
@@ -123,8 +162,10 @@ typedef enum rocsparseio_index_base_
 
 typedef enum rocsparseio_rwmode_
 {
-    rocsparseio_rwmode_read  = ROCSPARSEIO_RWMODE_READ,
-    rocsparseio_rwmode_write = ROCSPARSEIO_RWMODE_WRITE
+    rocsparseio_rwmode_read          = ROCSPARSEIO_RWMODE_READ,
+    rocsparseio_rwmode_write         = ROCSPARSEIO_RWMODE_WRITE,
+    rocsparseio_rwmode_read_mmap     = ROCSPARSEIO_RWMODE_READ_MMAP,
+    rocsparseio_rwmode_write_aligned = ROCSPARSEIO_RWMODE_WRITE_ALIGNED
 } rocsparseio_rwmode;
 
 typedef enum rocsparseio_type_
@@ -147,6 +188,24 @@ typedef enum rocsparseio_format_
     rocsparseio_format_sparse_coo   = ROCSPARSEIO_FORMAT_SPARSE_COO
 } rocsparseio_format;
 
+/*! \ingroup types_module
+ *  \brief Enumerates the encodings of array sections.
+ *
+ *  \details
+ *  - \ref rocsparseio_codec_none, elements are stored as they are in memory.
+ *  - \ref rocsparseio_codec_delta_varint, for arrays of indices or offsets, differences of
+ *    consecutive elements are stored as zigzag variable-length integers.
+ *  - \ref rocsparseio_codec_byte_shuffle, for arrays of values, the bytes of the elements are
+ *    split into byte planes (sign and exponent bytes being grouped), each plane being stored
+ *    raw, as a constant or run-length encoded, whichever is smaller.
+ */
+typedef enum rocsparseio_codec_
+{
+    rocsparseio_codec_none         = ROCSPARSEIO_CODEC_NONE,
+    rocsparseio_codec_delta_varint = ROCSPARSEIO_CODEC_DELTA_VARINT,
+    rocsparseio_codec_byte_shuffle = ROCSPARSEIO_CODEC_BYTE_SHUFFLE
+} rocsparseio_codec;
+
 typedef enum rocsparseio_direction_
 {
     rocsparseio_direction_row    = ROCSPARSEIO_DIRECTION_ROW,
@@ -194,6 +253,13 @@ extern "C" {
 //! @retval rocsparseio_status_invalid_handle \p p_handle is a null pointer.
 //! @retval rocsparseio_status_invalid_value \p mode is invalid
 //! @retval rocsparseio_status_invalid_pointer \p filename is a null pointer.
+//! @note With \ref rocsparseio_rwmode_read_mmap, the file is also mapped in memory and the
+//! array sections of sparse matrices can be accessed in place with the rocsparseiox_map
+//! routines. Pages are loaded on first access.
+//! @note With \ref rocsparseio_rwmode_write, the file is written with the layout revision 0
+//! and can be read by any rocSPARSEIO reader. With \ref rocsparseio_rwmode_write_aligned, the
+//! array sections are padded to \ref ROCSPARSEIO_ALIGNMENT bytes (layout revision 1), such that
+//! they can be used in place with \ref rocsparseio_rwmode_read_mmap.
 
 rocsparseio_status rocsparseio_open(rocsparseio_handle* p_handle,
                                     rocsparseio_rwmode  mode,
@@ -207,6 +273,103 @@ rocsparseio_status rocsparseio_open(rocsparseio_handle* p_handle,
 
 rocsparseio_status rocsparseio_close(rocsparseio_handle handle);
 
+//! @brief Set the encodings of the array sections of the sparse matrices written next.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_write.
+//! @param[in] index_codec encoding of the arrays of offsets and indices.
+//! @param[in] value_codec encoding of the arrays of values.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened for writing, or
+//! \p handle is opened with \ref rocsparseio_rwmode_write and an object was already written.
+//! @retval rocsparseio_status_invalid_value \p index_codec or \p value_codec is invalid,
+//! \ref rocsparseio_codec_delta_varint only applies to indices.
+//! @note Files with encoded sections are marked with the layout revision 2, whose sections
+//! are aligned. A file opened with \ref rocsparseio_rwmode_write is only raised to it before
+//! its first object.
+//! Sections are decoded in parallel by chunks of \ref ROCSPARSEIO_CODEC_CHUNK_NMEMB elements.
+
+rocsparseio_status rocsparseiox_set_codecs(rocsparseio_handle handle,
+                                           rocsparseio_codec  index_codec,
+                                           rocsparseio_codec  value_codec);
+
+//! @brief Configure the transfers of the large arrays of a handle.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] chunk_size size in bytes of the chunks arrays are split into.
+//! @param[in] queue_depth number of chunks read or written concurrently, one uses the
+//! sequential stdio stream.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_size \p chunk_size or \p queue_depth is zero.
+//! @note
+//! - Chunks are transferred by a pool of threads with positioned reads and writes on the
+//! file descriptor, the content of the file does not depend on the configuration.
+//! - A handle is opened with a queue depth of one, \ref ROCSPARSEIO_IO_CHUNK_SIZE and
+//! \ref ROCSPARSEIO_IO_QUEUE_DEPTH are suited to local NVMe drives and parallel filesystems.
+
+rocsparseio_status rocsparseiox_set_io_engine(rocsparseio_handle handle,
+                                              uint64_t           chunk_size,
+                                              uint64_t           queue_depth);
+
+//! @brief Name the next object to write, the file becomes an archive.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_write.
+//! @param[in] name name of the entry, unique in the archive.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened for writing, or
+//! \p handle is opened with \ref rocsparseio_rwmode_write and an object was already written.
+//! @retval rocsparseio_status_invalid_pointer \p name is a null pointer.
+//! @retval rocsparseio_status_invalid_value \p name is empty or already used.
+//! @note
+//! - Objects are still written one after the other, objects written without a name are
+//! not listed in the table of contents.
+//! - The table of contents, with the format, offset and size of each named object, is
+//! written by \ref rocsparseio_close. Archives are marked with the layout revision 3, whose
+//! sections are aligned. A file opened with \ref rocsparseio_rwmode_write is only raised to it
+//! before its first object.
+
+rocsparseio_status rocsparseiox_archive_set_name(rocsparseio_handle handle, const char* name);
+
+//! @brief Get the number of entries of an archive.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[out] nentries number of entries, zero if the file is not an archive.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_pointer \p nentries is a null pointer.
+
+rocsparseio_status rocsparseiox_archive_get_size(rocsparseio_handle handle, uint64_t* nentries);
+
+//! @brief Get an entry of an archive, in the order the objects were written.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] index index of the entry.
+//! @param[out] name name of the entry, valid until \ref rocsparseio_close is called,
+//! can be a null pointer.
+//! @param[out] format format of the object, can be a null pointer.
+//! @param[out] nbytes size in bytes of the object, can be a null pointer.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_value \p index is out of range.
+
+rocsparseio_status rocsparseiox_archive_get_entry(rocsparseio_handle  handle,
+                                                  uint64_t            index,
+                                                  const char**        name,
+                                                  rocsparseio_format* format,
+                                                  uint64_t*           nbytes);
+
+//! @brief Move to the named entry of an archive, such that it is the next object to read.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened for reading.
+//! @param[in] name name of the entry.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_mode \p handle is opened for writing.
+//! @retval rocsparseio_status_invalid_pointer \p name is a null pointer.
+//! @retval rocsparseio_status_invalid_value no entry is named \p name.
+//! @note The lookup does not depend on the number of entries, and the objects preceding the
+//! entry are not read.
+
+rocsparseio_status rocsparseiox_archive_seek(rocsparseio_handle handle, const char* name);
+
 //! @brief Read what kind of object is recorded.
 //! @param[in] handle pointer to the rocSPARSEIO handle.
 //! @param[out] format of object.
@@ -417,6 +580,112 @@ rocsparseio_status rocsparseiox_read_metadata_sparse_csx(rocsparseio_handle
 rocsparseio_status
     rocsparseiox_read_sparse_csx(rocsparseio_handle handle, void* ptr, void* ind, void* data);
 
+//! @brief Map sparse csr/csc matrix data arrays.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_read_mmap.
+//! @param[out] ptr pointer to the array of offsets in the file mapping.
+//! @param[out] ind pointer to the array of column/row indices in the file mapping.
+//! @param[out] val pointer to the array of values in the file mapping.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened with
+//! \ref rocsparseio_rwmode_read_mmap.
+//! @retval rocsparseio_status_invalid_format an array is encoded with a codec or is not
+//! aligned on its element type, which can happen for files written with a layout revision 0;
+//! \ref rocsparseiox_read_sparse_csx must then be used.
+//! @note
+//! - It is expected \ref rocsparseiox_read_metadata_sparse_csx to be called before.
+//! - The arrays are read-only and valid until \ref rocsparseio_close is called.
+rocsparseio_status rocsparseiox_map_sparse_csx(rocsparseio_handle handle,
+                                               const void**       ptr,
+                                               const void**       ind,
+                                               const void**       val);
+
+//! @brief Read the number of non-zeros of a range of rows of a sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] r0 first row (or column with the Compressed Sparse Column storage).
+//! @param[in] r1 last row (excluded).
+//! @param[out] nnz number of non-zeros of the rows [r0, r1).
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_size the range is not within the matrix.
+//! @note
+//! - It is expected \ref rocsparseiox_read_sparse_csx_rows to be the next rocSPARSEIO
+//! routine being called.
+rocsparseio_status rocsparseiox_read_metadata_sparse_csx_rows(rocsparseio_handle handle,
+                                                              uint64_t           r0,
+                                                              uint64_t           r1,
+                                                              uint64_t*          nnz);
+
+//! @brief Read a range of rows of a sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] r0 first row (or column with the Compressed Sparse Column storage).
+//! @param[in] r1 last row (excluded).
+//! @param[out] ptr array of r1 - r0 + 1 offsets to fill, rebased to start from the index
+//! base of the matrix.
+//! @param[out] ind array of column/row indices of the rows to fill.
+//! @param[out] val array of values of the rows to fill.
+//! @retval rocsparseio_status
+//! @note
+//! - Only the parts of the arrays of indices and values which belong to the rows are read.
+//! - Files of any layout revision are supported, the array of offsets is used as index.
+rocsparseio_status rocsparseiox_read_sparse_csx_rows(
+    rocsparseio_handle handle, uint64_t r0, uint64_t r1, void* ptr, void* ind, void* val);
+
+//! @brief Start writing a sparse csr/csc matrix by batches of rows, when its number of
+//! non-zeros is not known in advance.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_write.
+//! @param[in] dir indicates if the matrix is using a Compressed Sparse Row
+//! or Column storage.
+//! @param[in] m number of rows.
+//! @param[in] n number of columns.
+//! @param[in] ptr_type type of the offsets, \ref rocsparseio_type_int32 or
+//! \ref rocsparseio_type_int64.
+//! @param[in] ind_type type of the indices, \ref rocsparseio_type_int32 or
+//! \ref rocsparseio_type_int64.
+//! @param[in] val_type type of the values.
+//! @param[in] base index base of the offsets and indices.
+//! @param[in] buffer_size size in bytes of the buffer staging the offsets and copying the
+//! values, which bounds the memory used by the writer.
+//! @retval rocsparseio_status
+//! @note
+//! - Indices are written to the file as they are appended, values are spooled to the file
+//! named after the file of \p handle with the suffix .spool, and copied after the indices
+//! by \ref rocsparseiox_stream_sparse_csx_end.
+//! - No other object can be written until \ref rocsparseiox_stream_sparse_csx_end is called.
+//! - Arrays are written without codec, the file is the same as the one written by
+//! \ref rocsparseio_write_sparse_csx from the complete arrays.
+rocsparseio_status rocsparseiox_stream_sparse_csx_begin(rocsparseio_handle     handle,
+                                                        rocsparseio_direction  dir,
+                                                        uint64_t               m,
+                                                        uint64_t               n,
+                                                        rocsparseio_type       ptr_type,
+                                                        rocsparseio_type       ind_type,
+                                                        rocsparseio_type       val_type,
+                                                        rocsparseio_index_base base,
+                                                        uint64_t               buffer_size);
+
+//! @brief Append a batch of rows to a streamed sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] nrows number of rows of the batch.
+//! @param[in] ptr array of \p nrows + 1 offsets of the type of the matrix offsets, only the
+//! differences with ptr[0] are used.
+//! @param[in] ind array of ptr[nrows] - ptr[0] indices.
+//! @param[in] val array of ptr[nrows] - ptr[0] values.
+//! @retval rocsparseio_status
+rocsparseio_status rocsparseiox_stream_sparse_csx_rows(rocsparseio_handle handle,
+                                                       uint64_t           nrows,
+                                                       const void*        ptr,
+                                                       const void*        ind,
+                                                       const void*        val);
+
+//! @brief Complete a streamed sparse csr/csc matrix, its offsets, number of non-zeros and
+//! values are written.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_size less than \p m rows have been appended.
+//! @note \ref rocsparseio_close completes a streamed matrix.
+rocsparseio_status rocsparseiox_stream_sparse_csx_end(rocsparseio_handle handle);
+
 //! @brief Write a sparse gebsr/gebsc matrix.
 //! @param[in] handle pointer to the rocSPARSEIO handle.
 //! @param[in] dir indicates if the matrix is using a GEneral Block Sparse Row
@@ -524,6 +793,99 @@ rocsparseio_status rocsparseiox_read_metadata_sparse_gebsx(rocsparseio_handle
 rocsparseio_status
     rocsparseiox_read_sparse_gebsx(rocsparseio_handle handle, void* ptr, void* ind, void* val);
 
+//! @brief Map sparse gebsr/gebsc matrix data arrays.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_read_mmap.
+//! @param[out] ptr pointer to the array of offsets in the file mapping.
+//! @param[out] ind pointer to the array of column/row indices in the file mapping.
+//! @param[out] val pointer to the array of values in the file mapping.
+//! @retval rocsparseio_status
+//! @note see \ref rocsparseiox_map_sparse_csx.
+rocsparseio_status rocsparseiox_map_sparse_gebsx(rocsparseio_handle handle,
+                                                 const void**       ptr,
+                                                 const void**       ind,
+                                                 const void**       val);
+
+//! @brief Read the number of non-zero blocks of a range of block rows of a sparse
+//! gebsr/gebsc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] r0 first block row (or block column).
+//! @param[in] r1 last block row (excluded).
+//! @param[out] nnzb number of non-zero blocks of the block rows [r0, r1).
+//! @retval rocsparseio_status
+//! @note see \ref rocsparseiox_read_metadata_sparse_csx_rows.
+rocsparseio_status rocsparseiox_read_metadata_sparse_gebsx_rows(rocsparseio_handle handle,
+                                                                uint64_t           r0,
+                                                                uint64_t           r1,
+                                                                uint64_t*          nnzb);
+
+//! @brief Read a range of block rows of a sparse gebsr/gebsc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] r0 first block row (or block column).
+//! @param[in] r1 last block row (excluded).
+//! @param[out] ptr array of r1 - r0 + 1 offsets to fill, rebased to start from the index
+//! base of the matrix.
+//! @param[out] ind array of block column/row indices of the block rows to fill.
+//! @param[out] val array of values of the blocks to fill.
+//! @retval rocsparseio_status
+//! @note see \ref rocsparseiox_read_sparse_csx_rows.
+rocsparseio_status rocsparseiox_read_sparse_gebsx_rows(
+    rocsparseio_handle handle, uint64_t r0, uint64_t r1, void* ptr, void* ind, void* val);
+
+//! @brief Start writing a sparse gebsr/gebsc matrix by batches of block rows, when its number
+//! of non-zero blocks is not known in advance.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_write.
+//! @param[in] dir indicates if the matrix is using a GEneral Block Sparse Row
+//! or Column storage.
+//! @param[in] dirb indicates storage ordering of dense block matrices.
+//! @param[in] mb number of rows of blocks.
+//! @param[in] nb number of columns of blocks.
+//! @param[in] row_block_dim number of rows in a single dense block.
+//! @param[in] col_block_dim number of columns in a single dense block.
+//! @param[in] ptr_type type of the offsets, \ref rocsparseio_type_int32 or
+//! \ref rocsparseio_type_int64.
+//! @param[in] ind_type type of the block indices, \ref rocsparseio_type_int32 or
+//! \ref rocsparseio_type_int64.
+//! @param[in] val_type type of the values.
+//! @param[in] base index base of the offsets and block indices.
+//! @param[in] buffer_size size in bytes of the buffer staging the offsets and copying the
+//! values.
+//! @retval rocsparseio_status
+//! @note see \ref rocsparseiox_stream_sparse_csx_begin.
+rocsparseio_status rocsparseiox_stream_sparse_gebsx_begin(rocsparseio_handle     handle,
+                                                          rocsparseio_direction  dir,
+                                                          rocsparseio_direction  dirb,
+                                                          uint64_t               mb,
+                                                          uint64_t               nb,
+                                                          uint64_t               row_block_dim,
+                                                          uint64_t               col_block_dim,
+                                                          rocsparseio_type       ptr_type,
+                                                          rocsparseio_type       ind_type,
+                                                          rocsparseio_type       val_type,
+                                                          rocsparseio_index_base base,
+                                                          uint64_t               buffer_size);
+
+//! @brief Append a batch of block rows to a streamed sparse gebsr/gebsc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @param[in] nrowsb number of block rows of the batch.
+//! @param[in] ptr array of \p nrowsb + 1 offsets of the type of the matrix offsets, only the
+//! differences with ptr[0] are used.
+//! @param[in] ind array of ptr[nrowsb] - ptr[0] block indices.
+//! @param[in] val array of the values of the ptr[nrowsb] - ptr[0] blocks.
+//! @retval rocsparseio_status
+rocsparseio_status rocsparseiox_stream_sparse_gebsx_rows(rocsparseio_handle handle,
+                                                         uint64_t           nrowsb,
+                                                         const void*        ptr,
+                                                         const void*        ind,
+                                                         const void*        val);
+
+//! @brief Complete a streamed sparse gebsr/gebsc matrix.
+//! @param[in] handle pointer to the rocSPARSEIO handle.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_size less than \p mb block rows have been appended.
+rocsparseio_status rocsparseiox_stream_sparse_gebsx_end(rocsparseio_handle handle);
+
 //! @brief Write a sparse matrix with coordinates format.
 //! @param[in] handle pointer to the rocSPARSEIO handle.
 //! @param[in] m number of rows.
@@ -610,6 +972,19 @@ rocsparseio_status rocsparseiox_read_sparse_coo(rocsparseio_handle handle,
                                                 void*              col_ind,
                                                 void*              val);
 
+//! @brief Map a sparse matrix with coordinates format.
+//! @param[in] handle pointer to the rocSPARSEIO handle, opened with
+//! \ref rocsparseio_rwmode_read_mmap.
+//! @param[out] row_ind pointer to the array of row indices in the file mapping.
+//! @param[out] col_ind pointer to the array of column indices in the file mapping.
+//! @param[out] val     pointer to the array of values in the file mapping.
+//! @retval rocsparseio_status
+//! @note see \ref rocsparseiox_map_sparse_csx.
+rocsparseio_status rocsparseiox_map_sparse_coo(rocsparseio_handle handle,
+                                               const void**       row_ind,
+                                               const void**       col_ind,
+                                               const void**       val);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,11 @@
 #include "rocsparse_vector_utils.hpp"
 #include "utility.hpp"
 #include <rocsparse.hpp>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
 template <typename T>
 inline T* rocsparse_fake_pointer()
 {
@@ -127,3 +132,33 @@ inline bool is_hmm_enabled()
 
     return hmm_enabled;
 }
+
+// Writes content into a new temporary Matrix Market file, and returns its name.
+inline std::string rocsparse_write_tmp_mtx(const char* content)
+{
+#ifdef WIN32
+    char*       tmp = _tempnam(nullptr, "rocsparse-");
+    std::string filename(tmp);
+    free(tmp);
+    filename += ".mtx";
+#else
+    char tmp[] = "/tmp/rocsparse-XXXXXX.mtx";
+    int  fd    = mkstemps(tmp, 4);
+    if(fd == -1)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_status_internal_error);
+    }
+    close(fd);
+    std::string filename(tmp);
+#endif
+
+    FILE* f = fopen(filename.c_str(), "w");
+    if(f == nullptr)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_status_internal_error);
+    }
+    fputs(content, f);
+    fclose(f);
+
+    return filename;
+}
@@ -0,0 +1,346 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "rocsparse_clients_matrices_cache.hpp"
+#include "rocsparse_init.hpp"
+
+#ifndef WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef WIN32
+
+static constexpr const char* s_cache_dir_name = "ROCSPARSE_CLIENTS_MATRICES_CACHE_DIR";
+
+// Number of entries of a cache directory.
+static rocsparse_int testing_cache_nentries(const std::string& dir)
+{
+    const std::string suffix(".rocsparseio");
+    rocsparse_int     nentries = 0;
+
+    DIR* d = opendir(dir.c_str());
+    if(d == nullptr)
+    {
+        return nentries;
+    }
+
+    for(struct dirent* e = readdir(d); e != nullptr; e = readdir(d))
+    {
+        const std::string name(e->d_name);
+        if(name.size() > suffix.size()
+           && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            ++nentries;
+        }
+    }
+    closedir(d);
+
+    return nentries;
+}
+
+// Removes a cache directory and its entries.
+static void testing_cache_remove(const std::string& dir)
+{
+    DIR* d = opendir(dir.c_str());
+    if(d == nullptr)
+    {
+        return;
+    }
+
+    for(struct dirent* e = readdir(d); e != nullptr; e = readdir(d))
+    {
+        const std::string name(e->d_name);
+        if(name != "." && name != "..")
+        {
+            remove((dir + "/" + name).c_str());
+        }
+    }
+    closedir(d);
+
+    rmdir(dir.c_str());
+}
+
+// Points the cache to a new temporary directory and restores the previous configuration
+// on destruction. The environment is only read once, hence the directory is also set
+// explicitly.
+struct testing_cache_scope
+{
+    std::string dir;
+    std::string saved_dir;
+    std::string saved_env;
+    bool        saved_env_defined;
+
+    testing_cache_scope()
+    {
+        this->saved_dir = rocsparse_clients_matrices_cache_dir_get();
+
+        const char* env         = getenv(s_cache_dir_name);
+        this->saved_env_defined = (env != nullptr);
+        if(env != nullptr)
+        {
+            this->saved_env = env;
+        }
+
+        char tmp[] = "/tmp/rocsparse-cache-XXXXXX";
+        if(mkdtemp(tmp) == nullptr)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_status_internal_error);
+        }
+        this->dir = tmp;
+
+        setenv(s_cache_dir_name, this->dir.c_str(), 1);
+        rocsparse_clients_matrices_cache_dir_set(this->dir.c_str());
+    }
+
+    ~testing_cache_scope()
+    {
+        testing_cache_remove(this->dir);
+
+        if(this->saved_env_defined)
+        {
+            setenv(s_cache_dir_name, this->saved_env.c_str(), 1);
+        }
+        else
+        {
+            unsetenv(s_cache_dir_name);
+        }
+        rocsparse_clients_matrices_cache_dir_set(this->saved_dir.c_str());
+    }
+};
+
+#endif
+
+template <typename T>
+void testing_clients_matrices_cache_bad_arg(const Arguments& arg)
+{
+#ifndef WIN32
+    const rocsparse_index_base base = arg.baseA;
+
+    testing_cache_scope scope;
+
+    const std::vector<rocsparse_int> csr_row_ptr_gold{base, base + 1};
+    const std::vector<rocsparse_int> csr_col_ind_gold{base};
+    const std::vector<T>             csr_val_gold{static_cast<T>(1)};
+
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+    rocsparse_int              M, N, nnz;
+
+    // A missing source file is neither stored nor loaded
+    const std::string missing = rocsparse_write_tmp_mtx("");
+    remove(missing.c_str());
+
+    rocsparse_clients_matrices_cache_store(
+        "mtx", missing.c_str(), csr_row_ptr_gold, csr_col_ind_gold, csr_val_gold, 1, 1, 1, base);
+    unit_check_scalar<rocsparse_int>(0, testing_cache_nentries(scope.dir));
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", missing.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    // A directory is not a source file
+    rocsparse_clients_matrices_cache_store(
+        "mtx", scope.dir.c_str(), csr_row_ptr_gold, csr_col_ind_gold, csr_val_gold, 1, 1, 1, base);
+    unit_check_scalar<rocsparse_int>(0, testing_cache_nentries(scope.dir));
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", scope.dir.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    const std::string filename
+        = rocsparse_write_tmp_mtx("%%MatrixMarket matrix coordinate real general\n"
+                                  "1 1 1\n"
+                                  "1 1 1.0\n");
+
+    // A matrix without entries is not stored
+    rocsparse_clients_matrices_cache_store(
+        "mtx", filename.c_str(), csr_row_ptr_gold, csr_col_ind_gold, csr_val_gold, 1, 1, 0, base);
+    unit_check_scalar<rocsparse_int>(0, testing_cache_nentries(scope.dir));
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    // The entry is not served for another format or another index base
+    rocsparse_clients_matrices_cache_store(
+        "mtx", filename.c_str(), csr_row_ptr_gold, csr_col_ind_gold, csr_val_gold, 1, 1, 1, base);
+    unit_check_scalar<rocsparse_int>(1, testing_cache_nentries(scope.dir));
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "smtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    const rocsparse_index_base other_base = (base == rocsparse_index_base_zero)
+                                                ? rocsparse_index_base_one
+                                                : rocsparse_index_base_zero;
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, other_base));
+
+    remove(filename.c_str());
+#endif
+}
+
+void testing_clients_matrices_cache_extra(const Arguments& arg)
+{
+#ifndef WIN32
+    testing_cache_scope scope;
+    unit_check_scalar<rocsparse_int>(1, rocsparse_clients_matrices_cache_enabled());
+
+    // An empty directory disables the cache, nothing is stored nor loaded
+    rocsparse_clients_matrices_cache_dir_set("");
+    unit_check_scalar<rocsparse_int>(0, rocsparse_clients_matrices_cache_enabled());
+
+    const std::string filename
+        = rocsparse_write_tmp_mtx("%%MatrixMarket matrix coordinate real general\n"
+                                  "2 2 2\n"
+                                  "1 1 1.0\n"
+                                  "2 2 2.0\n");
+
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<double>        csr_val;
+    rocsparse_int              M, N, nnz;
+
+    rocsparse_init_csr_mtx(
+        filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, arg.baseA);
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, arg.baseA));
+    unit_check_scalar<rocsparse_int>(0, testing_cache_nentries(scope.dir));
+
+    remove(filename.c_str());
+#endif
+}
+
+template <typename T>
+void testing_clients_matrices_cache(const Arguments& arg)
+{
+#ifndef WIN32
+    const rocsparse_index_base base = arg.baseA;
+
+    testing_cache_scope scope;
+
+    const std::string filename
+        = rocsparse_write_tmp_mtx("%%MatrixMarket matrix coordinate real general\n"
+                                  "4 5 7\n"
+                                  "3 2 -2.0\n"
+                                  "1 1 1.5\n"
+                                  "4 5 0.25\n"
+                                  "1 4 3.0\n"
+                                  "2 2 -1.0\n"
+                                  "4 1 4.0\n"
+                                  "3 3 0.5\n");
+
+    // First load, parsed from the source file and stored into the cache
+    std::vector<rocsparse_int> csr_row_ptr_gold;
+    std::vector<rocsparse_int> csr_col_ind_gold;
+    std::vector<T>             csr_val_gold;
+    rocsparse_int              M_gold, N_gold, nnz_gold;
+
+    rocsparse_init_csr_mtx(filename.c_str(),
+                           csr_row_ptr_gold,
+                           csr_col_ind_gold,
+                           csr_val_gold,
+                           M_gold,
+                           N_gold,
+                           nnz_gold,
+                           base);
+    unit_check_scalar<rocsparse_int>(1, testing_cache_nentries(scope.dir));
+
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+    rocsparse_int              M, N, nnz;
+
+    // Second load of the same file, served from the cache
+    unit_check_scalar<rocsparse_int>(
+        1,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    unit_check_scalar<rocsparse_int>(M_gold, M);
+    unit_check_scalar<rocsparse_int>(N_gold, N);
+    unit_check_scalar<rocsparse_int>(nnz_gold, nnz);
+    unit_check_segments<rocsparse_int>(M + 1, csr_row_ptr_gold.data(), csr_row_ptr.data());
+    unit_check_segments<rocsparse_int>(nnz, csr_col_ind_gold.data(), csr_col_ind.data());
+    unit_check_segments<T>(nnz, csr_val_gold.data(), csr_val.data());
+
+    rocsparse_init_csr_mtx(filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    unit_check_scalar<rocsparse_int>(1, testing_cache_nentries(scope.dir));
+    unit_check_segments<rocsparse_int>(M + 1, csr_row_ptr_gold.data(), csr_row_ptr.data());
+    unit_check_segments<rocsparse_int>(nnz, csr_col_ind_gold.data(), csr_col_ind.data());
+    unit_check_segments<T>(nnz, csr_val_gold.data(), csr_val.data());
+
+    // Touching the source file changes its modification time, the entry is not served
+    // anymore
+    struct stat st;
+    if(stat(filename.c_str(), &st) != 0)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_status_internal_error);
+    }
+
+    struct timespec times[2] = {st.st_atim, st.st_mtim};
+    times[1].tv_sec += 10;
+    if(utimensat(AT_FDCWD, filename.c_str(), times, 0) != 0)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_status_internal_error);
+    }
+
+    unit_check_scalar<rocsparse_int>(
+        0,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    // The file is parsed again and stored as a new entry
+    rocsparse_init_csr_mtx(filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    unit_check_scalar<rocsparse_int>(2, testing_cache_nentries(scope.dir));
+    unit_check_segments<rocsparse_int>(M + 1, csr_row_ptr_gold.data(), csr_row_ptr.data());
+    unit_check_segments<rocsparse_int>(nnz, csr_col_ind_gold.data(), csr_col_ind.data());
+    unit_check_segments<T>(nnz, csr_val_gold.data(), csr_val.data());
+
+    unit_check_scalar<rocsparse_int>(
+        1,
+        rocsparse_clients_matrices_cache_load(
+            "mtx", filename.c_str(), csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base));
+
+    remove(filename.c_str());
+#endif
+}
+
+#define INSTANTIATE(TTYPE)                                                             \
+    template void testing_clients_matrices_cache_bad_arg<TTYPE>(const Arguments& arg); \
+    template void testing_clients_matrices_cache<TTYPE>(const Arguments& arg)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
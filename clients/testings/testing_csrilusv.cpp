@@ -103,12 +103,23 @@ void testing_csrilusv(const Arguments& arg)
         hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val_gold, sizeof(T) * nnz, hipMemcpyHostToDevice));
 
+    // Analysis of the lower triangular part, shared by the host factorization and solve
+    host_trm_info<rocsparse_int, rocsparse_int> host_info_L;
+    host_trm_analysis(rocsparse_operation_none,
+                      M,
+                      nnz,
+                      hcsr_row_ptr.data(),
+                      hcsr_col_ind.data(),
+                      rocsparse_fill_mode_lower,
+                      base,
+                      host_info_L);
+
     // Compute reference incomplete LU factorization on host
     {
         double tol = 0;
         CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_get_tolerance(handle, info, &tol));
 
-        host_csrilu0<T>(M,
+        host_csrilu0<T>(host_info_L,
                         hcsr_row_ptr,
                         hcsr_col_ind,
                         hcsr_val_gold,
@@ -252,9 +263,7 @@ void testing_csrilusv(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
 
     // Compute reference solution on host
-    host_csrsv<rocsparse_int, rocsparse_int, T>(rocsparse_operation_none,
-                                                M,
-                                                nnz,
+    host_csrsv<rocsparse_int, rocsparse_int, T>(host_info_L,
                                                 h_alpha,
                                                 hcsr_row_ptr,
                                                 hcsr_col_ind,
@@ -263,7 +272,6 @@ void testing_csrilusv(const Arguments& arg)
                                                 (int64_t)1,
                                                 hz_gold,
                                                 rocsparse_diag_type_unit,
-                                                rocsparse_fill_mode_lower,
                                                 base,
                                                 h_struct_pivot_gold,
                                                 h_numeric_pivot_L_gold);
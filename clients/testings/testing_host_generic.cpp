@@ -0,0 +1,735 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "rocsparse_host_generic.hpp"
+
+template <typename I, typename J, typename T>
+void testing_host_generic_bad_arg(const Arguments& arg)
+{
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    rocsparse_index_base base = rocsparse_index_base_zero;
+
+    rocsparse_host_spmat_descr A;
+
+    // Invalid descriptor pointer and sizes
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            nullptr, 3, 4, 12, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            &A, -1, 4, 0, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            &A, 3, 4, 13, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            &A, 3, 0, 1, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_invalid_size);
+
+    // The product of the dimensions overflows int64_t
+    const int64_t large = int64_t(1) << 32;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            &A, large, large, 1, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_destroy_spmat_descr(A), rocsparse_status_success);
+
+    // Fully populated matrix
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_create_csr_descr(
+            &A, 3, 4, 12, nullptr, nullptr, nullptr, itype, jtype, base, ttype),
+        rocsparse_status_success);
+
+    // Pointers and attributes
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_coo_set_pointers(A, nullptr, nullptr, nullptr),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_csr_set_pointers(nullptr, nullptr, nullptr, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    rocsparse_fill_mode uplo = rocsparse_fill_mode_upper;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_spmat_set_attribute(A, rocsparse_spmat_fill_mode, &uplo, sizeof(int64_t)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_host_spmat_set_attribute(A, rocsparse_spmat_fill_mode, nullptr, sizeof(uplo)),
+        rocsparse_status_invalid_pointer);
+
+    // Scalars are required
+    rocsparse_host_dnvec_descr x;
+    rocsparse_host_dnvec_descr y;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_create_dnvec_descr(&x, 4, nullptr, ttype),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_create_dnvec_descr(&y, 3, nullptr, ttype),
+                            rocsparse_status_success);
+
+    const T h_one = static_cast<T>(1);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_spmv(rocsparse_operation_none,
+                                                nullptr,
+                                                A,
+                                                x,
+                                                &h_one,
+                                                y,
+                                                ttype,
+                                                rocsparse_spmv_alg_default,
+                                                rocsparse_spmv_stage_compute,
+                                                nullptr,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_destroy_dnvec_descr(x), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_destroy_dnvec_descr(y), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_host_destroy_spmat_descr(A), rocsparse_status_success);
+}
+
+void testing_host_generic_extra(const Arguments& arg)
+{
+    // ------------------------------------------------------------
+    // Lower triangular solve, the pattern is replaced after the
+    // analysis without a new preprocess stage
+    //
+    //     [ 2       ]          [ 2       ]
+    //     [ 2 -1    ]   --->   [   2     ]
+    //     [       2 ]          [  -1   2 ]
+    // ------------------------------------------------------------
+    host_vector<int32_t> hcsr_row_ptr_1{0, 1, 3, 4};
+    host_vector<int32_t> hcsr_col_ind_1{0, 0, 1, 2};
+    host_vector<int32_t> hcsr_row_ptr_2{0, 1, 2, 4};
+    host_vector<int32_t> hcsr_col_ind_2{0, 1, 1, 2};
+    host_vector<double>  hcsr_val{2.0, 2.0, -1.0, 2.0};
+
+    host_vector<double> hx{1.0, 1.0, 1.0};
+    host_vector<double> hy(3);
+    host_vector<double> hy_gold_1{0.5, 0.0, 0.5};
+    host_vector<double> hy_gold_2{0.5, 0.5, 0.75};
+
+    const double h_alpha = 1.0;
+
+    rocsparse_host_spmat_descr A;
+    rocsparse_host_dnvec_descr x;
+    rocsparse_host_dnvec_descr y;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_create_csr_descr(&A,
+                                                          3,
+                                                          3,
+                                                          4,
+                                                          hcsr_row_ptr_1.data(),
+                                                          hcsr_col_ind_1.data(),
+                                                          hcsr_val.data(),
+                                                          rocsparse_indextype_i32,
+                                                          rocsparse_indextype_i32,
+                                                          rocsparse_index_base_zero,
+                                                          rocsparse_datatype_f64_r));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_host_create_dnvec_descr(&x, 3, hx.data(), rocsparse_datatype_f64_r));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_host_create_dnvec_descr(&y, 3, hy.data(), rocsparse_datatype_f64_r));
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(rocsparse_operation_none,
+                                              &h_alpha,
+                                              A,
+                                              x,
+                                              y,
+                                              rocsparse_datatype_f64_r,
+                                              rocsparse_spsv_alg_default,
+                                              rocsparse_spsv_stage_buffer_size,
+                                              &buffer_size,
+                                              nullptr));
+
+    host_vector<char> hbuffer(buffer_size);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(rocsparse_operation_none,
+                                              &h_alpha,
+                                              A,
+                                              x,
+                                              y,
+                                              rocsparse_datatype_f64_r,
+                                              rocsparse_spsv_alg_default,
+                                              rocsparse_spsv_stage_preprocess,
+                                              nullptr,
+                                              hbuffer.data()));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(rocsparse_operation_none,
+                                              &h_alpha,
+                                              A,
+                                              x,
+                                              y,
+                                              rocsparse_datatype_f64_r,
+                                              rocsparse_spsv_alg_default,
+                                              rocsparse_spsv_stage_compute,
+                                              nullptr,
+                                              hbuffer.data()));
+
+    hy_gold_1.near_check(hy);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_csr_set_pointers(
+        A, hcsr_row_ptr_2.data(), hcsr_col_ind_2.data(), hcsr_val.data()));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(rocsparse_operation_none,
+                                              &h_alpha,
+                                              A,
+                                              x,
+                                              y,
+                                              rocsparse_datatype_f64_r,
+                                              rocsparse_spsv_alg_default,
+                                              rocsparse_spsv_stage_compute,
+                                              nullptr,
+                                              hbuffer.data()));
+
+    hy_gold_2.near_check(hy);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(x));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(y));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(A));
+}
+
+template <typename I, typename J, typename T>
+void testing_host_generic(const Arguments& arg)
+{
+    J                    M       = arg.M;
+    J                    N       = arg.N;
+    J                    K       = arg.K;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_diag_type  diag    = arg.diag;
+    rocsparse_fill_mode  uplo    = arg.uplo;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    // Sample matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind;
+    host_vector<T> hcsr_val;
+
+    I nnz_A;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz_A, base);
+
+    // The same matrix in COO and CSC format, the CSC arrays also hold the CSR arrays of the
+    // transposed matrix
+    host_vector<J> hcoo_row_ind;
+    host_csr_to_coo(M, nnz_A, hcsr_row_ptr, hcoo_row_ind, base);
+
+    host_vector<J> hcsc_row_ind(nnz_A);
+    host_vector<I> hcsc_col_ptr(N + 1);
+    host_vector<T> hcsc_val(nnz_A);
+    host_csr_to_csc(M,
+                    N,
+                    nnz_A,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    hcsc_row_ind,
+                    hcsc_col_ptr,
+                    hcsc_val,
+                    rocsparse_action_numeric,
+                    base);
+
+    rocsparse_host_spmat_descr A_csr;
+    rocsparse_host_spmat_descr A_coo;
+    rocsparse_host_spmat_descr A_csc;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_create_csr_descr(&A_csr,
+                                                          M,
+                                                          N,
+                                                          nnz_A,
+                                                          hcsr_row_ptr.data(),
+                                                          hcsr_col_ind.data(),
+                                                          hcsr_val.data(),
+                                                          itype,
+                                                          jtype,
+                                                          base,
+                                                          ttype));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_create_coo_descr(&A_coo,
+                                                          M,
+                                                          N,
+                                                          nnz_A,
+                                                          hcoo_row_ind.data(),
+                                                          hcsr_col_ind.data(),
+                                                          hcsr_val.data(),
+                                                          jtype,
+                                                          base,
+                                                          ttype));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_create_csc_descr(&A_csc,
+                                                          M,
+                                                          N,
+                                                          nnz_A,
+                                                          hcsc_col_ptr.data(),
+                                                          hcsc_row_ind.data(),
+                                                          hcsc_val.data(),
+                                                          itype,
+                                                          jtype,
+                                                          base,
+                                                          ttype));
+
+    size_t            buffer_size;
+    host_vector<char> hbuffer;
+
+    // --------------------------------------
+    // SpMV in all formats against host_csrmv
+    // --------------------------------------
+    {
+        J x_size = (trans_A == rocsparse_operation_none) ? N : M;
+        J y_size = (trans_A == rocsparse_operation_none) ? M : N;
+
+        host_vector<T> hx(x_size);
+        host_vector<T> hy_0(y_size);
+        host_vector<T> hy_gold;
+
+        rocsparse_init<T>(hx, x_size, 1, 1);
+        rocsparse_init<T>(hy_0, y_size, 1, 1);
+
+        hy_gold = hy_0;
+        host_csrmv<T, I, J, T, T, T>(trans_A,
+                                     M,
+                                     N,
+                                     nnz_A,
+                                     h_alpha,
+                                     hcsr_row_ptr.data(),
+                                     hcsr_col_ind.data(),
+                                     hcsr_val.data(),
+                                     hx.data(),
+                                     h_beta,
+                                     hy_gold.data(),
+                                     base,
+                                     rocsparse_matrix_type_general,
+                                     rocsparse_spmv_alg_default,
+                                     false);
+
+        for(rocsparse_host_spmat_descr A : {A_csr, A_coo, A_csc})
+        {
+            host_vector<T> hy(hy_0);
+
+            rocsparse_host_dnvec_descr x;
+            rocsparse_host_dnvec_descr y;
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnvec_descr(&x, x_size, hx.data(), ttype));
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnvec_descr(&y, y_size, hy.data(), ttype));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spmv(trans_A,
+                                                      &h_alpha,
+                                                      A,
+                                                      x,
+                                                      &h_beta,
+                                                      y,
+                                                      ttype,
+                                                      rocsparse_spmv_alg_default,
+                                                      rocsparse_spmv_stage_buffer_size,
+                                                      &buffer_size,
+                                                      nullptr));
+
+            hbuffer.resize(buffer_size);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spmv(trans_A,
+                                                      &h_alpha,
+                                                      A,
+                                                      x,
+                                                      &h_beta,
+                                                      y,
+                                                      ttype,
+                                                      rocsparse_spmv_alg_default,
+                                                      rocsparse_spmv_stage_preprocess,
+                                                      nullptr,
+                                                      hbuffer.data()));
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spmv(trans_A,
+                                                      &h_alpha,
+                                                      A,
+                                                      x,
+                                                      &h_beta,
+                                                      y,
+                                                      ttype,
+                                                      rocsparse_spmv_alg_default,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      hbuffer.data()));
+
+            hy_gold.near_check(hy);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(x));
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(y));
+        }
+    }
+
+    // --------------------------------------
+    // SpMM in all formats against host_csrmm
+    // --------------------------------------
+    {
+        J B_rows = (trans_A == rocsparse_operation_none) ? N : M;
+        J C_rows = (trans_A == rocsparse_operation_none) ? M : N;
+
+        host_vector<T> hB(size_t(B_rows) * K);
+        host_vector<T> hC_0(size_t(C_rows) * K);
+        host_vector<T> hC_gold;
+
+        rocsparse_init<T>(hB, B_rows, K, B_rows);
+        rocsparse_init<T>(hC_0, C_rows, K, C_rows);
+
+        hC_gold = hC_0;
+        host_csrmm<T, I, J>(M,
+                            K,
+                            N,
+                            trans_A,
+                            rocsparse_operation_none,
+                            h_alpha,
+                            hcsr_row_ptr.data(),
+                            hcsr_col_ind.data(),
+                            hcsr_val.data(),
+                            hB.data(),
+                            B_rows,
+                            rocsparse_order_column,
+                            h_beta,
+                            hC_gold.data(),
+                            C_rows,
+                            rocsparse_order_column,
+                            base,
+                            false);
+
+        for(rocsparse_host_spmat_descr A : {A_csr, A_coo, A_csc})
+        {
+            host_vector<T> hC(hC_0);
+
+            rocsparse_host_dnmat_descr B;
+            rocsparse_host_dnmat_descr C;
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnmat_descr(
+                &B, B_rows, K, B_rows, hB.data(), ttype, rocsparse_order_column));
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnmat_descr(
+                &C, C_rows, K, C_rows, hC.data(), ttype, rocsparse_order_column));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spmm(trans_A,
+                                                      rocsparse_operation_none,
+                                                      &h_alpha,
+                                                      A,
+                                                      B,
+                                                      &h_beta,
+                                                      C,
+                                                      ttype,
+                                                      rocsparse_spmm_alg_default,
+                                                      rocsparse_spmm_stage_buffer_size,
+                                                      &buffer_size,
+                                                      nullptr));
+
+            hbuffer.resize(buffer_size);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spmm(trans_A,
+                                                      rocsparse_operation_none,
+                                                      &h_alpha,
+                                                      A,
+                                                      B,
+                                                      &h_beta,
+                                                      C,
+                                                      ttype,
+                                                      rocsparse_spmm_alg_default,
+                                                      rocsparse_spmm_stage_compute,
+                                                      &buffer_size,
+                                                      hbuffer.data()));
+
+            hC_gold.near_check(hC);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnmat_descr(B));
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnmat_descr(C));
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // SpGEMM, C = alpha * A * A^T, where A^T is given by the CSC arrays of A
+    // ------------------------------------------------------------------------
+    {
+        host_vector<I> hcsr_row_ptr_C(M + 1);
+        host_vector<I> hcsr_row_ptr_gold(M + 1);
+
+        rocsparse_host_spmat_descr At;
+        rocsparse_host_spmat_descr C;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_create_csr_descr(&At,
+                                                              N,
+                                                              M,
+                                                              nnz_A,
+                                                              hcsc_col_ptr.data(),
+                                                              hcsc_row_ind.data(),
+                                                              hcsc_val.data(),
+                                                              itype,
+                                                              jtype,
+                                                              base,
+                                                              ttype));
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_create_csr_descr(&C,
+                                                              M,
+                                                              M,
+                                                              0,
+                                                              hcsr_row_ptr_C.data(),
+                                                              nullptr,
+                                                              nullptr,
+                                                              itype,
+                                                              jtype,
+                                                              base,
+                                                              ttype));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spgemm(rocsparse_operation_none,
+                                                    rocsparse_operation_none,
+                                                    &h_alpha,
+                                                    A_csr,
+                                                    At,
+                                                    nullptr,
+                                                    nullptr,
+                                                    C,
+                                                    ttype,
+                                                    rocsparse_spgemm_alg_default,
+                                                    rocsparse_spgemm_stage_buffer_size,
+                                                    &buffer_size,
+                                                    nullptr));
+
+        hbuffer.resize(buffer_size);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spgemm(rocsparse_operation_none,
+                                                    rocsparse_operation_none,
+                                                    &h_alpha,
+                                                    A_csr,
+                                                    At,
+                                                    nullptr,
+                                                    nullptr,
+                                                    C,
+                                                    ttype,
+                                                    rocsparse_spgemm_alg_default,
+                                                    rocsparse_spgemm_stage_nnz,
+                                                    &buffer_size,
+                                                    hbuffer.data()));
+
+        int64_t C_rows;
+        int64_t C_cols;
+        int64_t nnz_C;
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spmat_get_size(C, &C_rows, &C_cols, &nnz_C));
+
+        host_vector<J> hcsr_col_ind_C(nnz_C);
+        host_vector<T> hcsr_val_C(nnz_C);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_csr_set_pointers(
+            C, hcsr_row_ptr_C.data(), hcsr_col_ind_C.data(), hcsr_val_C.data()));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spgemm(rocsparse_operation_none,
+                                                    rocsparse_operation_none,
+                                                    &h_alpha,
+                                                    A_csr,
+                                                    At,
+                                                    nullptr,
+                                                    nullptr,
+                                                    C,
+                                                    ttype,
+                                                    rocsparse_spgemm_alg_default,
+                                                    rocsparse_spgemm_stage_compute,
+                                                    &buffer_size,
+                                                    hbuffer.data()));
+
+        I nnz_gold;
+        host_csrgemm_nnz<T, I, J>(M,
+                                  M,
+                                  N,
+                                  &h_alpha,
+                                  hcsr_row_ptr.data(),
+                                  hcsr_col_ind.data(),
+                                  hcsc_col_ptr.data(),
+                                  hcsc_row_ind.data(),
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  hcsr_row_ptr_gold.data(),
+                                  &nnz_gold,
+                                  base,
+                                  base,
+                                  base,
+                                  base);
+
+        host_vector<J> hcsr_col_ind_gold(nnz_gold);
+        host_vector<T> hcsr_val_gold(nnz_gold);
+
+        host_csrgemm<T, I, J>(M,
+                              M,
+                              N,
+                              &h_alpha,
+                              hcsr_row_ptr.data(),
+                              hcsr_col_ind.data(),
+                              hcsr_val.data(),
+                              hcsc_col_ptr.data(),
+                              hcsc_row_ind.data(),
+                              hcsc_val.data(),
+                              nullptr,
+                              nullptr,
+                              nullptr,
+                              nullptr,
+                              hcsr_row_ptr_gold.data(),
+                              hcsr_col_ind_gold.data(),
+                              hcsr_val_gold.data(),
+                              base,
+                              base,
+                              base,
+                              base);
+
+        unit_check_scalar<int64_t>(nnz_gold, nnz_C);
+        hcsr_row_ptr_gold.unit_check(hcsr_row_ptr_C);
+        hcsr_col_ind_gold.unit_check(hcsr_col_ind_C);
+        hcsr_val_gold.near_check(hcsr_val_C);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(At));
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(C));
+    }
+
+    // ------------------------------------------------------------------------
+    // SpSV against host_csrsv. The analysis of the preprocess stage has to be
+    // updated when the pattern (set_pointers) or the fill mode (set_attribute)
+    // of the matrix changes.
+    // ------------------------------------------------------------------------
+    if(M == N)
+    {
+        host_vector<T> hx(M);
+        host_vector<T> hy(M);
+
+        rocsparse_init<T>(hx, M, 1, 1);
+
+        rocsparse_host_dnvec_descr x;
+        rocsparse_host_dnvec_descr y;
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnvec_descr(&x, M, hx.data(), ttype));
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_create_dnvec_descr(&y, M, hy.data(), ttype));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spmat_set_attribute(
+            A_csr, rocsparse_spmat_diag_type, &diag, sizeof(diag)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spmat_set_attribute(
+            A_csr, rocsparse_spmat_fill_mode, &uplo, sizeof(uplo)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(trans_A,
+                                                  &h_alpha,
+                                                  A_csr,
+                                                  x,
+                                                  y,
+                                                  ttype,
+                                                  rocsparse_spsv_alg_default,
+                                                  rocsparse_spsv_stage_buffer_size,
+                                                  &buffer_size,
+                                                  nullptr));
+
+        hbuffer.resize(buffer_size);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(trans_A,
+                                                  &h_alpha,
+                                                  A_csr,
+                                                  x,
+                                                  y,
+                                                  ttype,
+                                                  rocsparse_spsv_alg_default,
+                                                  rocsparse_spsv_stage_preprocess,
+                                                  nullptr,
+                                                  hbuffer.data()));
+
+        auto check_spsv = [&](const host_vector<I>& row_ptr,
+                              const host_vector<J>& col_ind,
+                              const host_vector<T>& val,
+                              rocsparse_fill_mode   fill_mode) {
+            CHECK_ROCSPARSE_ERROR(rocsparse_host_spsv(trans_A,
+                                                      &h_alpha,
+                                                      A_csr,
+                                                      x,
+                                                      y,
+                                                      ttype,
+                                                      rocsparse_spsv_alg_default,
+                                                      rocsparse_spsv_stage_compute,
+                                                      nullptr,
+                                                      hbuffer.data()));
+
+            host_vector<T> hy_gold(M);
+
+            J struct_pivot  = -1;
+            J numeric_pivot = -1;
+            host_csrsv<I, J, T>(trans_A,
+                                M,
+                                nnz_A,
+                                h_alpha,
+                                row_ptr.data(),
+                                col_ind.data(),
+                                val.data(),
+                                hx.data(),
+                                (int64_t)1,
+                                hy_gold.data(),
+                                diag,
+                                fill_mode,
+                                base,
+                                &struct_pivot,
+                                &numeric_pivot);
+
+            if(struct_pivot == -1 && numeric_pivot == -1)
+            {
+                hy_gold.near_check(hy);
+            }
+        };
+
+        check_spsv(hcsr_row_ptr, hcsr_col_ind, hcsr_val, uplo);
+
+        // Same number of non-zeros, transposed pattern
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_csr_set_pointers(
+            A_csr, hcsc_col_ptr.data(), hcsc_row_ind.data(), hcsc_val.data()));
+
+        check_spsv(hcsc_col_ptr, hcsc_row_ind, hcsc_val, uplo);
+
+        // Opposite triangular part
+        rocsparse_fill_mode flipped_uplo = (uplo == rocsparse_fill_mode_lower)
+                                               ? rocsparse_fill_mode_upper
+                                               : rocsparse_fill_mode_lower;
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_spmat_set_attribute(
+            A_csr, rocsparse_spmat_fill_mode, &flipped_uplo, sizeof(flipped_uplo)));
+
+        check_spsv(hcsc_col_ptr, hcsc_row_ind, hcsc_val, flipped_uplo);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(x));
+        CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_dnvec_descr(y));
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(A_csr));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(A_coo));
+    CHECK_ROCSPARSE_ERROR(rocsparse_host_destroy_spmat_descr(A_csc));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                   \
+    template void testing_host_generic_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_host_generic<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,226 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "rocsparse_matrix_factory_file.hpp"
+
+// Imports a Matrix Market file into CSR format and compares it with the expected arrays.
+template <typename T>
+static void testing_import_mtx(const char*                       content,
+                               rocsparse_index_base              base,
+                               rocsparse_int                     M_gold,
+                               rocsparse_int                     N_gold,
+                               const host_vector<rocsparse_int>& hcsr_row_ptr_gold,
+                               const host_vector<rocsparse_int>& hcsr_col_ind_gold,
+                               const host_vector<T>&             hcsr_val_gold)
+{
+    const std::string filename = rocsparse_write_tmp_mtx(content);
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_int M;
+    rocsparse_int N;
+    rocsparse_int nnz;
+
+    rocsparse_matrix_factory_mtx<T> matrix_factory(filename.c_str());
+    matrix_factory.init_csr(hcsr_row_ptr,
+                            hcsr_col_ind,
+                            hcsr_val,
+                            M,
+                            N,
+                            nnz,
+                            base,
+                            rocsparse_matrix_type_general,
+                            rocsparse_fill_mode_lower,
+                            rocsparse_storage_mode_sorted);
+
+    remove(filename.c_str());
+
+    // The expected arrays are zero based
+    host_vector<rocsparse_int> hcsr_row_ptr_base(hcsr_row_ptr_gold);
+    host_vector<rocsparse_int> hcsr_col_ind_base(hcsr_col_ind_gold);
+    for(auto& p : hcsr_row_ptr_base)
+    {
+        p += base;
+    }
+    for(auto& c : hcsr_col_ind_base)
+    {
+        c += base;
+    }
+
+    unit_check_scalar<rocsparse_int>(M_gold, M);
+    unit_check_scalar<rocsparse_int>(N_gold, N);
+    unit_check_scalar<rocsparse_int>(hcsr_col_ind_gold.size(), nnz);
+
+    hcsr_row_ptr_base.unit_check(hcsr_row_ptr);
+    hcsr_col_ind_base.unit_check(hcsr_col_ind);
+    hcsr_val_gold.unit_check(hcsr_val);
+}
+
+// Imports a Matrix Market file into CSR format and returns the status of the import.
+template <typename T>
+static rocsparse_status testing_import_mtx_status(const char* filename, rocsparse_index_base base)
+{
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+    rocsparse_int              M, N, nnz;
+
+    try
+    {
+        rocsparse_init_csr_mtx(filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    }
+    catch(rocsparse_status status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+template <typename T>
+void testing_importer_matrixmarket_bad_arg(const Arguments& arg)
+{
+    // Invalid banners, and entries that do not match the declared number of entries
+    static const char* invalid[] = {"%MatrixMarket matrix coordinate real general\n"
+                                    "1 1 1\n"
+                                    "1 1 1.0\n",
+                                    "%%MatrixMarket matrix coordinate real\n"
+                                    "1 1 1\n"
+                                    "1 1 1.0\n",
+                                    "%%MatrixMarket vector coordinate real general\n"
+                                    "1 1 1\n"
+                                    "1 1 1.0\n",
+                                    "%%MatrixMarket matrix array real general\n"
+                                    "1 1\n"
+                                    "1.0\n",
+                                    "%%MatrixMarket matrix coordinate quaternion general\n"
+                                    "1 1 1\n"
+                                    "1 1 1.0\n",
+                                    "%%MatrixMarket matrix coordinate real hankel\n"
+                                    "1 1 1\n"
+                                    "1 1 1.0\n",
+                                    "%%MatrixMarket matrix coordinate real general\n"
+                                    "2 2 3\n"
+                                    "1 1 1.0\n"
+                                    "2 2 2.0\n"};
+
+    for(const char* content : invalid)
+    {
+        const std::string filename = rocsparse_write_tmp_mtx(content);
+        EXPECT_ROCSPARSE_STATUS(testing_import_mtx_status<T>(filename.c_str(), arg.baseA),
+                                rocsparse_status_internal_error);
+        remove(filename.c_str());
+    }
+}
+
+void testing_importer_matrixmarket_extra(const Arguments& arg)
+{
+    // ------------------------------------------------------------------
+    // Hermitian matrix, the mirrored entries are conjugated
+    //
+    //     [ 2        1 + i      ]
+    //     [ 1 - i           -2i ]
+    //     [          2i       4 ]
+    // ------------------------------------------------------------------
+    static const char* hermitian = "%%MatrixMarket matrix coordinate complex hermitian\n"
+                                   "% lower triangular part\n"
+                                   "3 3 4\n"
+                                   "1 1 2.0 0.0\n"
+                                   "2 1 1.0 -1.0\n"
+                                   "3 2 0.0 2.0\n"
+                                   "3 3 4.0 0.0";
+
+    const host_vector<rocsparse_int> hcsr_row_ptr{0, 2, 4, 6};
+    const host_vector<rocsparse_int> hcsr_col_ind{0, 1, 0, 2, 1, 2};
+
+    testing_import_mtx<rocsparse_float_complex>(
+        hermitian,
+        arg.baseA,
+        3,
+        3,
+        hcsr_row_ptr,
+        hcsr_col_ind,
+        host_vector<rocsparse_float_complex>{{2.0f, 0.0f},
+                                             {1.0f, 1.0f},
+                                             {1.0f, -1.0f},
+                                             {0.0f, -2.0f},
+                                             {0.0f, 2.0f},
+                                             {4.0f, 0.0f}});
+
+    testing_import_mtx<rocsparse_double_complex>(hermitian,
+                                                 arg.baseA,
+                                                 3,
+                                                 3,
+                                                 hcsr_row_ptr,
+                                                 hcsr_col_ind,
+                                                 host_vector<rocsparse_double_complex>{{2.0, 0.0},
+                                                                                       {1.0, 1.0},
+                                                                                       {1.0, -1.0},
+                                                                                       {0.0, -2.0},
+                                                                                       {0.0, 2.0},
+                                                                                       {4.0, 0.0}});
+}
+
+template <typename T>
+void testing_importer_matrixmarket(const Arguments& arg)
+{
+    // ------------------------------------------------------------------
+    // Skew-symmetric matrix, the mirrored entries are negated
+    //
+    //     [       -1.5   2         ]
+    //     [  1.5                   ]
+    //     [ -2               -0.5  ]
+    //     [              0.5       ]
+    // ------------------------------------------------------------------
+    static const char* skew_symmetric = "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+                                        "4 4 3\n"
+                                        "2 1 1.5\n"
+                                        "3 1 -2.0\n"
+                                        "4 3 0.5\n";
+
+    testing_import_mtx<T>(
+        skew_symmetric,
+        arg.baseA,
+        4,
+        4,
+        host_vector<rocsparse_int>{0, 2, 3, 5, 6},
+        host_vector<rocsparse_int>{1, 2, 0, 0, 3, 2},
+        host_vector<T>{static_cast<T>(-1.5),
+                       static_cast<T>(2.0),
+                       static_cast<T>(1.5),
+                       static_cast<T>(-2.0),
+                       static_cast<T>(-0.5),
+                       static_cast<T>(0.5)});
+}
+
+#define INSTANTIATE(TTYPE)                                                            \
+    template void testing_importer_matrixmarket_bad_arg<TTYPE>(const Arguments& arg); \
+    template void testing_importer_matrixmarket<TTYPE>(const Arguments& arg)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -52,6 +52,7 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_gebsr)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_hyb)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_spmat)	        \
+  TRANSFORM_ROCSPARSE_TEST_ENUM(clients_matrices_cache)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnmat_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnvec_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_spmat_descr)      \
@@ -115,9 +116,11 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot_strided_batch) \
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_interleaved_batch)	\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(host_generic)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hyb2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hybmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(identity)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(importer_matrixmarket)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(inverse_permutation)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(nnz)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_percentage)		\
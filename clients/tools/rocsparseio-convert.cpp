@@ -25,10 +25,14 @@
 #include "rocsparseio.h"
 #include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <complex>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <math.h>
+#include <queue>
+#include <string>
 #include <vector>
 
 namespace rocsparseio
@@ -179,7 +183,8 @@ struct mtx_header
     int  symmetric;
 };
 
-bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header)
+template <typename I>
+bool read_mtx_header(FILE* f, I& nrow, I& ncol, I& nnz, mtx_header& header)
 {
     char line[1024];
 
@@ -257,7 +262,11 @@ bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header
     }
 
     // Read dimensions
-    sscanf(line, "%d %d %d", &nrow, &ncol, &nnz);
+    int64_t dims[3] = {};
+    sscanf(line, "%" SCNd64 " %" SCNd64 " %" SCNd64, &dims[0], &dims[1], &dims[2]);
+    nrow = dims[0];
+    ncol = dims[1];
+    nnz  = dims[2];
 
     return true;
 }
@@ -504,7 +513,7 @@ int mtx2csr(const char* ifilename, const char* ofilename)
     return 0;
 }
 
-int csr2rocsparseio(const char* ifilename, const char* ofilename)
+int csr2rocsparseio(const char* ifilename, const char* ofilename, bool compress)
 {
     // Read matrix
     std::ifstream fin(ifilename, std::ios::in | std::ios::binary);
@@ -550,6 +559,11 @@ int csr2rocsparseio(const char* ifilename, const char* ofilename)
         rocsparseio_status status;
         rocsparseio_handle handle;
         status = rocsparseio_open(&handle, rocsparseio_rwmode_write, ofilename);
+        if(compress)
+        {
+            status = rocsparseiox_set_codecs(
+                handle, rocsparseio_codec_delta_varint, rocsparseio_codec_byte_shuffle);
+        }
 
         status = rocsparseio_write_sparse_csx(handle,
                                               rocsparseio_direction_row,
@@ -1135,7 +1149,7 @@ rocsparseio_status rocsparseio2csr(const char* ifilename, const char* ofilename)
     return status;
 }
 
-int mtx2rocsparseio(const char* ifilename, const char* ofilename)
+int mtx2rocsparseio(const char* ifilename, const char* ofilename, bool compress)
 {
     // Matrix dimensions
     int m;
@@ -1196,6 +1210,11 @@ int mtx2rocsparseio(const char* ifilename, const char* ofilename)
         rocsparseio_status status;
         rocsparseio_handle handle;
         status = rocsparseio_open(&handle, rocsparseio_rwmode_write, ofilename);
+        if(compress)
+        {
+            status = rocsparseiox_set_codecs(
+                handle, rocsparseio_codec_delta_varint, rocsparseio_codec_byte_shuffle);
+        }
 
         if(is_complex)
         {
@@ -1235,6 +1254,640 @@ int mtx2rocsparseio(const char* ifilename, const char* ofilename)
     return 0;
 }
 
+//
+// Out-of-core conversion from .mtx to .rocsparseio. Runs of entries fitting in the memory budget
+// are sorted and spilled to temporary files, next to the output file. The runs are then k-way
+// merged, in several passes if there are too many of them, into a CSR or BSR matrix written by
+// batches of (block) rows.
+//
+static constexpr size_t mtx_merge_min_buffer_size = size_t(64) << 10;
+static constexpr int    mtx_default_memory_budget = 1024;
+
+template <typename T>
+struct mtx_entry_t
+{
+    int64_t row;
+    int64_t col;
+    T       val;
+};
+
+//
+// Order by block row, block column, row and column; a block dimension of 1 is the row-major
+// order.
+//
+template <typename T>
+struct mtx_entry_less_t
+{
+    int64_t block_dim;
+
+    bool operator()(const mtx_entry_t<T>& a, const mtx_entry_t<T>& b) const
+    {
+        const int64_t arowb = a.row / block_dim;
+        const int64_t browb = b.row / block_dim;
+        if(arowb != browb)
+        {
+            return arowb < browb;
+        }
+        const int64_t acolb = a.col / block_dim;
+        const int64_t bcolb = b.col / block_dim;
+        if(acolb != bcolb)
+        {
+            return acolb < bcolb;
+        }
+        return (a.row != b.row) ? (a.row < b.row) : (a.col < b.col);
+    }
+};
+
+//
+// The mirror of a real entry is the entry itself, for symmetric and hermitian matrices.
+//
+double mirror_value(double val, bool)
+{
+    return val;
+}
+
+std::complex<double> mirror_value(const std::complex<double>& val, bool hermitian)
+{
+    return hermitian ? std::conj(val) : val;
+}
+
+std::string mtx_run_filename(const char* ofilename, int pass, size_t i)
+{
+    return std::string(ofilename) + ".run." + std::to_string(pass) + "." + std::to_string(i);
+}
+
+void remove_mtx_runs(const std::vector<std::string>& runs)
+{
+    for(const std::string& run : runs)
+    {
+        remove(run.c_str());
+    }
+}
+
+//
+// Buffered reader of a sorted run.
+//
+template <typename T>
+struct mtx_run_reader_t
+{
+    FILE*                       f{};
+    std::vector<mtx_entry_t<T>> buffer;
+    size_t                      pos{};
+    size_t                      size{};
+
+    bool next(mtx_entry_t<T>& entry)
+    {
+        if(pos == size)
+        {
+            pos  = 0;
+            size = fread(buffer.data(), sizeof(mtx_entry_t<T>), buffer.size(), f);
+            if(size == 0)
+            {
+                return false;
+            }
+        }
+        entry = buffer[pos++];
+        return true;
+    }
+};
+
+//
+// Sort a run, sum its duplicates and write it to a temporary file.
+//
+template <typename T>
+bool spill_mtx_run(std::vector<mtx_entry_t<T>>& run,
+                   const mtx_entry_less_t<T>&   less,
+                   const std::string&           filename)
+{
+    std::sort(run.begin(), run.end(), less);
+    size_t nentries = 0;
+    for(size_t i = 0; i < run.size(); ++i)
+    {
+        if(nentries > 0 && run[nentries - 1].row == run[i].row
+           && run[nentries - 1].col == run[i].col)
+        {
+            run[nentries - 1].val += run[i].val;
+        }
+        else
+        {
+            run[nentries++] = run[i];
+        }
+    }
+
+    FILE* f = fopen(filename.c_str(), "wb");
+    if(!f)
+    {
+        return false;
+    }
+    const bool status = (fwrite(run.data(), sizeof(mtx_entry_t<T>), nentries, f) == nentries);
+    return (0 == fclose(f)) && status;
+}
+
+//
+// Read the entries of a .mtx file into sorted runs of at most budget bytes, symmetric entries
+// being expanded.
+//
+template <typename T>
+bool read_mtx_runs(FILE*                      f,
+                   const mtx_header&          header,
+                   int64_t                    m,
+                   int64_t                    n,
+                   size_t                     budget,
+                   const mtx_entry_less_t<T>& less,
+                   const char*                ofilename,
+                   std::vector<std::string>&  runs)
+{
+    const bool pattern   = !strcmp(header.data, "pattern");
+    const bool cplx      = !strcmp(header.data, "complex");
+    const bool hermitian = !strcmp(header.type, "hermitian");
+    const int  nfields   = pattern ? 2 : (cplx ? 4 : 3);
+
+    std::vector<mtx_entry_t<T>> run;
+    run.reserve(std::max(budget / sizeof(mtx_entry_t<T>), size_t(1)));
+
+    auto push = [&](const mtx_entry_t<T>& entry) {
+        if(run.size() == run.capacity())
+        {
+            runs.push_back(mtx_run_filename(ofilename, 0, runs.size()));
+            if(!spill_mtx_run(run, less, runs.back()))
+            {
+                return false;
+            }
+            run.clear();
+        }
+        run.push_back(entry);
+        return true;
+    };
+
+    char line[1024];
+    while(fgets(line, 1024, f))
+    {
+        int64_t irow;
+        int64_t icol;
+        double  rval = 1.0;
+        double  ival = 0.0;
+
+        const int count
+            = sscanf(line, "%" SCNd64 " %" SCNd64 " %lg %lg", &irow, &icol, &rval, &ival);
+        if(count == EOF)
+        {
+            continue;
+        }
+        if(count < nfields || irow < 1 || irow > m || icol < 1 || icol > n)
+        {
+            return false;
+        }
+
+        mtx_entry_t<T> entry;
+        entry.row = irow - 1;
+        entry.col = icol - 1;
+        set_value(entry.val, rval, ival);
+        if(pattern)
+        {
+            entry.val = 1.0;
+        }
+        if(!push(entry))
+        {
+            return false;
+        }
+
+        if(header.symmetric && entry.row != entry.col)
+        {
+            std::swap(entry.row, entry.col);
+            entry.val = mirror_value(entry.val, hermitian);
+            if(!push(entry))
+            {
+                return false;
+            }
+        }
+    }
+
+    if(!run.empty() || runs.empty())
+    {
+        runs.push_back(mtx_run_filename(ofilename, 0, runs.size()));
+        return spill_mtx_run(run, less, runs.back());
+    }
+    return true;
+}
+
+//
+// Merge sorted runs with a buffer of nentries per run, the merged entries with equal
+// coordinates are summed and passed to sink, in order.
+//
+template <typename T, typename F>
+bool merge_mtx_runs(const std::vector<std::string>& runs,
+                    size_t                          nentries,
+                    const mtx_entry_less_t<T>&      less,
+                    F&                              sink)
+{
+    typedef std::pair<mtx_entry_t<T>, size_t> item_t;
+    auto greater = [&less](const item_t& a, const item_t& b) { return less(b.first, a.first); };
+    std::priority_queue<item_t, std::vector<item_t>, decltype(greater)> heap(greater);
+
+    bool                             status = true;
+    std::vector<mtx_run_reader_t<T>> readers(runs.size());
+    for(size_t i = 0; i < runs.size(); ++i)
+    {
+        readers[i].f = fopen(runs[i].c_str(), "rb");
+        if(!readers[i].f)
+        {
+            status = false;
+            break;
+        }
+        readers[i].buffer.resize(nentries);
+        mtx_entry_t<T> entry;
+        if(readers[i].next(entry))
+        {
+            heap.push(item_t(entry, i));
+        }
+    }
+
+    bool           pending = false;
+    mtx_entry_t<T> current;
+    while(status && !heap.empty())
+    {
+        const item_t top = heap.top();
+        heap.pop();
+
+        mtx_entry_t<T> entry;
+        if(readers[top.second].next(entry))
+        {
+            heap.push(item_t(entry, top.second));
+        }
+
+        if(pending && current.row == top.first.row && current.col == top.first.col)
+        {
+            current.val += top.first.val;
+        }
+        else
+        {
+            if(pending)
+            {
+                status = sink(current);
+            }
+            current = top.first;
+            pending = true;
+        }
+    }
+    if(status && pending)
+    {
+        status = sink(current);
+    }
+
+    for(auto& reader : readers)
+    {
+        if(reader.f)
+        {
+            status = status && !ferror(reader.f);
+            fclose(reader.f);
+        }
+    }
+    return status;
+}
+
+//
+// Merge runs into the sink with a fan-in and buffers bounded by the memory budget, by merging
+// groups of runs into longer runs as long as there are too many of them.
+//
+template <typename T, typename F>
+bool merge_mtx_runs_by_passes(std::vector<std::string>&  runs,
+                              size_t                     budget,
+                              const mtx_entry_less_t<T>& less,
+                              const char*                ofilename,
+                              bool                       verbose,
+                              F&                         sink)
+{
+    //
+    // One buffer per merged run, plus one for the output.
+    //
+    const size_t fanin    = std::max(budget / mtx_merge_min_buffer_size, size_t(3)) - 1;
+    const size_t nentries = std::max(budget / (fanin + 1) / sizeof(mtx_entry_t<T>), size_t(1));
+    for(int pass = 1; runs.size() > fanin; ++pass)
+    {
+        if(verbose)
+        {
+            std::cout << "merge pass " << pass << ": " << runs.size() << " runs" << std::endl;
+        }
+
+        std::vector<std::string> merged;
+        for(size_t i = 0; i < runs.size(); i += fanin)
+        {
+            const std::vector<std::string> group(runs.begin() + i,
+                                                 runs.begin() + std::min(i + fanin, runs.size()));
+            merged.push_back(mtx_run_filename(ofilename, pass, merged.size()));
+            FILE* out = fopen(merged.back().c_str(), "wb");
+            bool  status = (out != nullptr);
+
+            std::vector<mtx_entry_t<T>> buffer;
+            buffer.reserve(nentries);
+            auto spill = [&](const mtx_entry_t<T>& entry) {
+                buffer.push_back(entry);
+                if(buffer.size() == nentries)
+                {
+                    const bool ok = (fwrite(buffer.data(), sizeof(mtx_entry_t<T>), nentries, out)
+                                     == nentries);
+                    buffer.clear();
+                    return ok;
+                }
+                return true;
+            };
+
+            status = status && merge_mtx_runs(group, nentries, less, spill)
+                     && (fwrite(buffer.data(), sizeof(mtx_entry_t<T>), buffer.size(), out)
+                         == buffer.size());
+            if(out && 0 != fclose(out))
+            {
+                status = false;
+            }
+            remove_mtx_runs(group);
+            if(!status)
+            {
+                remove_mtx_runs(merged);
+                runs.erase(runs.begin(), runs.begin() + std::min(i + fanin, runs.size()));
+                return false;
+            }
+        }
+        runs.swap(merged);
+    }
+
+    if(verbose)
+    {
+        std::cout << "final merge: " << runs.size() << " runs" << std::endl;
+    }
+    return merge_mtx_runs(runs, nentries, less, sink);
+}
+
+//
+// Assemble the merged entries into block rows of square blocks of dimension block_dim, stored
+// row-major, and stream them by batches of at most batch_size bytes (a block row is never
+// split). A block dimension of 1 streams a CSR matrix.
+//
+template <typename T, typename I>
+struct mtx_stream_sink_t
+{
+    rocsparseio_handle handle{};
+    int64_t            block_dim{};
+    int64_t            mb{};
+    size_t             batch_size{};
+    int64_t            nrowsb{};
+    std::vector<I>     ptr{0};
+    std::vector<I>     ind{};
+    std::vector<T>     val{};
+
+    bool flush()
+    {
+        if(ptr.size() == 1)
+        {
+            return true;
+        }
+        const rocsparseio_status status
+            = (block_dim == 1)
+                  ? rocsparseiox_stream_sparse_csx_rows(
+                      handle, ptr.size() - 1, ptr.data(), ind.data(), val.data())
+                  : rocsparseiox_stream_sparse_gebsx_rows(
+                      handle, ptr.size() - 1, ptr.data(), ind.data(), val.data());
+        nrowsb += ptr.size() - 1;
+        ptr.assign(1, 0);
+        ind.clear();
+        val.clear();
+        return status == rocsparseio_status_success;
+    }
+
+    bool close_row()
+    {
+        ptr.push_back(ind.size());
+        if(ptr.size() * sizeof(I) + ind.size() * sizeof(I) + val.size() * sizeof(T) >= batch_size)
+        {
+            return flush();
+        }
+        return true;
+    }
+
+    bool operator()(const mtx_entry_t<T>& entry)
+    {
+        const int64_t rowb = entry.row / block_dim;
+        const int64_t colb = entry.col / block_dim;
+        while(nrowsb + int64_t(ptr.size()) - 1 < rowb)
+        {
+            if(!close_row())
+            {
+                return false;
+            }
+        }
+
+        const size_t block_size = block_dim * block_dim;
+        if(ind.size() == size_t(ptr.back()) || ind.back() != colb)
+        {
+            ind.push_back(colb);
+            val.resize(val.size() + block_size, T(0));
+        }
+        val[val.size() - block_size + (entry.row % block_dim) * block_dim + entry.col % block_dim]
+            += entry.val;
+        return true;
+    }
+
+    bool finish()
+    {
+        while(nrowsb + int64_t(ptr.size()) - 1 < mb)
+        {
+            if(!close_row())
+            {
+                return false;
+            }
+        }
+        return flush();
+    }
+};
+
+template <typename T, typename I>
+int mtx2rocsparseio_external_template(FILE*             f,
+                                      const mtx_header& header,
+                                      const char*       ifilename,
+                                      const char*       ofilename,
+                                      int64_t           m,
+                                      int64_t           n,
+                                      rocsparseio_type  ind_type,
+                                      rocsparseio_type  val_type,
+                                      size_t            budget,
+                                      int64_t           block_dim,
+                                      bool              verbose)
+{
+    const mtx_entry_less_t<T> less{block_dim};
+    std::vector<std::string>  runs;
+    if(!read_mtx_runs(f, header, m, n, budget, less, ofilename, runs))
+    {
+        std::cerr << "Cannot read .mtx data from " << ifilename << " into sorted runs."
+                  << std::endl;
+        remove_mtx_runs(runs);
+        return -1;
+    }
+
+    if(verbose)
+    {
+        std::cout << "sorted runs: " << runs.size() << std::endl;
+    }
+
+    const int64_t mb = (m + block_dim - 1) / block_dim;
+    const int64_t nb = (n + block_dim - 1) / block_dim;
+
+    rocsparseio_handle handle;
+    rocsparseio_status status = rocsparseio_open(&handle, rocsparseio_rwmode_write, ofilename);
+    if(status != rocsparseio_status_success)
+    {
+        std::cerr << "Cannot open [write] " << ofilename << std::endl;
+        remove_mtx_runs(runs);
+        return -1;
+    }
+
+    //
+    // The memory budget is shared by the merge buffers, the batch of rows and the buffer of
+    // the streaming writer.
+    //
+    const size_t share = budget / 4;
+    if(block_dim == 1)
+    {
+        status = rocsparseiox_stream_sparse_csx_begin(handle,
+                                                      rocsparseio_direction_row,
+                                                      m,
+                                                      n,
+                                                      ind_type,
+                                                      ind_type,
+                                                      val_type,
+                                                      rocsparseio_index_base_zero,
+                                                      share);
+    }
+    else
+    {
+        status = rocsparseiox_stream_sparse_gebsx_begin(handle,
+                                                        rocsparseio_direction_row,
+                                                        rocsparseio_direction_row,
+                                                        mb,
+                                                        nb,
+                                                        block_dim,
+                                                        block_dim,
+                                                        ind_type,
+                                                        ind_type,
+                                                        val_type,
+                                                        rocsparseio_index_base_zero,
+                                                        share);
+    }
+
+    mtx_stream_sink_t<T, I> sink{handle, block_dim, mb, share};
+    const bool              merged
+        = (status == rocsparseio_status_success)
+          && merge_mtx_runs_by_passes(runs, budget - 2 * share, less, ofilename, verbose, sink)
+          && sink.finish();
+    remove_mtx_runs(runs);
+
+    status = rocsparseio_close(handle);
+    if(!merged || status != rocsparseio_status_success)
+    {
+        std::cerr << "Cannot merge the sorted runs of " << ifilename << " into " << ofilename
+                  << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+int mtx2rocsparseio_external(
+    const char* ifilename, const char* ofilename, size_t budget, int64_t block_dim, bool verbose)
+{
+    // Matrix dimensions
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+
+    // Matrix mtx header
+    mtx_header header;
+
+    // Open file for reading
+    FILE* f = fopen(ifilename, "r");
+    if(!f)
+    {
+        std::cerr << "Cannot open [read] .mtx file " << ifilename << std::endl;
+        return -1;
+    }
+
+    if(!read_mtx_header(f, m, n, nnz, header))
+    {
+        std::cerr << "Cannot read .mtx header from " << ifilename << std::endl;
+        fclose(f);
+        return -1;
+    }
+
+    //
+    // 32-bit offsets and indices if the expanded number of entries fits.
+    //
+    const int64_t          nnz_bound = header.symmetric ? 2 * nnz : nnz;
+    const rocsparseio_type ind_type
+        = (std::max(nnz_bound, std::max(m, n)) <= std::numeric_limits<int32_t>::max())
+              ? rocsparseio_type_int32
+              : rocsparseio_type_int64;
+
+    const bool cplx = !strcmp(header.data, "complex");
+    int        status;
+    if(cplx && ind_type == rocsparseio_type_int32)
+    {
+        status = mtx2rocsparseio_external_template<std::complex<double>, int32_t>(
+            f,
+            header,
+            ifilename,
+            ofilename,
+            m,
+            n,
+            ind_type,
+            rocsparseio_type_complex64,
+            budget,
+            block_dim,
+            verbose);
+    }
+    else if(cplx)
+    {
+        status = mtx2rocsparseio_external_template<std::complex<double>, int64_t>(
+            f,
+            header,
+            ifilename,
+            ofilename,
+            m,
+            n,
+            ind_type,
+            rocsparseio_type_complex64,
+            budget,
+            block_dim,
+            verbose);
+    }
+    else if(ind_type == rocsparseio_type_int32)
+    {
+        status = mtx2rocsparseio_external_template<double, int32_t>(f,
+                                                                    header,
+                                                                    ifilename,
+                                                                    ofilename,
+                                                                    m,
+                                                                    n,
+                                                                    ind_type,
+                                                                    rocsparseio_type_float64,
+                                                                    budget,
+                                                                    block_dim,
+                                                                    verbose);
+    }
+    else
+    {
+        status = mtx2rocsparseio_external_template<double, int64_t>(f,
+                                                                    header,
+                                                                    ifilename,
+                                                                    ofilename,
+                                                                    m,
+                                                                    n,
+                                                                    ind_type,
+                                                                    rocsparseio_type_float64,
+                                                                    budget,
+                                                                    block_dim,
+                                                                    verbose);
+    }
+    fclose(f);
+    return status;
+}
+
 //
 //
 //
@@ -1251,11 +1904,23 @@ void usage(const char* appname_)
     fprintf(stderr, "OPTIONS\n");
     fprintf(stderr, "       -v, --verbose\n");
     fprintf(stderr, "              use verbose of information.\n");
+    fprintf(stderr, "       -c, --compress\n");
+    fprintf(stderr, "              encode the indices and values of a rocsparseio output file.\n");
+    fprintf(stderr, "       -m, --memory <MiB>\n");
+    fprintf(stderr, "              convert a .mtx file out-of-core within <MiB> of memory.\n");
+    fprintf(stderr, "       -b, --block-dim <dim>\n");
+    fprintf(stderr, "              convert a .mtx file out-of-core into a bsr matrix of blocks\n");
+    fprintf(stderr, "              of dimension <dim>.\n");
     fprintf(stderr, "       -h, --help\n");
     fprintf(stderr, "              produces this help and exit.\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "NOTES\n");
     fprintf(stderr, "\n");
+    fprintf(stderr, "       The out-of-core conversion spills sorted runs of entries to\n");
+    fprintf(stderr, "       temporary files next to the output file, duplicated entries are\n");
+    fprintf(stderr, "       summed and the output is not compressed. The default memory budget\n");
+    fprintf(stderr, "       is %d MiB.\n", mtx_default_memory_budget);
+    fprintf(stderr, "\n");
 }
 
 const char* get_file_extension(const char* filename)
@@ -1283,7 +1948,19 @@ int main(int argc, char** argv)
         return ROCSPARSEIO_STATUS_SUCCESS;
     }
 
-    const bool verbose = cmd.option("-v");
+    const bool verbose  = cmd.option("-v");
+    const bool compress = cmd.option("-c") || cmd.option("--compress");
+
+    long int   memory     = 0;
+    long int   block_dim  = 0;
+    const bool has_memory = cmd.option("-m", &memory) || cmd.option("--memory", &memory);
+    const bool has_block  = cmd.option("-b", &block_dim) || cmd.option("--block-dim", &block_dim);
+    const bool external   = has_memory || has_block;
+    if(external && (memory < 0 || block_dim < 0))
+    {
+        std::cerr << "invalid memory budget or block dimension" << std::endl;
+        return 1;
+    }
 
     char ofilename[512];
     if(false == cmd.option("-o", ofilename))
@@ -1394,7 +2071,7 @@ int main(int argc, char** argv)
             //
             // convert csr 2 rocsparseio
             //
-            return csr2rocsparseio(ifilename, ofilename);
+            return csr2rocsparseio(ifilename, ofilename, compress);
         }
         }
         break;
@@ -1423,7 +2100,13 @@ int main(int argc, char** argv)
         }
         case rocsparseio::file_format_t::rocsparseio:
         {
-            return mtx2rocsparseio(ifilename, ofilename);
+            if(external)
+            {
+                const size_t budget = size_t(memory > 0 ? memory : mtx_default_memory_budget) << 20;
+                return mtx2rocsparseio_external(
+                    ifilename, ofilename, budget, std::max(block_dim, 1L), verbose);
+            }
+            return mtx2rocsparseio(ifilename, ofilename, compress);
         }
         }
     }
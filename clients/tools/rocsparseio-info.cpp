@@ -25,41 +25,360 @@
 #include <algorithm>
 #include <chrono>
 #include <complex>
+#include <iomanip>
 #include <iostream>
 #include <math.h>
+#include <vector>
 using rocsparseio_float_complex  = std::complex<float>;
 using rocsparseio_double_complex = std::complex<double>;
 
-typedef struct
+//
+// Analytics of a compressed sparse matrix, used to select the storage format and the spmv/spmm
+// algorithms before the matrix is moved to the device. They are gathered in a single pass over
+// the sequences (rows, or columns with the csc storage), by chunks of sequences holding complete
+// block rows of all candidate block dimensions, each thread accumulating its own partial
+// analytics. The symmetry is checked with order-independent fingerprints of the entries and of
+// the transposed entries, which can only collide with a negligible probability.
+//
+#define ROCSPARSEIO_INFO_BLOCK_DIM_MIN 2
+#define ROCSPARSEIO_INFO_BLOCK_DIM_MAX 8
+#define ROCSPARSEIO_INFO_CHUNK_NSEQ 840 // Least common multiple of the block dimensions.
+
+struct rocsparseio_csx_analytics_t
 {
+    std::vector<uint64_t> length_count; // Number of sequences per number of non-zeros.
+    uint64_t              ninvalid{};
+    uint64_t              lower_bandwidth{};
+    uint64_t              upper_bandwidth{};
+    uint64_t              min_distance{UINT64_MAX}; // Of the off-diagonal entries.
+    uint64_t              profile{};
+    uint64_t              ndiag{};
+    uint64_t              nweak_dominant{};
+    uint64_t              nstrict_dominant{};
+    uint64_t              hyb_ell_nnz{};
+    uint64_t              pattern_fingerprint{};
+    uint64_t              pattern_fingerprint_tr{};
+    uint64_t              value_fingerprint{};
+    uint64_t              value_fingerprint_tr{};
+    uint64_t              nblocks[ROCSPARSEIO_INFO_BLOCK_DIM_MAX + 1]{};
+
+    void merge(const rocsparseio_csx_analytics_t& that)
+    {
+        if(this->length_count.size() < that.length_count.size())
+        {
+            this->length_count.resize(that.length_count.size(), 0);
+        }
+        for(size_t i = 0; i < that.length_count.size(); ++i)
+        {
+            this->length_count[i] += that.length_count[i];
+        }
+        this->ninvalid += that.ninvalid;
+        this->lower_bandwidth = std::max(this->lower_bandwidth, that.lower_bandwidth);
+        this->upper_bandwidth = std::max(this->upper_bandwidth, that.upper_bandwidth);
+        this->min_distance    = std::min(this->min_distance, that.min_distance);
+        this->profile += that.profile;
+        this->ndiag += that.ndiag;
+        this->nweak_dominant += that.nweak_dominant;
+        this->nstrict_dominant += that.nstrict_dominant;
+        this->hyb_ell_nnz += that.hyb_ell_nnz;
+        this->pattern_fingerprint += that.pattern_fingerprint;
+        this->pattern_fingerprint_tr += that.pattern_fingerprint_tr;
+        this->value_fingerprint += that.value_fingerprint;
+        this->value_fingerprint_tr += that.value_fingerprint_tr;
+        for(int b = ROCSPARSEIO_INFO_BLOCK_DIM_MIN; b <= ROCSPARSEIO_INFO_BLOCK_DIM_MAX; ++b)
+        {
+            this->nblocks[b] += that.nblocks[b];
+        }
+    }
+};
 
-    uint64_t mean_nnz_per_seq;
-    uint64_t min_nnz_per_seq;
-    uint64_t max_nnz_per_seq;
-    uint64_t median_nnz_per_seq;
-    bool     full_diagonal;
-    bool     symbolic_symetric;
-    bool     numeric_symetric;
+inline uint64_t rocsparseio_mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
 
-} rocsparseio_statistics_csx;
+inline uint64_t rocsparseio_fingerprint(uint64_t i, uint64_t j, uint64_t v = 0)
+{
+    return rocsparseio_mix64(rocsparseio_mix64(rocsparseio_mix64(i) ^ j) ^ v);
+}
 
-template <typename J, typename T>
-struct transpose_pair_t
+template <typename T>
+inline uint64_t rocsparseio_value_bits(const T& v)
 {
-    J                        index{-1};
-    const T*                 val;
-    struct transpose_pair_t* next{};
-    transpose_pair_t(J i, const T* v, struct transpose_pair_t* n = nullptr)
-        : index(i)
-        , val(v)
-        , next(n){};
-    ~transpose_pair_t()
-    {
-        index = -1;
-        val   = nullptr;
-        next  = nullptr;
+    uint64_t words[(sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t)] = {};
+    memcpy(words, &v, sizeof(T));
+    uint64_t h = 0;
+    for(uint64_t w : words)
+    {
+        h = rocsparseio_mix64(h ^ w);
+    }
+    return h;
+}
+
+template <typename I, typename J, typename T>
+void rocsparseio_csx_analyze_chunk(uint64_t K,
+                                   uint64_t len_trseq,
+                                   uint64_t k0,
+                                   uint64_t k1,
+                                   const I* __restrict__ ptr_,
+                                   const J* __restrict__ ind_,
+                                   const T* __restrict__ val_,
+                                   uint64_t                     base,
+                                   uint64_t                     hyb_width,
+                                   std::vector<uint64_t>&       work,
+                                   rocsparseio_csx_analytics_t& analytics)
+{
+    for(uint64_t k = k0; k < k1; ++k)
+    {
+        const uint64_t len = ptr_[k + 1] - ptr_[k];
+        if(len >= analytics.length_count.size())
+        {
+            analytics.length_count.resize(len + 1, 0);
+        }
+        ++analytics.length_count[len];
+        analytics.hyb_ell_nnz += std::min(len, hyb_width);
+
+        uint64_t first    = k;
+        bool     has_diag = false;
+        double   diag     = 0.0;
+        double   offdiag  = 0.0;
+        for(uint64_t l = ptr_[k] - base; l < ptr_[k + 1] - base; ++l)
+        {
+            const int64_t ind = int64_t(ind_[l]) - int64_t(base);
+            if(ind < 0 || uint64_t(ind) >= len_trseq)
+            {
+                ++analytics.ninvalid;
+                continue;
+            }
+
+            const uint64_t j = ind;
+            const T        v = val_[l];
+            const uint64_t h = rocsparseio_value_bits(v);
+            analytics.pattern_fingerprint += rocsparseio_fingerprint(k, j);
+            analytics.pattern_fingerprint_tr += rocsparseio_fingerprint(j, k);
+            analytics.value_fingerprint += rocsparseio_fingerprint(k, j, h);
+            analytics.value_fingerprint_tr += rocsparseio_fingerprint(j, k, h);
+            if(j == k)
+            {
+                has_diag = true;
+                diag += std::abs(v);
+                continue;
+            }
+
+            offdiag += std::abs(v);
+            first = std::min(first, j);
+            if(j < k)
+            {
+                analytics.lower_bandwidth = std::max(analytics.lower_bandwidth, k - j);
+                analytics.min_distance    = std::min(analytics.min_distance, k - j);
+            }
+            else
+            {
+                analytics.upper_bandwidth = std::max(analytics.upper_bandwidth, j - k);
+                analytics.min_distance    = std::min(analytics.min_distance, j - k);
+            }
+        }
+
+        analytics.profile += k - first;
+        if(has_diag)
+        {
+            ++analytics.ndiag;
+            analytics.nweak_dominant += (diag >= offdiag) ? 1 : 0;
+            analytics.nstrict_dominant += (diag > offdiag) ? 1 : 0;
+        }
+    }
+
+    //
+    // Distinct block indices of each block row.
+    //
+    for(uint64_t b = ROCSPARSEIO_INFO_BLOCK_DIM_MIN; b <= ROCSPARSEIO_INFO_BLOCK_DIM_MAX; ++b)
+    {
+        for(uint64_t r0 = k0; r0 < k1; r0 += b)
+        {
+            work.clear();
+            const uint64_t r1 = std::min(r0 + b, K);
+            for(uint64_t l = ptr_[r0] - base; l < ptr_[r1] - base; ++l)
+            {
+                work.push_back((ind_[l] - base) / b);
+            }
+            std::sort(work.begin(), work.end());
+            analytics.nblocks[b] += std::unique(work.begin(), work.end()) - work.begin();
+        }
+    }
+}
+
+//
+// Print the analytics, in text or json.
+//
+void rocsparseio_csx_analytics_print(const rocsparseio_csx_analytics_t& analytics,
+                                     rocsparseio_direction              dir,
+                                     uint64_t                           M,
+                                     uint64_t                           N,
+                                     uint64_t                           nnz,
+                                     uint64_t                           hyb_width,
+                                     bool                               json)
+{
+    const uint64_t K = (dir == rocsparseio_direction_row) ? M : N;
+
+    //
+    // Distribution of the number of non-zeros per sequence.
+    //
+    const std::vector<uint64_t>& count    = analytics.length_count;
+    uint64_t                     min_len  = 0;
+    uint64_t                     max_len  = 0;
+    uint64_t                     median   = 0;
+    double                       sum_sq   = 0.0;
+    uint64_t                     nseen    = 0;
+    bool                         have_min = false;
+    for(uint64_t len = 0; len < count.size(); ++len)
+    {
+        if(count[len] == 0)
+        {
+            continue;
+        }
+        if(!have_min)
+        {
+            min_len  = len;
+            have_min = true;
+        }
+        max_len = len;
+        if(nseen <= (K - 1) / 2 && (K - 1) / 2 < nseen + count[len])
+        {
+            median = len;
+        }
+        nseen += count[len];
+        sum_sq += double(count[len]) * double(len) * double(len);
+    }
+    const double mean   = (K > 0) ? double(nnz) / double(K) : 0.0;
+    const double stddev = (K > 0) ? sqrt(std::max(sum_sq / double(K) - mean * mean, 0.0)) : 0.0;
+    const double cv     = (mean > 0.0) ? stddev / mean : 0.0;
+
+    //
+    // Histogram by powers of two: [0], [1], [2, 3], [4, 7], ...
+    //
+    std::vector<uint64_t> histogram;
+    for(uint64_t len = 0; len < count.size(); ++len)
+    {
+        uint64_t bucket = 0;
+        for(uint64_t l = len; l > 0; l >>= 1)
+        {
+            ++bucket;
+        }
+        if(bucket >= histogram.size())
+        {
+            histogram.resize(bucket + 1, 0);
+        }
+        histogram[bucket] += count[len];
+    }
+
+    //
+    // Padding of the ELL storage (width of the longest sequence) and of the ELL part of the HYB
+    // storage (width of the average sequence, the remaining entries being stored in COO).
+    //
+    const uint64_t ell_padding = K * max_len - nnz;
+    const uint64_t hyb_coo_nnz = nnz - analytics.hyb_ell_nnz;
+    const uint64_t hyb_padding = K * hyb_width - analytics.hyb_ell_nnz;
+
+    //
+    // The bandwidths are relative to the rows.
+    //
+    const uint64_t lower = (dir == rocsparseio_direction_row) ? analytics.lower_bandwidth
+                                                              : analytics.upper_bandwidth;
+    const uint64_t upper = (dir == rocsparseio_direction_row) ? analytics.upper_bandwidth
+                                                              : analytics.lower_bandwidth;
+    const uint64_t min_distance
+        = (analytics.min_distance == UINT64_MAX) ? 0 : analytics.min_distance;
+
+    const bool square    = (M == N);
+    const bool sym
+        = square && analytics.pattern_fingerprint == analytics.pattern_fingerprint_tr;
+    const bool num_sym   = sym && analytics.value_fingerprint == analytics.value_fingerprint_tr;
+    const bool full_diag = (analytics.ndiag == std::min(M, N));
+
+    auto ratio = [](uint64_t a, uint64_t b) { return (b > 0) ? double(a) / double(b) : 0.0; };
+
+    if(json)
+    {
+        std::cout << "," << std::endl << "  \"analytics\": {" << std::endl;
+        std::cout << "    \"nnz_per_row\": {\"min\": " << min_len << ", \"max\": " << max_len
+                  << ", \"median\": " << median << ", \"mean\": " << mean
+                  << ", \"stddev\": " << stddev << ", \"cv\": " << cv << "}," << std::endl;
+        std::cout << "    \"nnz_per_row_histogram\": [";
+        for(size_t bucket = 0; bucket < histogram.size(); ++bucket)
+        {
+            const uint64_t lo = (bucket == 0) ? 0 : (uint64_t(1) << (bucket - 1));
+            const uint64_t hi = (bucket == 0) ? 0 : ((uint64_t(1) << bucket) - 1);
+            std::cout << ((bucket > 0) ? ", " : "") << "{\"min\": " << lo << ", \"max\": " << hi
+                      << ", \"count\": " << histogram[bucket] << "}";
+        }
+        std::cout << "]," << std::endl;
+        std::cout << "    \"bandwidth\": {\"lower\": " << lower << ", \"upper\": " << upper
+                  << ", \"b_min\": " << min_distance
+                  << ", \"b_max\": " << std::max(lower, upper) << "}," << std::endl;
+        std::cout << "    \"profile\": " << analytics.profile << "," << std::endl;
+        std::cout << "    \"diagonal\": {\"full\": " << (full_diag ? "true" : "false")
+                  << ", \"count\": " << analytics.ndiag
+                  << ", \"weakly_dominant\": " << analytics.nweak_dominant
+                  << ", \"strictly_dominant\": " << analytics.nstrict_dominant << "},"
+                  << std::endl;
+        std::cout << "    \"symmetry\": {\"symbolic\": " << (sym ? "true" : "false")
+                  << ", \"numeric\": " << (num_sym ? "true" : "false") << "}," << std::endl;
+        std::cout << "    \"ell\": {\"width\": " << max_len << ", \"padding\": " << ell_padding
+                  << ", \"overhead\": " << ratio(ell_padding, nnz) << "}," << std::endl;
+        std::cout << "    \"hyb\": {\"ell_width\": " << hyb_width
+                  << ", \"ell_nnz\": " << analytics.hyb_ell_nnz << ", \"coo_nnz\": " << hyb_coo_nnz
+                  << ", \"padding\": " << hyb_padding
+                  << ", \"overhead\": " << ratio(hyb_padding, nnz) << "}," << std::endl;
+        std::cout << "    \"bsr\": [";
+        for(uint64_t b = ROCSPARSEIO_INFO_BLOCK_DIM_MIN; b <= ROCSPARSEIO_INFO_BLOCK_DIM_MAX; ++b)
+        {
+            std::cout << ((b > ROCSPARSEIO_INFO_BLOCK_DIM_MIN) ? ", " : "")
+                      << "{\"block_dim\": " << b << ", \"nnzb\": " << analytics.nblocks[b]
+                      << ", \"fill\": " << ratio(nnz, analytics.nblocks[b] * b * b) << "}";
+        }
+        std::cout << "]" << std::endl;
+        std::cout << "  }";
+        return;
     }
-};
+
+    std::cout << "min nnz per row: " << min_len << std::endl;
+    std::cout << "max nnz per row: " << max_len << std::endl;
+    std::cout << "median nnz per row: " << median << std::endl;
+    std::cout << "mean nnz per row: " << mean << std::endl;
+    std::cout << "cv nnz per row: " << cv << std::endl;
+    std::cout << "nnz per row histogram:" << std::endl;
+    for(size_t bucket = 0; bucket < histogram.size(); ++bucket)
+    {
+        const uint64_t lo = (bucket == 0) ? 0 : (uint64_t(1) << (bucket - 1));
+        const uint64_t hi = (bucket == 0) ? 0 : ((uint64_t(1) << bucket) - 1);
+        std::cout << "  [" << lo << ", " << hi << "]: " << histogram[bucket] << std::endl;
+    }
+    std::cout << "symbolic symmetry " << (sym ? "true" : "false") << std::endl;
+    std::cout << "numerical symmetry " << (num_sym ? "true" : "false") << std::endl;
+    std::cout << "b_min " << min_distance << std::endl;
+    std::cout << "b_max " << std::max(lower, upper) << std::endl;
+    std::cout << "lower bandwidth " << lower << std::endl;
+    std::cout << "upper bandwidth " << upper << std::endl;
+    std::cout << "profile " << analytics.profile << std::endl;
+    std::cout << "full diagonal " << (full_diag ? "true" : "false") << std::endl;
+    std::cout << "weakly diagonally dominant rows " << analytics.nweak_dominant << std::endl;
+    std::cout << "strictly diagonally dominant rows " << analytics.nstrict_dominant << std::endl;
+    std::cout << "ell width " << max_len << ", padding " << ell_padding << " ("
+              << ratio(ell_padding, nnz) << ")" << std::endl;
+    std::cout << "hyb ell width " << hyb_width << ", ell nnz " << analytics.hyb_ell_nnz
+              << ", coo nnz " << hyb_coo_nnz << ", padding " << hyb_padding << " ("
+              << ratio(hyb_padding, nnz) << ")" << std::endl;
+    for(uint64_t b = ROCSPARSEIO_INFO_BLOCK_DIM_MIN; b <= ROCSPARSEIO_INFO_BLOCK_DIM_MAX; ++b)
+    {
+        std::cout << "bsr " << b << "x" << b << " nnzb " << analytics.nblocks[b] << ", fill "
+                  << ratio(nnz, analytics.nblocks[b] * b * b) << std::endl;
+    }
+}
 
 template <typename I, typename J, typename T>
 rocsparseio_status rocsparseio_csx_statistics(rocsparseio_direction dir,
@@ -69,7 +388,8 @@ rocsparseio_status rocsparseio_csx_statistics(rocsparseio_direction dir,
                                               const I* __restrict__ ptr_,
                                               const J* __restrict__ ind_,
                                               const T* __restrict__ val_,
-                                              rocsparseio_index_base base)
+                                              rocsparseio_index_base base,
+                                              bool                   json)
 {
     uint64_t K         = M;
     uint64_t len_trseq = N;
@@ -109,113 +429,33 @@ rocsparseio_status rocsparseio_csx_statistics(rocsparseio_direction dir,
     }
     }
 
-    using tr_t    = transpose_pair_t<J, T>;
-    tr_t** trseqs = new tr_t*[len_trseq];
-    for(uint64_t i = 0; i < len_trseq; ++i)
-    {
-        trseqs[i] = nullptr;
-    }
-
-    {
-        uint64_t k = K;
-        do
-        {
-            --k;
-            for(uint64_t l = ptr_[k] - base; l < ptr_[k + 1] - base; ++l)
-            {
-                J ind = ind_[l] - base;
-                if(ind < 0 || ind > len_trseq)
-                {
-                    std::cerr << "inconsistent matrix with overflow of indices" << std::endl;
-                    return rocsparseio_status_invalid_value;
-                }
-
-                if(trseqs[ind] == nullptr)
-                {
-                    trseqs[ind] = new tr_t(k, &val_[l]);
-                }
-                else
-                {
-                    auto* q     = trseqs[ind];
-                    trseqs[ind] = new tr_t(k, &val_[l], q);
-                }
-            }
-        } while(k > 0);
-    }
+    const uint64_t hyb_width = (K > 0) ? (nnz + K - 1) / K : 0;
+    const int64_t  nchunks   = (K + ROCSPARSEIO_INFO_CHUNK_NSEQ - 1) / ROCSPARSEIO_INFO_CHUNK_NSEQ;
 
+    rocsparseio_csx_analytics_t analytics;
+#pragma omp parallel
     {
-        uint64_t* count = new uint64_t[K];
-        for(uint64_t k = 0; k < K; ++k)
+        rocsparseio_csx_analytics_t partial;
+        std::vector<uint64_t>       work;
+#pragma omp for schedule(dynamic, 1) nowait
+        for(int64_t chunk = 0; chunk < nchunks; ++chunk)
         {
-            count[k] = ptr_[k + 1] - ptr_[k];
-        }
-        std::sort(count, count + K);
-
-        std::cout << "min nnz per row: " << count[0] << std::endl;
-        std::cout << "max nnz per row: " << count[K - 1] << std::endl;
-        if(K % 2 == 0)
-        {
-            std::cout << "median nnz per row: " << count[(K - 1) / 2 - 1] << " "
-                      << count[(K - 1) / 2] << std::endl;
-        }
-        else
-        {
-            std::cout << "median nnz per row: " << count[(K - 1) / 2] << std::endl;
+            const uint64_t k0 = chunk * ROCSPARSEIO_INFO_CHUNK_NSEQ;
+            const uint64_t k1 = std::min(k0 + ROCSPARSEIO_INFO_CHUNK_NSEQ, K);
+            rocsparseio_csx_analyze_chunk(
+                K, len_trseq, k0, k1, ptr_, ind_, val_, base, hyb_width, work, partial);
         }
+#pragma omp critical
+        analytics.merge(partial);
     }
 
-    uint64_t b_min   = N;
-    uint64_t b_max   = 0;
-    double   sym_val = static_cast<double>(0);
-    bool     sym     = true;
-    for(uint64_t k = 0; k < K; ++k)
+    if(analytics.ninvalid > 0)
     {
-        for(uint64_t l = ptr_[k] - base; l < ptr_[k + 1] - base; ++l)
-        {
-            J        ind = ind_[l] - base;
-            T        v   = val_[l];
-            uint64_t s   = (ind > k) ? (ind - k) : (k - ind);
-            if(k != ind)
-            {
-                b_max     = std::max(s, b_max);
-                b_min     = std::min(s, b_min);
-                auto* lst = trseqs[ind];
-                for(; lst != nullptr; lst = lst->next)
-                {
-                    if(lst->index == k)
-                    {
-                        const double d = std::abs(lst->val[0] - v);
-                        sym_val        = std::max(sym_val, d);
-                        break;
-                    }
-                }
-                if(lst == nullptr)
-                {
-                    sym = false;
-                    break;
-                }
-            }
-        }
-        if(sym == false)
-        {
-            break;
-        }
-    }
-    std::cout << "symbolic symmetry " << (sym ? "true" : "false") << std::endl;
-    std::cout << "numerical symmetry " << (sym_val > 0.0 ? "false" : "true") << std::endl;
-    std::cout << "b_min " << b_min << std::endl;
-    std::cout << "b_max " << b_max << std::endl;
-    for(uint64_t i = 0; i < len_trseq; ++i)
-    {
-        auto* p = trseqs[i];
-        do
-        {
-            auto* q = p;
-            p       = p->next;
-            delete q;
-        } while(p != nullptr);
+        std::cerr << "inconsistent matrix with overflow of indices" << std::endl;
+        return rocsparseio_status_invalid_value;
     }
-    delete[] trseqs;
+
+    rocsparseio_csx_analytics_print(analytics, dir, M, N, nnz, hyb_width, json);
     return rocsparseio_status_success;
 }
 
@@ -227,13 +467,14 @@ rocsparseio_status rocsparseio_csx_statistics(rocsparseio_direction dir,
                                               const void* __restrict__ ptr_,
                                               const void* __restrict__ ind_,
                                               const void* __restrict__ val_,
-                                              rocsparseio_index_base base)
+                                              rocsparseio_index_base base,
+                                              bool                   json)
 {
     const I* __restrict__ ptr = (const I* __restrict__)ptr_;
     const J* __restrict__ ind = (const J* __restrict__)ind_;
     const T* __restrict__ val = (const T* __restrict__)val_;
 
-    return rocsparseio_csx_statistics(dir, M, N, nnz, ptr, ind, val, base);
+    return rocsparseio_csx_statistics(dir, M, N, nnz, ptr, ind, val, base, json);
 }
 
 template <typename I, typename J, typename... P>
@@ -333,19 +574,29 @@ void usage(const char* appname_)
     fprintf(stderr, "NAME\n");
     fprintf(stderr, "       %s -- Get ROCSPARSEIO file information\n", appname_);
     fprintf(stderr, "SYNOPSIS\n");
-    fprintf(stderr, "       %s [OPTION]... -o <output file> \n", appname_);
+    fprintf(stderr, "       %s [OPTION]... <input file> \n", appname_);
     fprintf(stderr, "DESCRIPTION\n");
     fprintf(stderr, "\n");
-    fprintf(stderr, "       List meta-data information.\n");
+    fprintf(stderr, "       List meta-data information, and analyze sparse csr/csc matrices.\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "OPTIONS\n");
     fprintf(stderr, "       -v, --verbose\n");
     fprintf(stderr, "              use verbose of information.\n");
+    fprintf(stderr, "       -j, --json\n");
+    fprintf(stderr, "              print the information in json.\n");
     fprintf(stderr, "       -h, --help\n");
     fprintf(stderr, "              produces this help and exit.\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "NOTES\n");
     fprintf(stderr, "\n");
+    fprintf(stderr, "       The analytics are the distribution of the number of non-zeros\n");
+    fprintf(stderr, "       per row, the bandwidth and profile, the diagonal dominance, the\n");
+    fprintf(stderr, "       symmetry, the padding of the ell and hyb storages and the fill\n");
+    fprintf(stderr, "       ratios of the bsr storage with blocks of dimension %d to %d. The\n",
+            ROCSPARSEIO_INFO_BLOCK_DIM_MIN,
+            ROCSPARSEIO_INFO_BLOCK_DIM_MAX);
+    fprintf(stderr, "       rows are the columns of a csc matrix, except for the bandwidth.\n");
+    fprintf(stderr, "\n");
 }
 
 #define ROCSPARSEIO_CHECK(stus)                                             \
@@ -359,6 +610,19 @@ void usage(const char* appname_)
         }                                                                   \
     } while(false)
 
+template <typename T>
+void rocsparseio_info_print(bool json, const char* key, const T& value)
+{
+    if(json)
+    {
+        std::cout << "," << std::endl << "  \"" << key << "\": " << value;
+    }
+    else
+    {
+        std::cout << std::left << std::setw(10) << key << ": " << value << std::endl;
+    }
+}
+
 int main(int argc, char** argv)
 {
     rocsparseio_cmdline_t cmd(argc, argv);
@@ -369,14 +633,32 @@ int main(int argc, char** argv)
         return ROCSPARSEIO_STATUS_SUCCESS;
     }
 
+    const bool json = cmd.option("-j") || cmd.option("--json");
+    if(cmd.isempty())
+    {
+        std::cerr << "missing input file" << std::endl;
+        return 1;
+    }
+
+    //
+    // The arrays of a sparse matrix are mapped when possible, the analytics pass then streams
+    // them from the page cache.
+    //
     rocsparseio_handle handle;
     rocsparseio_status status;
-    rocsparseio_rwmode mode = rocsparseio_rwmode_read;
-    status                  = rocsparseio_open(&handle, mode, argv[1]);
+    rocsparseio_rwmode mode = rocsparseio_rwmode_read_mmap;
+    status                  = rocsparseio_open(&handle, mode, cmd.get_arg(1));
+    ROCSPARSEIO_CHECK(status);
 
     rocsparseio_format format;
 
     status = rocsparseio_read_format(handle, &format);
+    ROCSPARSEIO_CHECK(status);
+    if(json)
+    {
+        std::cout << "{" << std::endl << "  \"format\": " << format;
+    }
+
     switch(format)
     {
     case rocsparseio_format_dense_vector:
@@ -385,9 +667,8 @@ int main(int argc, char** argv)
         uint64_t         data_nmemb;
         status = rocsparseiox_read_metadata_dense_vector(handle, &data_type, &data_nmemb);
         ROCSPARSEIO_CHECK(status);
-        std::cout << "data_type : " << data_type << std::endl;
-        std::cout << "data_nmemb : " << data_nmemb << std::endl;
-
+        rocsparseio_info_print(json, "data_type", data_type);
+        rocsparseio_info_print(json, "data_nmemb", data_nmemb);
         break;
     }
 
@@ -398,10 +679,10 @@ int main(int argc, char** argv)
         uint64_t          m, n;
         status = rocsparseiox_read_metadata_dense_matrix(handle, &order, &m, &n, &data_type);
         ROCSPARSEIO_CHECK(status);
-        std::cout << "data_type : " << data_type << std::endl;
-        std::cout << "order : " << order << std::endl;
-        std::cout << "m : " << m << std::endl;
-        std::cout << "n : " << n << std::endl;
+        rocsparseio_info_print(json, "data_type", data_type);
+        rocsparseio_info_print(json, "order", order);
+        rocsparseio_info_print(json, "m", m);
+        rocsparseio_info_print(json, "n", n);
         break;
     }
     case rocsparseio_format_sparse_csx:
@@ -414,13 +695,14 @@ int main(int argc, char** argv)
         status = rocsparseiox_read_metadata_sparse_csx(
             handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base);
         ROCSPARSEIO_CHECK(status);
-        std::cout << "m         : " << m << std::endl;
-        std::cout << "n         : " << n << std::endl;
-        std::cout << "nnz       : " << nnz << std::endl;
-        std::cout << "ptr_type  : " << ptr_type << std::endl;
-        std::cout << "ind_type  : " << ind_type << std::endl;
-        std::cout << "val_type : " << val_type << std::endl;
-        std::cout << "base      : " << base << std::endl;
+        rocsparseio_info_print(json, "dir", dir);
+        rocsparseio_info_print(json, "m", m);
+        rocsparseio_info_print(json, "n", n);
+        rocsparseio_info_print(json, "nnz", nnz);
+        rocsparseio_info_print(json, "ptr_type", ptr_type);
+        rocsparseio_info_print(json, "ind_type", ind_type);
+        rocsparseio_info_print(json, "val_type", val_type);
+        rocsparseio_info_print(json, "base", base);
 
         uint64_t val_type_size, ind_type_size, ptr_type_size;
 
@@ -433,28 +715,36 @@ int main(int argc, char** argv)
         status = rocsparseio_type_get_size(ind_type, &ind_type_size);
         ROCSPARSEIO_CHECK(status);
 
-        uint64_t s = (val_type_size + ind_type_size) * nnz + (m + 1) * ptr_type_size;
-
-        uint64_t nmb = s / (1024 * 1024);
-        uint64_t ngb = nmb / 1024;
-
-        nmb += nmb % 1024;
-        std::cout << "memory: " << ngb << " Go," << nmb << " Mb " << s % 1024 << " kb" << std::endl;
-
         uint64_t ptr_size = (dir == rocsparseio_direction_row) ? (m + 1) : (n + 1);
-        void*    ptr      = malloc(ptr_type_size * ptr_size);
-
-        uint64_t ind_size = nnz;
-        void*    ind      = malloc(ind_type_size * ind_size);
-
-        uint64_t val_size = nnz;
-        void*    val      = malloc(val_type_size * val_size);
-
-        status = rocsparseiox_read_sparse_csx(handle, ptr, ind, val);
+        uint64_t s        = (val_type_size + ind_type_size) * nnz + ptr_size * ptr_type_size;
+        rocsparseio_info_print(json, "bytes", s);
+
+        const void* ptr    = nullptr;
+        const void* ind    = nullptr;
+        const void* val    = nullptr;
+        void*       buffer = nullptr;
+        status             = rocsparseiox_map_sparse_csx(handle, &ptr, &ind, &val);
+        if(status != rocsparseio_status_success)
+        {
+            //
+            // Encoded or unaligned arrays are read in memory.
+            //
+            buffer = malloc(ptr_type_size * ptr_size + ind_type_size * nnz + val_type_size * nnz);
+            ptr    = buffer;
+            ind    = (char*)buffer + ptr_type_size * ptr_size;
+            val    = (char*)ind + ind_type_size * nnz;
+            status = rocsparseiox_read_sparse_csx(handle, (void*)ptr, (void*)ind, (void*)val);
+            if(status != rocsparseio_status_success)
+            {
+                free(buffer);
+            }
+            ROCSPARSEIO_CHECK(status);
+        }
 
         status = rocsparseio_csx_statistics_dynamic_dispatch(
-            ptr_type, ind_type, val_type, dir, m, n, nnz, ptr, ind, val, base);
-
+            ptr_type, ind_type, val_type, dir, m, n, nnz, ptr, ind, val, base, json);
+        free(buffer);
+        ROCSPARSEIO_CHECK(status);
         break;
     }
     case rocsparseio_format_sparse_gebsx:
@@ -467,6 +757,11 @@ int main(int argc, char** argv)
     }
     }
 
+    if(json)
+    {
+        std::cout << std::endl << "}" << std::endl;
+    }
+
     status = rocsparseio_close(handle);
     ROCSPARSEIO_CHECK(status);
     return 0;